@@ -0,0 +1,108 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+/*	Register command throughput. Against a fake SK7 (see fake_sk7.h) with a fixed round trip time,
+*	in which register <addr> holds (addr & 0xFF) ^ 0x5A, times shake_read() from one thread and 
+*	from 4 threads at once, then shake_read_async() with command windows of 1, 4 and 16, checking
+*	every value that comes back.
+*
+*	usage: bench_commands [round trip time in us] [commands] */
+
+#include "fake_sk7.h"
+
+#define READER_THREADS 4
+
+static shake_device* dev;
+static int commands = 2000;
+static volatile int completed, wrong;
+
+static int expected_value(int addr) {
+	return (addr & 0xFF) ^ 0x5A;
+}
+
+static void* reader(void* param) {
+	int base = (int)(long)param, i, addr;
+	unsigned char value;
+
+	for(i=0;i<commands / READER_THREADS;i++) {
+		addr = base + (i % 16);
+		if(shake_read(dev, addr, &value) != SHAKE_SUCCESS || value != expected_value(addr))
+			__sync_fetch_and_add(&wrong, 1);
+	}
+	return NULL;
+}
+
+static void SHAKE_CALLBACK read_done(shake_device* sh, int addr, int status, unsigned char value, void* user) {
+	if(status != SHAKE_COMMAND_ACK || value != expected_value(addr))
+		__sync_fetch_and_add(&wrong, 1);
+	__sync_fetch_and_add(&completed, 1);
+}
+
+int main(int argc, char** argv) {
+	pthread_t threads[READER_THREADS];
+	unsigned char value;
+	double rtt = 0.005, start;
+	int i, window;
+
+	if(argc > 1)
+		rtt = atof(argv[1]) / 1000000.0;
+	if(argc > 2)
+		commands = atoi(argv[2]);
+
+	for(i=0;i<0x10000;i++)
+		fake_sk7_registers[i] = (unsigned char)expected_value(i);
+	dev = fake_sk7_open(rtt);
+	if(!dev) {
+		printf("couldn't open the fake device\n");
+		return 1;
+	}
+	printf("round trip %.0f us, %d commands\n", rtt * 1000000.0, commands);
+
+	start = fake_sk7_now();
+	for(i=0;i<commands;i++) {
+		if(shake_read(dev, 0x10 + (i % 16), &value) != SHAKE_SUCCESS || value != expected_value(0x10 + (i % 16)))
+			wrong++;
+	}
+	printf("shake_read, 1 thread:          %8.1f us/command\n", (fake_sk7_now() - start) / commands * 1000000.0);
+
+	start = fake_sk7_now();
+	for(i=0;i<READER_THREADS;i++)
+		pthread_create(&threads[i], NULL, reader, (void*)(long)(0x100 * (i + 1)));
+	for(i=0;i<READER_THREADS;i++)
+		pthread_join(threads[i], NULL);
+	printf("shake_read, %d threads:         %8.1f us/command\n", READER_THREADS, (fake_sk7_now() - start) / (commands / READER_THREADS * READER_THREADS) * 1000000.0);
+
+	for(window=1;window<=16;window*=4) {
+		shake_set_command_window(dev, window);
+		completed = 0;
+		start = fake_sk7_now();
+		for(i=0;i<commands;i++)
+			shake_read_async(dev, 0x10 + (i % 64), NULL, read_done, NULL);
+		while(completed < commands)
+			usleep(10);
+		printf("shake_read_async, window %2d:   %8.1f us/command\n", window, (fake_sk7_now() - start) / commands * 1000000.0);
+	}
+
+	printf("%d wrong or failed\n", wrong);
+	fake_sk7_close(dev);
+	return wrong != 0;
+}
@@ -0,0 +1,140 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/*	Decimal field decoding (the SK7 QTN packet fields). Checks dec_ascii_to_float() against strtof()
+*	over every [+-]d.dddd to [+-]d.ddddddd value, runs shake_parse_decimal_fields() over the shared 
+*	vectors in decimal_vectors.txt, and times a full quaternion field against the copy + sscanf 
+*	the packet handler used before.
+*
+*	usage: bench_decimal [vector file] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "shake_driver.h"
+#include "shake_packets.h"
+
+#define ROUNDS 2000000
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+// every value with 1 integer digit and 4-7 fraction digits, compared bit for bit with strtof()
+static long check_exhaustive(long* checked) {
+	const char* formats[] = { "%c%d.%04d", "%c%d.%05d", "%c%d.%06d", "%c%d.%07d" };
+	const int limits[] = { 10000, 100000, 1000000, 10000000 };
+	char buf[32];
+	long bad = 0;
+	int f, sign, ip, fp, len, used;
+	float value, expected;
+
+	*checked = 0;
+	for(f=0;f<4;f++) {
+		for(sign=0;sign<2;sign++) {
+			// the 7 fraction digit form is only checked for 0.x and 1.x, which already covers every exponent it reaches
+			for(ip=0;ip<(f == 3 ? 2 : 10);ip++) {
+				for(fp=0;fp<limits[f];fp++) {
+					len = sprintf(buf, formats[f], sign ? '-' : '+', ip, fp);
+					value = 0;
+					used = dec_ascii_to_float(buf, len, &value);
+					expected = strtof(buf, NULL);
+					(*checked)++;
+					if(used != len || memcmp(&value, &expected, sizeof(float)) != 0) {
+						if(bad < 5)
+							printf("mismatch: %s gave %a, expected %a\n", buf, value, expected);
+						bad++;
+					}
+				}
+			}
+		}
+	}
+	return bad;
+}
+
+// runs each line of the vector file through shake_parse_decimal_fields(), returning the number that fail
+static int check_vectors(const char* path, int* lines) {
+	char line[512], *tab, *p, *end;
+	float values[16], expected[16];
+	int count, n, bad = 0;
+	FILE* f = fopen(path, "r");
+
+	*lines = 0;
+	if(!f) {
+		printf("can't open %s\n", path);
+		return 1;
+	}
+	while(fgets(line, sizeof(line), f)) {
+		line[strcspn(line, "\r\n")] = 0;
+		if(line[0] == '#' || (tab = strchr(line, '\t')) == NULL)
+			continue;
+		*tab = 0;
+		for(n=0,p=tab+1;n<16;n++) {
+			expected[n] = strtof(p, &end);
+			if(end == p)
+				break;
+			p = end;
+		}
+		count = shake_parse_decimal_fields(line, (int)strlen(line), values, 16);
+		if(count != n || memcmp(values, expected, n * sizeof(float)) != 0) {
+			printf("vector failed: \"%s\" gave %d values, expected %d\n", line, count, n);
+			bad++;
+		}
+		(*lines)++;
+	}
+	fclose(f);
+	return bad;
+}
+
+int main(int argc, char** argv) {
+	char field[] = "+0.70711,-0.00012,+0.70710,+1.00000";
+	char copy[sizeof(field)];
+	float values[4], sum = 0;
+	long checked, bad;
+	int i, lines, failed;
+	double t0, t1, t2;
+
+	bad = check_exhaustive(&checked);
+	printf("%ld values checked against strtof: %ld mismatches\n", checked, bad);
+
+	failed = check_vectors(argc > 1 ? argv[1] : "decimal_vectors.txt", &lines);
+	printf("%d vectors: %d failed\n", lines, failed);
+
+	t0 = now();
+	for(i=0;i<ROUNDS;i++) {
+		field[7] = '0' + (i % 10);
+		dec_ascii_to_floats(field, sizeof(field) - 1, values, 4);
+		sum += values[0];
+	}
+	t1 = now();
+	for(i=0;i<ROUNDS;i++) {
+		field[7] = '0' + (i % 10);
+		memcpy(copy, field, sizeof(field));
+		sscanf(copy, "%f,%f,%f,%f", &values[0], &values[1], &values[2], &values[3]);
+		sum += values[0];
+	}
+	t2 = now();
+	printf("quaternion field: %.0f ns (copy + sscanf) -> %.0f ns (fixed format) [%g]\n", (t2 - t1) / ROUNDS * 1e9, (t1 - t0) / ROUNDS * 1e9, sum);
+
+	return (bad != 0 || failed != 0);
+}
@@ -0,0 +1,187 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+/*	Event dispatch. Several devices, each one end of a socket pair, are sent a steady stream of 
+*	navigation events (up, down, centre, normal, repeating) by one writer thread. Each dispatch 
+*	mode (the device's own callback thread, a pool of 2 threads, and inline on the reader thread)
+*	is run with the plain callback and with the batch callback. For each run the callback latency 
+*	percentiles come from the shake_get_stats() histograms of all the devices together, and any
+*	events that arrived out of order, were dropped or never arrived are reported.
+*
+*	usage: bench_events [devices] [events per device] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <time.h>
+#include "shake_driver.h"
+
+#define MAX_DEVICES 64
+#define POOL_THREADS 2
+// events written to each device before moving on to the next, and the pause after each round (us)
+#define EVENTS_PER_WRITE 4
+#define ROUND_PAUSE 1000
+
+static const int event_order[4] = { SHAKE_NAV_UP, SHAKE_NAV_DOWN, SHAKE_NAV_CENTRE, SHAKE_NAV_NORMAL };
+static const char* event_packets[4] = { "$NVU\r\n", "$NVD\r\n", "$NVC\r\n", "$NVN\r\n" };
+
+static shake_device* devs[MAX_DEVICES];
+static int write_fds[MAX_DEVICES];
+static volatile int received[MAX_DEVICES], out_of_order;
+static int devices = 8, events = 4000;
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+// callbacks for a device are never made from two threads at once, so received[] needs no lock
+static void check_event(int dev, int type) {
+	if(type != event_order[received[dev] % 4])
+		out_of_order++;
+	received[dev]++;
+}
+
+static void SHAKE_CALLBACK event_callback(shake_device* sh, int type) {
+	int dev;
+
+	for(dev=0;dev<devices;dev++) {
+		if(devs[dev] == sh)
+			check_event(dev, type);
+	}
+}
+
+static void SHAKE_CALLBACK batch_callback(shake_device* sh, shake_event* batch, int count, void* user) {
+	int i;
+
+	for(i=0;i<count;i++)
+		check_event((int)(long)user, batch[i].type);
+}
+
+static void* writer(void* param) {
+	char buf[EVENTS_PER_WRITE * 6];
+	int sent, dev, i;
+
+	for(sent=0;sent<events;sent+=EVENTS_PER_WRITE) {
+		for(dev=0;dev<devices;dev++) {
+			for(i=0;i<EVENTS_PER_WRITE;i++)
+				memcpy(buf + i * 6, event_packets[(sent + i) % 4], 6);
+			if(write(write_fds[dev], buf, sizeof(buf)) != (int)sizeof(buf))
+				return NULL;
+		}
+		usleep(ROUND_PAUSE);
+	}
+	return NULL;
+}
+
+// returns the upper bound in us of the bin holding the <fraction> point of the histogram
+static int percentile(unsigned int* bins, double fraction) {
+	unsigned int total = 0, seen = 0;
+	int i;
+
+	for(i=0;i<SHAKE_STATS_LATENCY_BINS;i++)
+		total += bins[i];
+	for(i=0;i<SHAKE_STATS_LATENCY_BINS;i++) {
+		seen += bins[i];
+		if(seen >= total * fraction)
+			break;
+	}
+	return 1 << i;
+}
+
+static int run(const char* name, int mode, BOOL batch) {
+	unsigned int latency[SHAKE_STATS_LATENCY_BINS];
+	unsigned int dropped = 0;
+	shake_stats stats;
+	pthread_t thread;
+	int dev, i, sv[2], complete, lost = 0;
+	double start;
+
+	memset(latency, 0, sizeof(latency));
+	out_of_order = 0;
+	for(dev=0;dev<devices;dev++) {
+		received[dev] = 0;
+		socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+		write_fds[dev] = sv[1];
+		devs[dev] = shake_init_device_socket(sv[0], SHAKE_SK7);
+		if(!devs[dev] || shake_set_event_dispatch(devs[dev], mode) != SHAKE_SUCCESS) {
+			printf("couldn't set up device %d\n", dev);
+			return 1;
+		}
+		if(batch)
+			shake_register_event_batch_callback(devs[dev], batch_callback, (void*)(long)dev);
+		else
+			shake_register_event_callback(devs[dev], event_callback);
+	}
+	start = now();
+	pthread_create(&thread, NULL, writer, NULL);
+	pthread_join(thread, NULL);
+	do {
+		usleep(1000);
+		for(complete=0,dev=0;dev<devices;dev++)
+			complete += (received[dev] >= events);
+	} while(complete < devices && now() - start < 30);
+
+	for(dev=0;dev<devices;dev++) {
+		shake_get_stats(devs[dev], &stats);
+		for(i=0;i<SHAKE_STATS_LATENCY_BINS;i++)
+			latency[i] += stats.callback_latency[i];
+		dropped += stats.events_dropped;
+		lost += events - received[dev];
+		shake_free_device(devs[dev]);
+		close(write_fds[dev]);
+	}
+	printf("%-8s %-6s latency p50 <%5d us  p99 <%6d us  %d out of order, %u dropped, %d missing\n", 
+		name, batch ? "batch" : "plain", percentile(latency, 0.5), percentile(latency, 0.99), out_of_order, dropped, lost);
+	return out_of_order != 0 || lost != 0;
+}
+
+int main(int argc, char** argv) {
+	int failed = 0, batch;
+
+	if(argc > 1)
+		devices = atoi(argv[1]);
+	if(argc > 2)
+		events = atoi(argv[2]);
+	if(devices < 1 || devices > MAX_DEVICES) {
+		printf("devices must be from 1 to %d\n", MAX_DEVICES);
+		return 1;
+	}
+	if(shake_event_pool_start(POOL_THREADS) != SHAKE_SUCCESS) {
+		printf("shake_event_pool_start failed\n");
+		return 1;
+	}
+	printf("%d devices, %d events each\n", devices, events);
+
+	for(batch=0;batch<2;batch++) {
+		failed |= run("thread", SHAKE_DISPATCH_THREAD, batch);
+		failed |= run("pool", SHAKE_DISPATCH_POOL, batch);
+		failed |= run("inline", SHAKE_DISPATCH_INLINE, batch);
+	}
+
+	shake_event_pool_stop();
+	return failed;
+}
@@ -0,0 +1,116 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/*	Packet header classification. Checks the lookup tables built by shake_build_header_lookup()
+*	against the linear search SK7::classify_packet_header() used to do, on every known header and
+*	on a few million random ones, then times both.
+*
+*	usage: bench_headers */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "shake_packets.h"
+
+#define ROUNDS 20000000
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+// the old classification: a strncmp against each ASCII header in turn, or a walk of the raw header table
+static int linear_classify(char* header, int ascii) {
+	int i;
+
+	if(ascii) {
+		for(i=0;i<=SK7_STARTUP_INFO;i++) {
+			if(strncmp(header, sk7_packet_headers[i], 4) == 0)
+				return i;
+		}
+		return SHAKE_BAD_PACKET;
+	}
+	for(i=SK7_RAW_DATA_ACC;i<SK7_NUM_PACKET_TYPES;i++) {
+		if(header[2] == sk7_raw_packet_headers[i - SK7_RAW_DATA_ACC])
+			return i;
+	}
+	return SHAKE_BAD_PACKET;
+}
+
+int main() {
+	static shake_header_lookup lookup;
+	char header[4], ascii[64][4], raw[14][3];
+	int i, j, mismatches = 0, num_raw = (int)sizeof(sk7_raw_packet_headers);
+	volatile int sink = 0;
+	double t0, t1, t2;
+
+	shake_build_header_lookup(&lookup, sk7_packet_headers, SK7_STARTUP_INFO + 1, sk7_raw_packet_headers, num_raw, SK7_RAW_DATA_ACC);
+
+	for(i=0;i<=SK7_STARTUP_INFO;i++) {
+		memcpy(header, sk7_packet_headers[i], 4);
+		if(linear_classify(header, 1) != shake_lookup_ascii_header(&lookup, header))
+			mismatches++;
+	}
+	srand(1);
+	for(i=0;i<2000000;i++) {
+		for(j=0;j<4;j++)
+			header[j] = (char)(rand() & 0xff);
+		if(i & 1)
+			header[0] = '$';
+		if(linear_classify(header, 1) != shake_lookup_ascii_header(&lookup, header))
+			mismatches++;
+		header[0] = header[1] = 0x7f;
+		if(linear_classify(header, 0) != shake_lookup_raw_header(&lookup, header))
+			mismatches++;
+	}
+	printf("known headers + 2M random: %d mismatches\n", mismatches);
+
+	// a typical mix of headers, so the linear search isn't always hitting the first entry
+	for(i=0;i<64;i++)
+		memcpy(ascii[i], sk7_packet_headers[(i * 7) % (SK7_STARTUP_INFO + 1)], 4);
+	for(i=0;i<num_raw && i<14;i++) {
+		raw[i][0] = raw[i][1] = 0x7f;
+		raw[i][2] = sk7_raw_packet_headers[i];
+	}
+	if(num_raw > 14)
+		num_raw = 14;
+
+	t0 = now();
+	for(i=0;i<ROUNDS;i++)
+		sink += linear_classify(ascii[i & 63], 1);
+	t1 = now();
+	for(i=0;i<ROUNDS;i++)
+		sink += shake_lookup_ascii_header(&lookup, ascii[i & 63]);
+	t2 = now();
+	printf("ascii: %.1f ns/header (loop) -> %.1f ns/header (lookup)\n", (t1 - t0) / ROUNDS * 1e9, (t2 - t1) / ROUNDS * 1e9);
+
+	t0 = now();
+	for(i=0;i<ROUNDS;i++)
+		sink += linear_classify(raw[i % num_raw], 0);
+	t1 = now();
+	for(i=0;i<ROUNDS;i++)
+		sink += shake_lookup_raw_header(&lookup, raw[i % num_raw]);
+	t2 = now();
+	printf("raw:   %.1f ns/header (loop) -> %.1f ns/header (lookup)\n", (t1 - t0) / ROUNDS * 1e9, (t2 - t1) / ROUNDS * 1e9);
+
+	return mismatches != 0;
+}
@@ -0,0 +1,167 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/*	Mu-law conversion. Checks shake_mulaw_compress() and shake_mulaw_lookup() against the table
+*	based conversion they replaced: every 16 bit input at 17 different buffer offsets, and every
+*	byte for lengths 0-300 (also checking the source buffer isn't written to). Then times both in
+*	bulk, as for an upload page, and one frame at a time for frame sizes from 8 to 256 samples (the 
+*	SK6 audio path uses 32 sample frames).
+*	Add -DSHAKE_NO_SIMD to CFLAGS in build.sh to check the portable version instead.
+*
+*	usage: bench_mulaw */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "shake_driver.h"
+#include "shake_mulaw.h"
+#include "shake_parsing.h"
+
+#define BULK_SAMPLES (1056 * 2000)
+#define FRAME_SAMPLES 32000000
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+// the conversions as they were, one table lookup per sample
+static void table_compress(const short* samples, int count, unsigned char* output) {
+	int i;
+	for(i=0;i<count;i++)
+		output[i] = LinearToMuLawSample(samples[i]);
+}
+
+static void table_lookup(short* dest, unsigned char* data, int len) {
+	int i;
+	for(i=0;i<len;i++) {
+		if(data[i] == 0)
+			data[i] = 0x7F;
+		dest[i] = MuLawDecompressTable[data[i]];
+	}
+}
+
+int main() {
+	static short all[65536 + 32], decoded[300], expected[300];
+	static unsigned char encoded[65536 + 32], reference[65536 + 32];
+	static const int frame_sizes[] = { 8, 16, 32, 48, 64, 128, 256 };
+	unsigned char src[300], data[300], copy[300], frame_out[256];
+	short frame[256], frame_decoded[256], *pcm, *pcm_out;
+	unsigned char* mulaw;
+	int i, k, len, off, size, frames, bad = 0, unchanged = 1;
+	volatile int sink = 0;
+	double t0, t1, t2;
+
+	for(i=0;i<65536;i++)
+		all[i] = (short)(i - 32768);
+	for(off=0;off<17;off++) {
+		shake_mulaw_compress(all + off, 65536 - off, encoded);
+		table_compress(all + off, 65536 - off, reference);
+		if(memcmp(encoded, reference, 65536 - off) != 0)
+			bad++;
+	}
+	printf("compress, all 65536 inputs at 17 offsets: %s\n", bad ? "MISMATCH" : "identical");
+
+	for(i=0;i<300;i++)
+		src[i] = (unsigned char)(i < 256 ? i : i * 7 + 3);
+	bad = 0;
+	for(len=0;len<=300;len++) {
+		for(off=0;off<3 && off+len<=300;off++) {
+			memcpy(data, src, sizeof(src));
+			memcpy(copy, src, sizeof(src));
+			shake_mulaw_lookup(decoded, data + off, len);
+			table_lookup(expected, copy + off, len);
+			if(memcmp(decoded, expected, len * sizeof(short)) != 0)
+				bad++;
+			if(memcmp(data, src, sizeof(src)) != 0)
+				unchanged = 0;
+		}
+	}
+	printf("lookup, all 256 bytes for lengths 0-300: %s, source %s\n", bad ? "MISMATCH" : "identical", unchanged ? "unchanged" : "MODIFIED");
+
+	pcm = (short*)malloc(BULK_SAMPLES * sizeof(short));
+	pcm_out = (short*)malloc(BULK_SAMPLES * sizeof(short));
+	mulaw = (unsigned char*)malloc(BULK_SAMPLES);
+	srand(1);
+	for(i=0;i<BULK_SAMPLES;i++)
+		pcm[i] = (short)(rand() % 65536 - 32768);
+
+	t0 = now();
+	for(k=0;k<5;k++)
+		table_compress(pcm, BULK_SAMPLES, mulaw);
+	t1 = now();
+	for(k=0;k<5;k++)
+		shake_mulaw_compress(pcm, BULK_SAMPLES, mulaw);
+	t2 = now();
+	printf("compress, bulk: %.2f ns/sample -> %.2f ns/sample\n", (t1 - t0) / BULK_SAMPLES / 5 * 1e9, (t2 - t1) / BULK_SAMPLES / 5 * 1e9);
+
+	t0 = now();
+	for(k=0;k<5;k++)
+		table_lookup(pcm_out, mulaw, BULK_SAMPLES);
+	t1 = now();
+	for(k=0;k<5;k++)
+		shake_mulaw_lookup(pcm_out, mulaw, BULK_SAMPLES);
+	t2 = now();
+	printf("decode, bulk:   %.2f ns/sample -> %.2f ns/sample\n", (t1 - t0) / BULK_SAMPLES / 5 * 1e9, (t2 - t1) / BULK_SAMPLES / 5 * 1e9);
+
+	// one frame at a time, changing a sample each time so nothing can be hoisted out of the loop
+	memcpy(frame, pcm, sizeof(frame));
+	printf("per frame, ns:  size  compress table -> SIMD   decode table -> SIMD\n");
+	for(i=0;i<(int)(sizeof(frame_sizes) / sizeof(frame_sizes[0]));i++) {
+		size = frame_sizes[i];
+		frames = FRAME_SAMPLES / size;
+		t0 = now();
+		for(k=0;k<frames;k++) {
+			frame[k % size] ^= k;
+			table_compress(frame, size, frame_out);
+			sink += frame_out[3];
+		}
+		t1 = now();
+		for(k=0;k<frames;k++) {
+			frame[k % size] ^= k;
+			shake_mulaw_compress(frame, size, frame_out);
+			sink += frame_out[3];
+		}
+		t2 = now();
+		printf("                %4d  %8.0f -> %-8.0f", size, (t1 - t0) / frames * 1e9, (t2 - t1) / frames * 1e9);
+
+		t0 = now();
+		for(k=0;k<frames;k++) {
+			frame_out[k % size] ^= k;
+			table_lookup(frame_decoded, frame_out, size);
+			sink += frame_decoded[3];
+		}
+		t1 = now();
+		for(k=0;k<frames;k++) {
+			frame_out[k % size] ^= k;
+			shake_mulaw_lookup(frame_decoded, frame_out, size);
+			sink += frame_decoded[3];
+		}
+		t2 = now();
+		printf("  %6.0f -> %.0f\n", (t1 - t0) / frames * 1e9, (t2 - t1) / frames * 1e9);
+	}
+
+	free(pcm);
+	free(pcm_out);
+	free(mulaw);
+	return (bad != 0 || !unchanged);
+}
@@ -0,0 +1,120 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+/*	Saving and restoring the non-volatile registers. Against a fake SK7 (see fake_sk7.h) with a
+*	fixed round trip time, compares reading every register shake_nv_snapshot() covers with one 
+*	shake_read() each against the snapshot itself, then writing them back with one shake_write() 
+*	each against shake_nv_restore(). Each is run several times and the mean is reported, and the
+*	values are checked every time.
+*
+*	usage: bench_nv_snapshot [round trip time in us] */
+
+#include <string.h>
+#include "fake_sk7.h"
+
+#define REPEATS 5
+
+static int check_device(shake_register_entry* entries, int count) {
+	int i, bad = 0;
+
+	for(i=0;i<count;i++) {
+		if(fake_sk7_registers[entries[i].address] != (unsigned char)(entries[i].address ^ 0x33))
+			bad++;
+	}
+	return bad;
+}
+
+static void clear_device(shake_register_entry* entries, int count) {
+	int i;
+
+	for(i=0;i<count;i++)
+		fake_sk7_registers[entries[i].address] = 0;
+}
+
+int main(int argc, char** argv) {
+	shake_register_entry snapshot[SHAKE_NV_SNAPSHOT_MAX];
+	shake_device* dev;
+	unsigned char value;
+	double rtt = 0.005, start, single, batch;
+	int count, i, k, bad = 0;
+
+	if(argc > 1)
+		rtt = atof(argv[1]) / 1000000.0;
+	for(i=0;i<0x10000;i++)
+		fake_sk7_registers[i] = (unsigned char)(i ^ 0x33);
+	dev = fake_sk7_open(rtt);
+	if(!dev) {
+		printf("couldn't open the fake device\n");
+		return 1;
+	}
+
+	if(shake_nv_snapshot(dev, snapshot, SHAKE_NV_SNAPSHOT_MAX, &count) != SHAKE_SUCCESS) {
+		printf("shake_nv_snapshot failed\n");
+		return 1;
+	}
+	printf("round trip %.0f us, %d registers, mean of %d runs\n", rtt * 1000000.0, count, REPEATS);
+
+	start = fake_sk7_now();
+	for(k=0;k<REPEATS;k++) {
+		for(i=0;i<count;i++) {
+			if(shake_read(dev, snapshot[i].address, &value) != SHAKE_SUCCESS || value != (unsigned char)(snapshot[i].address ^ 0x33))
+				bad++;
+		}
+	}
+	single = (fake_sk7_now() - start) / REPEATS;
+	start = fake_sk7_now();
+	for(k=0;k<REPEATS;k++) {
+		memset(snapshot, 0, sizeof(snapshot));
+		if(shake_nv_snapshot(dev, snapshot, SHAKE_NV_SNAPSHOT_MAX, &count) != SHAKE_SUCCESS)
+			bad++;
+		for(i=0;i<count;i++) {
+			if(snapshot[i].value != (unsigned char)(snapshot[i].address ^ 0x33))
+				bad++;
+		}
+	}
+	batch = (fake_sk7_now() - start) / REPEATS;
+	printf("save:    shake_read each %7.1f ms -> shake_nv_snapshot %6.1f ms\n", single * 1000.0, batch * 1000.0);
+
+	single = batch = 0;
+	for(k=0;k<REPEATS;k++) {
+		clear_device(snapshot, count);
+		start = fake_sk7_now();
+		for(i=0;i<count;i++) {
+			if(shake_write(dev, snapshot[i].address, snapshot[i].value) != SHAKE_SUCCESS)
+				bad++;
+		}
+		single += fake_sk7_now() - start;
+		bad += check_device(snapshot, count);
+
+		clear_device(snapshot, count);
+		start = fake_sk7_now();
+		if(shake_nv_restore(dev, snapshot, count) != SHAKE_SUCCESS)
+			bad++;
+		batch += fake_sk7_now() - start;
+		bad += check_device(snapshot, count);
+	}
+	printf("restore: shake_write each %6.1f ms -> shake_nv_restore %7.1f ms\n", single / REPEATS * 1000.0, batch / REPEATS * 1000.0);
+	printf("%d wrong or failed\n", bad);
+
+	fake_sk7_close(dev);
+	return bad != 0;
+}
@@ -0,0 +1,155 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+/*	Reactor mode with many devices. Each device is a FIFO which the driver has opened as a USB 
+*	serial port, and one writer thread feeds every FIFO a few packets at a time, round robin, so 
+*	all the devices are busy at once. The time for the last packet to reach every device's sensor
+*	data is measured, along with the process CPU time and the number of threads the driver used.
+*
+*	usage: bench_reactor <reactor threads> [devices] [packets per device]
+*		reactor threads 0: each device gets its own threads, as without shake_reactor_start() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <time.h>
+#include "shake_driver.h"
+
+// packets written to one FIFO before moving on to the next
+#define PACKETS_PER_ROUND 16
+// ACC x value of the last packet sent to each device
+#define LAST_VALUE 9999
+
+static int devices = 200, packets = 10000;
+static int* wfds;
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+static int count_threads() {
+	DIR* dir = opendir("/proc/self/task");
+	int n = 0;
+
+	if(!dir)
+		return -1;
+	while(readdir(dir))
+		n++;
+	closedir(dir);
+	return n - 2;	// . and ..
+}
+
+static void* writer(void* param) {
+	char buf[PACKETS_PER_ROUND * 32];
+	int sent, dev, i, len;
+
+	for(sent=0;sent<packets;sent+=PACKETS_PER_ROUND) {
+		for(dev=0;dev<devices;dev++) {
+			len = 0;
+			for(i=sent;i<sent+PACKETS_PER_ROUND && i<packets;i++)
+				len += sprintf(buf + len, "$ACC,%+05d,+0000,+0000,%02d\r\n", i == packets - 1 ? LAST_VALUE : i % 1000, i % 100);
+			if(write(wfds[dev], buf, len) != len)
+				return NULL;
+		}
+	}
+	return NULL;
+}
+
+int main(int argc, char** argv) {
+	shake_device** devs;
+	pthread_t thread;
+	char fifo[64];
+	int reactors, threads, dev, bad = 0;
+	double start, elapsed, cpu;
+
+	if(argc < 2) {
+		printf("usage: bench_reactor <reactor threads> [devices] [packets per device]\n");
+		return 1;
+	}
+	reactors = atoi(argv[1]);
+	if(argc > 2)
+		devices = atoi(argv[2]);
+	if(argc > 3)
+		packets = atoi(argv[3]);
+
+	if(reactors > 0 && shake_reactor_start(reactors, 0) != SHAKE_SUCCESS) {
+		printf("shake_reactor_start failed\n");
+		return 1;
+	}
+
+	devs = (shake_device**)calloc(devices, sizeof(shake_device*));
+	wfds = (int*)calloc(devices, sizeof(int));
+	for(dev=0;dev<devices;dev++) {
+		sprintf(fifo, "/tmp/shake_bench_fifo%d", dev);
+		unlink(fifo);
+		mkfifo(fifo, 0600);
+		wfds[dev] = open(fifo, O_RDWR);
+		devs[dev] = shake_init_device_usb_serial(fifo, SHAKE_SK7);
+		if(wfds[dev] == -1 || !devs[dev]) {
+			printf("couldn't open device %d (check ulimit -n)\n", dev);
+			return 1;
+		}
+	}
+	threads = count_threads();
+
+	cpu = clock() / (double)CLOCKS_PER_SEC;
+	start = now();
+	pthread_create(&thread, NULL, writer, NULL);
+	for(dev=0;dev<devices;dev++) {
+		while(shake_accx(devs[dev]) != LAST_VALUE) {
+			if(now() - start > 60) {
+				printf("timed out waiting for device %d\n", dev);
+				return 1;
+			}
+			usleep(100);
+		}
+	}
+	elapsed = now() - start;
+	pthread_join(thread, NULL);
+	cpu = clock() / (double)CLOCKS_PER_SEC - cpu;
+
+	for(dev=0;dev<devices;dev++) {
+		if(shake_data_timestamp(devs[dev], SHAKE_SENSOR_ACC) != (packets - 1) % 100)
+			bad++;
+	}
+	printf("%d reactor threads, %d devices: %d threads in the process, %.3fs, %.0f packets/s, process cpu %.2fs, %d devices out of step\n", 
+		reactors, devices, threads, elapsed, (double)devices * packets / elapsed, cpu, bad);
+
+	for(dev=0;dev<devices;dev++) {
+		shake_free_device(devs[dev]);
+		close(wfds[dev]);
+		sprintf(fifo, "/tmp/shake_bench_fifo%d", dev);
+		unlink(fifo);
+	}
+	if(reactors > 0)
+		shake_reactor_stop();
+	free(devs);
+	free(wfds);
+	return bad != 0;
+}
@@ -0,0 +1,92 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+/*	Register shadow. Against a fake SK7 (see fake_sk7.h) with a fixed round trip time, reads every
+*	non-volatile register shake_nv_snapshot() covers with shake_read(), several times over, as an 
+*	application polling its configuration would. Run with the shadow off, with it on, and with it 
+*	on while every 8th register is also rewritten on each pass, reporting the time taken, the 
+*	commands that reached the device and the shadow hits/misses from shake_get_stats(). Every 
+*	value read is checked against the fake device.
+*
+*	usage: bench_shadow [round trip time in us] [passes] */
+
+#include <string.h>
+#include "fake_sk7.h"
+
+static shake_register_entry registers[SHAKE_NV_SNAPSHOT_MAX];
+static int count, passes = 20, bad;
+
+static void run(shake_device* dev, const char* name, int shadow, BOOL rewrite) {
+	shake_stats stats;
+	unsigned char value;
+	int i, k, commands;
+	double start;
+
+	shake_enable_register_shadow(dev, shadow);
+	shake_reset_stats(dev);
+	commands = fake_sk7_commands;
+	start = fake_sk7_now();
+	for(k=0;k<passes;k++) {
+		for(i=0;i<count;i++) {
+			if(rewrite && (i % 8) == 0) {
+				if(shake_write(dev, registers[i].address, (unsigned char)(k + i)) != SHAKE_SUCCESS)
+					bad++;
+			}
+			if(shake_read(dev, registers[i].address, &value) != SHAKE_SUCCESS || value != fake_sk7_registers[registers[i].address])
+				bad++;
+		}
+	}
+	shake_get_stats(dev, &stats);
+	printf("%-20s %8.1f ms %6d commands %6u hits %6u misses\n", name, (fake_sk7_now() - start) * 1000.0, 
+		fake_sk7_commands - commands, stats.register_shadow_hits, stats.register_shadow_misses);
+}
+
+int main(int argc, char** argv) {
+	shake_device* dev;
+	double rtt = 0.005;
+	int i;
+
+	if(argc > 1)
+		rtt = atof(argv[1]) / 1000000.0;
+	if(argc > 2)
+		passes = atoi(argv[2]);
+	for(i=0;i<0x10000;i++)
+		fake_sk7_registers[i] = (unsigned char)(i ^ 0x33);
+	dev = fake_sk7_open(rtt);
+	if(!dev) {
+		printf("couldn't open the fake device\n");
+		return 1;
+	}
+	if(shake_nv_snapshot(dev, registers, SHAKE_NV_SNAPSHOT_MAX, &count) != SHAKE_SUCCESS) {
+		printf("shake_nv_snapshot failed\n");
+		return 1;
+	}
+	printf("round trip %.0f us, %d passes over %d registers\n", rtt * 1000000.0, passes, count);
+
+	run(dev, "shadow off", 0, FALSE);
+	run(dev, "shadow on", 1, FALSE);
+	run(dev, "shadow on, writes", 1, TRUE);
+	printf("%d wrong or failed\n", bad);
+
+	fake_sk7_close(dev);
+	return bad != 0;
+}
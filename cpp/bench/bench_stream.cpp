@@ -0,0 +1,104 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/*	Packet framing and parsing throughput. A recorded stream (see gen_stream.py) is written as
+*	fast as possible into a FIFO which the driver has opened as a USB serial port, and the time
+*	taken for the last packet to reach the sensor data is measured. The reader thread runs on
+*	its own core, so this is the rate a single reader thread can sustain.
+*
+*	usage: bench_stream <stream file> <number of packets in it> [fifo path] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <time.h>
+#include "shake_driver.h"
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+int main(int argc, char** argv) {
+	const char* fifo = "/tmp/shake_bench_fifo";
+	FILE* f;
+	char* data;
+	long len, off = 0, packets, written;
+	double t0, t;
+	int wfd;
+	shake_device* dev;
+
+	if(argc < 3) {
+		printf("usage: bench_stream <stream file> <number of packets in it> [fifo path]\n");
+		return 1;
+	}
+	if(argc > 3)
+		fifo = argv[3];
+	packets = atol(argv[2]);
+
+	f = fopen(argv[1], "rb");
+	if(!f) {
+		printf("can't open %s\n", argv[1]);
+		return 1;
+	}
+	fseek(f, 0, SEEK_END);
+	len = ftell(f);
+	rewind(f);
+	data = (char*)malloc(len);
+	if(fread(data, 1, len, f) != (size_t)len) {
+		printf("can't read %s\n", argv[1]);
+		return 1;
+	}
+	fclose(f);
+
+	// opened read/write first so that neither end blocks waiting for the other
+	unlink(fifo);
+	mkfifo(fifo, 0600);
+	wfd = open(fifo, O_RDWR);
+	dev = shake_init_device_usb_serial((char*)fifo, SHAKE_SK7);
+	if(!dev) {
+		printf("shake_init_device_usb_serial failed\n");
+		return 1;
+	}
+
+	t0 = now();
+	while(off < len) {
+		written = write(wfd, data + off, len - off > 65536 ? 65536 : len - off);
+		if(written > 0)
+			off += written;
+	}
+	while(shake_accx(dev) != 9999) {
+		if(now() - t0 > 60) {
+			printf("timed out waiting for the last packet\n");
+			break;
+		}
+	}
+	t = now() - t0;
+
+	printf("%ld packets in %.3fs = %.0f packets/s (%.1f MB/s)\n", packets, t, packets / t, len / t / 1000000.0);
+
+	shake_free_device(dev);
+	close(wfd);
+	unlink(fifo);
+	return 0;
+}
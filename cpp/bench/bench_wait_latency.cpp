@@ -0,0 +1,123 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/*	Wakeup latency of shake_wait_sample() compared with polling. A writer thread sends one ACC 
+*	packet per millisecond into a FIFO which the driver has opened as a USB serial port. The 
+*	latency of each sample is the time from the driver's receive stamp on the packet to the 
+*	application seeing the new value.
+*
+*	usage: bench_wait_latency <mode> [fifo path]
+*		mode 0: shake_wait_sample()
+*		mode 1: poll with a 1ms sleep
+*		mode 2: poll with a 100us sleep */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <algorithm>
+#include <vector>
+#include "shake_driver.h"
+
+#define SAMPLES 3000
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+static void* writer(void* param) {
+	int wfd = *(int*)param, i, len;
+	char packet[64];
+
+	for(i=1;i<=SAMPLES;i++) {
+		len = sprintf(packet, "$ACC,%+05d,+0000,+0000,00\r\n", i);
+		if(write(wfd, packet, len) != len)
+			break;
+		usleep(1000);
+	}
+	return NULL;
+}
+
+int main(int argc, char** argv) {
+	const char* fifo = "/tmp/shake_bench_fifo";
+	std::vector<double> latency;
+	shake_sensor_snapshot snapshot;
+	shake_device* dev;
+	pthread_t thread;
+	int mode, wfd, last = 0, value;
+	double cpu, t;
+	size_t n;
+
+	if(argc < 2) {
+		printf("usage: bench_wait_latency <mode> [fifo path]\n");
+		return 1;
+	}
+	mode = atoi(argv[1]);
+	if(argc > 2)
+		fifo = argv[2];
+
+	unlink(fifo);
+	mkfifo(fifo, 0600);
+	wfd = open(fifo, O_RDWR);
+	dev = shake_init_device_usb_serial((char*)fifo, SHAKE_SK7);
+	if(!dev) {
+		printf("shake_init_device_usb_serial failed\n");
+		return 1;
+	}
+
+	cpu = clock() / (double)CLOCKS_PER_SEC;
+	pthread_create(&thread, NULL, writer, &wfd);
+	while(last < SAMPLES) {
+		if(mode == 0) {
+			if(shake_wait_sample(dev, 1 << SHAKE_SENSOR_ACC, 2000) <= 0)
+				break;
+		} else {
+			usleep(mode == 1 ? 1000 : 100);
+		}
+		shake_snapshot(dev, &snapshot);
+		t = now();
+		value = snapshot.sensors[SHAKE_SENSOR_ACC].values[0];
+		if(value != last && value > 0 && value <= SAMPLES) {
+			latency.push_back((t - snapshot.sensors[SHAKE_SENSOR_ACC].timestamp) * 1000000.0);
+			last = value;
+		}
+	}
+	cpu = clock() / (double)CLOCKS_PER_SEC - cpu;
+	pthread_join(thread, NULL);
+
+	std::sort(latency.begin(), latency.end());
+	n = latency.size();
+	if(n == 0) {
+		printf("no samples seen\n");
+		return 1;
+	}
+	printf("mode %d: %u samples, latency us p50 %.1f p90 %.1f p99 %.1f max %.1f, process cpu %.2fs\n", 
+		mode, (unsigned int)n, latency[n / 2], latency[n * 9 / 10], latency[n * 99 / 100], latency[n - 1], cpu);
+
+	shake_free_device(dev);
+	close(wfd);
+	unlink(fifo);
+	return 0;
+}
@@ -0,0 +1,15 @@
+# Builds the benchmarks and correctness checks behind the figures quoted in the commit log.
+# The driver is rebuilt here with optimisation on, from the same sources as ../shake_driver/build.sh,
+# and each program is linked against that copy. Run from this directory.
+CFLAGS="-O2 -fno-stack-protector -Wno-write-strings -I../shake_driver/inc"
+LDFLAGS="-lm -lbluetooth -lpthread -lrt"
+LIBSHAKE="libshake_driver.so"
+PROGRAMS="bench_stream bench_headers bench_decimal bench_wait_latency bench_mulaw check_command_timeout bench_reactor bench_commands bench_nv_snapshot bench_shadow bench_events"
+
+rm -f $LIBSHAKE $PROGRAMS
+
+/usr/bin/g++ $CFLAGS -fPIC -shared -o $LIBSHAKE `ls ../shake_driver/src/*.cpp | grep -v win32` $LDFLAGS
+
+for p in $PROGRAMS; do
+	/usr/bin/g++ $CFLAGS -o $p $p.cpp -L. -lshake_driver -Wl,-rpath,'$ORIGIN' $LDFLAGS
+done
@@ -0,0 +1,102 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+/*	Checks that commands sent with only a callback time out on their own. The device is one end of
+*	a socket pair whose other end never replies, and nothing waits on a future, so the only thing 
+*	that can complete the commands is the driver's own timeout check. Run once with the device on
+*	its own threads and once on a reactor thread.
+*
+*	usage: check_command_timeout [commands] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <time.h>
+#include "shake_driver.h"
+
+// a timeout is late if the callback comes this long (ms) after SHAKE_COMMAND_TIMEOUT_MS
+#define LATE_MS 200
+
+static volatile int completed, timeouts;
+static double sent_time, worst;
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+static void SHAKE_CALLBACK done(shake_device* sh, int address, int status, unsigned char value, void* user) {
+	double elapsed = (now() - sent_time) * 1000.0;
+
+	if(status == SHAKE_COMMAND_TIMEOUT)
+		timeouts++;
+	if(elapsed > worst)
+		worst = elapsed;
+	__sync_fetch_and_add(&completed, 1);
+}
+
+static int run(const char* name, int commands) {
+	shake_device* dev;
+	double start;
+	int sv[2], i;
+
+	socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+	dev = shake_init_device_socket(sv[0], SHAKE_SK7);
+	if(!dev) {
+		printf("%s: shake_init_device_socket failed\n", name);
+		return 1;
+	}
+	shake_set_command_window(dev, commands);
+
+	completed = timeouts = 0;
+	worst = 0;
+	sent_time = now();
+	for(i=0;i<commands;i++)
+		shake_read_async(dev, SHAKE_NV_REG_POWER1 + i, NULL, done, NULL);
+
+	start = now();
+	while(completed < commands && now() - start < 2.0)
+		usleep(1000);
+
+	printf("%s: %d/%d commands completed, %d timed out, last after %.0fms (timeout %dms)\n", 
+		name, completed, commands, timeouts, worst, SHAKE_COMMAND_TIMEOUT_MS);
+
+	shake_free_device(dev);
+	close(sv[1]);
+	return (completed == commands && timeouts == commands && worst < SHAKE_COMMAND_TIMEOUT_MS + LATE_MS) ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+	int commands = argc > 1 ? atoi(argv[1]) : 4, failed;
+
+	failed = run("device threads", commands);
+
+	if(shake_reactor_start(1, 0) != SHAKE_SUCCESS) {
+		printf("shake_reactor_start failed\n");
+		return 1;
+	}
+	failed |= run("reactor thread", commands);
+	shake_reactor_stop();
+
+	printf(failed ? "FAILED\n" : "ok\n");
+	return failed;
+}
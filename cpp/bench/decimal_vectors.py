@@ -0,0 +1,29 @@
+# Runs the vectors in decimal_vectors.txt through the pyshake wrapper of the decimal field parser
+# (shake.parse_decimal_fields), to check the wrapper gives exactly what the driver does.
+#
+# usage: python decimal_vectors.py [vector file]
+# with pyshake and python_wrapper/shake.py on the path
+import struct, sys
+import shake
+
+path = "decimal_vectors.txt"
+if len(sys.argv) > 1:
+    path = sys.argv[1]
+
+lines = 0
+failed = 0
+for line in open(path):
+    line = line.rstrip("\r\n")
+    if line.startswith("#") or "\t" not in line:
+        continue
+    text, values = line.split("\t", 1)
+    expected = [float.fromhex(v) for v in values.split()]
+    got = shake.parse_decimal_fields(text, 16)
+    # compared as packed floats so that -0.0 and 0.0 are told apart
+    if [struct.pack("<f", v) for v in got] != [struct.pack("<f", v) for v in expected]:
+        print("vector failed: \"%s\" gave %s, expected %s" % (text, got, expected))
+        failed += 1
+    lines += 1
+
+print("%d vectors: %d failed" % (lines, failed))
+sys.exit(failed != 0)
@@ -0,0 +1,132 @@
+#ifndef _FAKE_SK7_
+#define _FAKE_SK7_
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*	A fake SK7 for the register command benchmarks. The device is one end of a socket pair, and a 
+*	thread on the other end answers every $REA/$WRI command with an ACK after a fixed round trip 
+*	time. Writes are stored in fake_sk7_registers and reads answered from it, and 
+*	fake_sk7_commands counts the commands received. */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE	// ppoll()
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <deque>
+#include <string>
+#include "shake_driver.h"
+
+#define FAKE_SK7_COMMAND_LEN 12
+
+typedef struct {
+	double due;
+	std::string reply;
+} fake_sk7_reply;
+
+static unsigned char fake_sk7_registers[0x10000];
+static volatile int fake_sk7_commands;
+static double fake_sk7_rtt;
+static int fake_sk7_fd = -1;
+static pthread_t fake_sk7_thread;
+
+static double fake_sk7_now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+static void* fake_sk7_run(void* param) {
+	std::deque<fake_sk7_reply> replies;
+	std::string input;
+	char buf[4096], reply[32];
+	struct pollfd pfd;
+	struct timespec timeout;
+	double wait;
+	int n, addr, value;
+	size_t start;
+
+	while(1) {
+		wait = 1.0;
+		if(!replies.empty()) {
+			wait = replies.front().due - fake_sk7_now();
+			if(wait < 0)
+				wait = 0;
+		}
+		timeout.tv_sec = (time_t)wait;
+		timeout.tv_nsec = (long)((wait - timeout.tv_sec) * 1000000000.0);
+		pfd.fd = fake_sk7_fd;
+		pfd.events = POLLIN;
+		if(ppoll(&pfd, 1, &timeout, NULL) > 0) {
+			if((n = read(fake_sk7_fd, buf, sizeof(buf))) <= 0)
+				return NULL;
+			input.append(buf, n);
+			while((start = input.find('$')) != std::string::npos && input.size() - start >= FAKE_SK7_COMMAND_LEN) {
+				std::string command = input.substr(start, FAKE_SK7_COMMAND_LEN);
+				input.erase(0, start + FAKE_SK7_COMMAND_LEN);
+				addr = (int)strtol(command.substr(5, 4).c_str(), NULL, 16) & 0xFFFF;
+				value = (int)strtol(command.substr(10, 2).c_str(), NULL, 16);
+				if(command.compare(0, 4, "$REA") == 0)
+					value = fake_sk7_registers[addr];
+				else
+					fake_sk7_registers[addr] = (unsigned char)value;
+				__sync_fetch_and_add(&fake_sk7_commands, 1);
+				sprintf(reply, "$ACK,%04X,%02X\r\n", addr, value);
+				fake_sk7_reply r = { fake_sk7_now() + fake_sk7_rtt, reply };
+				replies.push_back(r);
+			}
+		}
+		while(!replies.empty() && replies.front().due <= fake_sk7_now()) {
+			if(write(fake_sk7_fd, replies.front().reply.data(), replies.front().reply.size()) <= 0)
+				return NULL;
+			replies.pop_front();
+		}
+	}
+}
+
+/* starts the fake device with a round trip time of <rtt> seconds, returning the driver's device or NULL */
+static shake_device* fake_sk7_open(double rtt) {
+	shake_device* dev;
+	int sv[2];
+
+	if(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == -1)
+		return NULL;
+	fake_sk7_rtt = rtt;
+	fake_sk7_fd = sv[1];
+	pthread_create(&fake_sk7_thread, NULL, fake_sk7_run, NULL);
+	dev = shake_init_device_socket(sv[0], SHAKE_SK7);
+	if(!dev) {
+		close(fake_sk7_fd);
+		pthread_join(fake_sk7_thread, NULL);
+	}
+	return dev;
+}
+
+static void fake_sk7_close(shake_device* dev) {
+	shake_free_device(dev);
+	close(fake_sk7_fd);
+	pthread_join(fake_sk7_thread, NULL);
+}
+
+#endif
@@ -0,0 +1,23 @@
+# Writes the SK7 packet stream used by bench_stream: 200000 rounds of an ASCII ACC packet, a raw
+# GYR packet and an ASCII MAG packet, with a few bytes of garbage every 1000 rounds so the resync
+# path is exercised too, followed by a final ACC packet with x = 9999 marking the end. 
+# Prints the number of packets written, which is the second argument to bench_stream.
+#
+# usage: python gen_stream.py <output file>
+import struct, sys
+
+out = bytearray()
+packets = 0
+for i in range(200000):
+    seq = i % 100
+    out += ("$ACC,%+05d,%+05d,%+05d,%02d\r\n" % (i % 1000, -(i % 500), 7, seq)).encode("ascii")
+    out += bytearray([0x7f, 0x7f, 125]) + bytearray(struct.pack("<hhh", i % 300, -5, 9)) + bytearray([i % 256])
+    out += ("$MAG,+0001,+0002,+0003,%02d\r\n" % seq).encode("ascii")
+    packets += 3
+    if i % 1000 == 0:
+        out += b"garbage!"
+out += b"$ACC,+9999,+0000,+0000,00\r\n"
+packets += 1
+
+open(sys.argv[1], "wb").write(out)
+print(packets)
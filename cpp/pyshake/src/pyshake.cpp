@@ -1,1316 +1,1832 @@
-#undef _DEBUG /* Link with python24.lib and not python24_d.lib */
-
-#ifdef _WIN32
-#define WIN32_LEAN_AND_MEAN
-#include <windows.h>
-#include <mmsystem.h>
-#else
-#include <stdlib.h>
-#endif
-
-#include "shake_driver.h"
-#include "shake_btdefs.h"
-
-#ifdef _WIN32
-#include "Python.h"
-#else
-#include <Python.h>
-#endif
-#include "pyshake.h"
-
-static PyObject* pyshake_ex;
-
-/*	Maximum number of SHAKES to allow on a single host device. For PocketPCs this
-*	is limited to 1 by the OS as far as I can tell. For Windows PCs/laptops, it could
-*	be higher, but since every SHAKE would have to use the same BT adapter, and I guess
-*	that would eventually cause problems... */
-
-#define MAX_SHAKES		8
-
-static shake_device* devicelist[MAX_SHAKES];
-static PyObject* callbacks[MAX_SHAKES][2];
-static PyObject* audio_callbacks[MAX_SHAKES][4];
-static int devicelist_count = 0;
-
-static int event_callback_active[MAX_SHAKES] = { 0 };
-static int audio_callback_active[MAX_SHAKES] = { 0 };
-
-static void SHAKE_CALLBACK main_callback(shake_device* dev, int ev) {
-	int i;
-    PyObject *result;
-
-	for(i=0;i<devicelist_count;i++) {
-		if(devicelist[i] == dev) {
-			// call python callback in callbacks[i]
-			PyGILState_STATE gstate;
-			gstate = PyGILState_Ensure();
-
-			/* Perform Python actions here.  */
-			result = PyEval_CallFunction(callbacks[i][0], "(Oi)", callbacks[i][1], ev);
-			PyGILState_Release(gstate);
-			
-			Py_XDECREF(result);
-			break;
-		}
-	}
-}
-
-static void unregister_audio_callback(int id) {
-	// if this value is 0 safe to delete immediately, not in a callback
-	if(audio_callback_active[id] == 0 || audio_callback_active[id] == 2) {
-		audio_callbacks[id][1] = NULL;
-		Py_XDECREF(audio_callbacks[id][0]);
-		shake_register_audio_callback(devicelist[id], NULL);
-		// TODO delete list objects??
-		audio_callback_active[id] = 0;
-	} else if (audio_callback_active[id] == 1) {
-		// if value is 1, callback is active - set value to 2 and this function will be called automatically
-		// when the callback returns
-		audio_callback_active[id] = 2;
-	}
-}
-
-static void SHAKE_CALLBACK main_audio_callback(shake_device* dev, short* mic_samples, int mic_len, short* playback_samples, int playback_len) {
-	int i;
-    PyObject *result = NULL;
-
-	//printf("pyshake_audio_callback\n");
-
-	for(i=0;i<devicelist_count;i++) {
-		if(devicelist[i] == dev && audio_callbacks[i][1] != NULL) {
-			int j = 0;
-			PyGILState_STATE gstate;
-			gstate = PyGILState_Ensure();
-			audio_callback_active[i] = 1;
-
-			//printf("pyshake_audio_callback for device %d, %d samples for mic (%d), %d samples for playback (%d)\n", i, mic_len, mic_samples == NULL, playback_len, playback_samples == NULL);
-			
-			if(mic_samples == NULL) {
-				audio_callbacks[i][3] = PyList_New(SHAKE_AUDIO_DATA_LEN);
-				for(j=0;j<playback_len;j++) {
-					PyList_SetItem(audio_callbacks[i][3], j, PyLong_FromLong(playback_samples[j]));
-				}
-				Py_INCREF(audio_callbacks[i][3]);
-
-				Py_INCREF(Py_None);
-				audio_callbacks[i][2] = Py_None; // mic samples
-			} else {
-				audio_callbacks[i][2] = PyList_New(SHAKE_AUDIO_DATA_LEN);
-				for(j=0;j<mic_len;j++) {
-					PyList_SetItem(audio_callbacks[i][2], j, PyLong_FromLong(mic_samples[j]));
-				}
-				Py_INCREF(audio_callbacks[i][2]);
-				//printf("Building list of samples\n");
-
-				Py_INCREF(Py_None);
-				audio_callbacks[i][3] = Py_None; // playback samples
-			}
-			
-			// call python callback in audio_callbacks[i]
-			if(audio_callbacks[i][1] != NULL) {
-				result = PyEval_CallFunction(audio_callbacks[i][0], "(OOO)", audio_callbacks[i][1], audio_callbacks[i][2], audio_callbacks[i][3]);
-				Py_XDECREF(result);
-			}
-			
-			Py_XDECREF(audio_callbacks[i][2]);
-			Py_XDECREF(audio_callbacks[i][3]);
-
-			// if value still == 1, do nothing
-			// if value now == -1, means that callback should be removed immediately as it has been unregistered
-			if(audio_callback_active[i] == 1) {
-				audio_callback_active[i] = 0;
-			} else {
-				unregister_audio_callback(i);
-			}
-			PyGILState_Release(gstate);
-			break;
-		}
-	}
-}
-
-static PyObject* pyshake_cleanup(PyObject* self, PyObject* args) {
-	int i;
-
-	for(i=0;i<MAX_SHAKES;i++) {
-		if(devicelist[i] != NULL)
-			shake_free_device(devicelist[i]);
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-PYSHAKE_EXPORT void initpyshake(void) {
-	PyObject* mod = Py_InitModule("pyshake", pyshake_methods);
-	PyEval_InitThreads();
-	pyshake_ex = PyErr_NewException("pyshake.error", NULL, NULL);
-	Py_INCREF(pyshake_ex);
-	PyModule_AddObject(mod, "PyshakeError", pyshake_ex);
-}
-
-// arguments: a COM port number or a BT addr 
-static PyObject* pyshake_init_device(PyObject* self, PyObject* args) {
-	int com_port, parsedok;
-	char* btaddr;
-	shake_device* dev;
-	int devtype;
-
-	if(devicelist_count >= MAX_SHAKES) {
-		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
-		return Py_BuildValue("i", SHAKE_ERROR);
-	}
-
-	#ifdef _WIN32
-	parsedok = PyArg_ParseTuple(args, "ii", &com_port, &devtype);
-	dev = shake_init_device(com_port, devtype);
-	#endif
-	
-	if(dev == NULL)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	devicelist[devicelist_count] = dev;
-	devicelist_count++;
-
-	return Py_BuildValue("i", devicelist_count - 1);
-}
-
-static PyObject* pyshake_init_device_rfcomm_i64(PyObject* self, PyObject* args) {
-	#ifdef SHAKE_RFCOMM_SUPPORTED
-	shake_device* dev;
-	PY_LONG_LONG btaddr;
-	int devtype;
-
-	if(devicelist_count >= MAX_SHAKES) {
-		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
-		return Py_BuildValue("i", SHAKE_ERROR);
-	}
-
-	// XXX has to be "L" not "l" despite what API docs say
-	PyArg_ParseTuple(args, "Li", &btaddr, &devtype);
-	dev = shake_init_device_rfcomm_i64(btaddr, devtype);
-
-	if(dev == NULL)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	devicelist[devicelist_count] = dev;
-	devicelist_count++;
-
-	return Py_BuildValue("i", devicelist_count - 1);
-
-	#else
-	return Py_BuildValue("i", SHAKE_ERROR);
-	#endif
-}
-
-static PyObject* pyshake_init_device_rfcomm_str(PyObject* self, PyObject* args) {
-	#ifdef SHAKE_RFCOMM_SUPPORTED
-	shake_device* dev;
-	char* btaddr;	
-	int devtype;
-
-	if(devicelist_count >= MAX_SHAKES) {
-		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
-		return Py_BuildValue("i", SHAKE_ERROR);
-	}
-
-	PyArg_ParseTuple(args, "si", &btaddr, &devtype);
-	dev = shake_init_device_rfcomm_str(btaddr, devtype);
-
-	if(dev == NULL)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	devicelist[devicelist_count] = dev;
-	devicelist_count++;
-
-	return Py_BuildValue("i", devicelist_count - 1);
-
-	#else
-	return Py_BuildValue("i", SHAKE_ERROR);
-	#endif
-}
-
-static PyObject* pyshake_init_device_usb(PyObject* self, PyObject* args) {
-#ifndef _WIN32
-	shake_device* dev;
-	char* usb_dev;	
-	int devtype;
-
-	if(devicelist_count >= MAX_SHAKES) {
-		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
-		return Py_BuildValue("i", SHAKE_ERROR);
-	}
-
-	PyArg_ParseTuple(args, "si", &usb_dev, &devtype);
-	dev = shake_init_device_usb_serial(usb_dev, devtype);
-
-	if(dev == NULL)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	devicelist[devicelist_count] = dev;
-	devicelist_count++;
-
-	return Py_BuildValue("i", devicelist_count - 1);
-#else
-	return Py_BuildValue("i", SHAKE_ERROR);
-#endif
-}
-
-static PyObject* pyshake_init_device_debug(PyObject* self, PyObject* args) {
-	shake_device* dev;
-	char* inp, *outp;
-	int devtype;
-
-	if(devicelist_count >= MAX_SHAKES) {
-		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
-		return Py_BuildValue("i", SHAKE_ERROR);
-	}
-
-	PyArg_ParseTuple(args, "ssi", &inp, &outp, &devtype);
-
-	printf("Connecting to: %s | %s\n", inp, outp);
-	dev = shake_init_device_DEBUGFILE(inp, outp, devtype);
-
-	if(dev == NULL)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	devicelist[devicelist_count] = dev;
-	devicelist_count++;
-
-	return Py_BuildValue("i", devicelist_count - 1);
-}
-
-// arguments: 1 int, ID number
-static PyObject* pyshake_free_device(PyObject* self, PyObject* args) {
-	int id, i;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	shake_free_device(devicelist[id]);
-	if(audio_callback_active[id] != 0) {
-		//printf("Waiting on an audio callback!\n");
-		while(audio_callback_active[id] != 0) {
-			shake_sleep(1000);
-			//printf("%d\n", audio_callback_active[id]);
-		}
-	}
-
-
-	devicelist[id] = NULL;
-	for(i=id;i<MAX_SHAKES-1;i++) {
-		devicelist[id] = devicelist[id+1];
-		callbacks[id][0] = callbacks[id+1][0];
-		callbacks[id][1] = callbacks[id+1][1];
-	}
-	devicelist_count--;
-
-	return Py_BuildValue("i", 1);
-}
-
-static PyObject* pyshake_info_firmware_revision(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("d", 0.0);
-
-	return Py_BuildValue("f", shake_info_firmware_revision(devicelist[id]));
-}
-
-static PyObject* pyshake_info_hardware_revision(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("d", 0.0);
-
-	return Py_BuildValue("f", shake_info_hardware_revision(devicelist[id]));
-}
-
-static PyObject* pyshake_info_serial_number(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("s", "");
-
-	return Py_BuildValue("s", shake_info_serial_number(devicelist[id]));
-}
-
-
-static PyObject* pyshake_info_module_slot1(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	return Py_BuildValue("i", shake_info_module_slot1(devicelist[id]));
-}
-
-static PyObject* pyshake_info_module_slot2(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	return Py_BuildValue("i", shake_info_module_slot2(devicelist[id]));
-}
-
-static PyObject* pyshake_info_retrieve(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	printf("pyshake_info_retrieve...\n");
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("s", "");
-
-	return Py_BuildValue("i", shake_info_retrieve(devicelist[id]));
-}
-
-static PyObject* pyshake_factory_reset(PyObject* self, PyObject* args) {
-	int id, repeats;
-
-	PyArg_ParseTuple(args, "ii", &id, &repeats);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	return Py_BuildValue("i", shake_factory_reset(devicelist[id], repeats));
-}
-
-static PyObject* pyshake_wait_for_acks(PyObject* self, PyObject* args) {
-	int id, wait_for_ack;
-
-	PyArg_ParseTuple(args, "ii", &id, &wait_for_ack);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", 0);
-
-	shake_wait_for_acks(devicelist[id], wait_for_ack);
-	return Py_BuildValue("i", 1);
-}
-
-// arguments: 1 int, ID number
-static PyObject* pyshake_accx(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_accx(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-// arguments: 1 int, ID number
-static PyObject* pyshake_accy(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_accy(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-// arguments: 1 int, ID number
-static PyObject* pyshake_accz(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_accz(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-// arguments: 1 int, ID number
-static PyObject* pyshake_acc(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		int xyz[3];
-		PyObject* obj;
-
-		shake_acc(devicelist[id], xyz);
-		obj = Py_BuildValue("[i, i, i]", xyz[0], xyz[1], xyz[2]);
-		return obj;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_gyrx(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_gyrx(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-static PyObject* pyshake_gyry(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_gyry(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_gyrz(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_gyrz(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_gyr(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		int xyz[3];
-		PyObject* obj;
-
-		shake_gyr(devicelist[id], xyz);
-		obj = Py_BuildValue("[i, i, i]", xyz[0], xyz[1], xyz[2]);
-		return obj;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_magx(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_magx(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_magy(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_magy(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_magz(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_magz(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_mag(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		int xyz[3];
-		PyObject* obj;
-
-		shake_mag(devicelist[id], xyz);
-		obj = Py_BuildValue("[i, i, i]", xyz[0], xyz[1], xyz[2]);
-		return obj;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_heading(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_heading(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_sk7_roll_pitch_heading(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		int rph[3];
-		PyObject* obj;
-
-		sk7_roll_pitch_heading(devicelist[id], rph);
-		obj = Py_BuildValue("[i, i, i]", rph[0], rph[1], rph[2]);
-		return obj;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_sk7_roll_pitch_heading_quaternions(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		float rphq[4];
-		PyObject* obj;
-
-		sk7_roll_pitch_heading_quaternions(devicelist[id], rphq);
-		obj = Py_BuildValue("[d, d, d, d]", rphq[0], rphq[1], rphq[2], rphq[3]);
-		return obj;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_sk6_cap0(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", sk6_cap0(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_sk6_cap1(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", sk6_cap1(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_sk6_cap(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		PyObject* obj;
-		int prox[2];
-
-		sk6_cap(devicelist[id], prox);
-		obj = Py_BuildValue("[i, i]", prox[0], prox[1]);
-		return obj;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_sk7_cap(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		PyObject* obj;
-		int prox[12];
-
-		sk7_cap(devicelist[id], prox);
-		obj = Py_BuildValue("[i, i, i, i, i, i, i, i, i, i, i, i]", prox[0], prox[1], prox[2], prox[3], prox[4], prox[5], prox[6], prox[7], prox[8], prox[9], prox[10], prox[11]);
-		return obj;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_sk7_cap_ext(PyObject* self, PyObject* args) {
-	int id, blocks;
-
-	PyArg_ParseTuple(args, "ii", &id, &blocks);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		int prox[24];
-
-		if(sk7_cap_ext(devicelist[id], blocks, prox) == SHAKE_ERROR) {
-			Py_INCREF(Py_None);
-			return Py_None;
-		}
-		PyObject* result = NULL;
-		if(blocks == 0 || blocks == 1) {
-			result = PyList_New(12);
-			//Py_INCREF(result);
-			for(int j=0;j<12;j++) {
-				PyList_SetItem(result, j, PyLong_FromLong(prox[j]));
-			}
-		} else {
-			result = PyList_New(24);
-			//Py_INCREF(result);
-			for(int j=0;j<24;j++) {
-				PyList_SetItem(result, j, PyLong_FromLong(prox[j]));
-			}
-		}
-			
-		return result;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_analog0(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_analog0(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_analog1(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_analog1(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_analog(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		PyObject* obj;
-		int a0a1[2];
-
-		shake_analog(devicelist[id], a0a1);
-		obj = Py_BuildValue("[i, i]", a0a1[0], a0a1[1]);
-		return obj;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_read(PyObject* self, PyObject* args) {
-	int id, reg;
-
-	PyArg_ParseTuple(args, "ii", &id, &reg);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		unsigned char value, ret;
-		PyObject* obj;
-
-		value = 0;
-		ret = shake_read(devicelist[id], reg, &value);
-		obj = Py_BuildValue("[i, i]", ret, value);
-		return obj;
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_write(PyObject* self, PyObject* args) {
-	int id, reg, val;
-
-	PyArg_ParseTuple(args, "iii", &id, &reg, &val);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		short ret;
-
-		ret = shake_write(devicelist[id], reg, val);
-		return Py_BuildValue("i", ret);
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_playvib(PyObject* self, PyObject* args) {
-	int id;
-	int channel, profile;
-
-	PyArg_ParseTuple(args, "iii", &id, &channel, &profile);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		return Py_BuildValue("i", SHAKE_ERROR);
-	}
-
-	if(devicelist[id] != NULL) {
-		return Py_BuildValue("i", shake_playvib(devicelist[id], channel, profile));
-	}
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_sk6_upload_vib_sample(PyObject* self, PyObject* args) {
-	int id;
-	unsigned profile;
-	int sample[64], sample_length;
-	PyObject* list;
-
-	PyArg_ParseTuple(args, "iiO", &id, &profile, &list);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		//Py_INCREF(Py_None);
-		//return Py_None;
-		return Py_BuildValue("i", SHAKE_ERROR);
-	}
-
-	if(devicelist[id] != NULL) {
-		int ret, pos = 0;
-
-		sample_length = PyList_GET_SIZE(list);
-		/* size is already checked in shake.py */
-
-		/* copy each list value into sample array */
-		for(pos = 0; pos < sample_length; pos++) {
-			if(!PyInt_Check(PyList_GET_ITEM(list, pos))) {
-				PyObject* ex = PyExc_TypeError;
-				PyErr_SetString(ex, "Found non-integer argument in list!");
-				return NULL;
-			}
-			sample[pos] = PyInt_AsLong(PyList_GET_ITEM(list, pos));
-		}
-
-		ret = sk6_upload_vib_sample(devicelist[id], profile, sample, sample_length / 2);
-		return Py_BuildValue("i", ret);
-	}
-
-	//Py_INCREF(Py_None);
-	//return Py_None;
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_upload_vib_sample_extended(PyObject* self, PyObject* args) {
-	int id;
-	unsigned profile;
-	int sample[64], sample_length;
-	PyObject* list;
-	int mode, freq, duty;
-
-	PyArg_ParseTuple(args, "iiOiii", &id, &profile, &list, &mode, &freq, &duty);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		//Py_INCREF(Py_None);
-		//return Py_None;
-		return Py_BuildValue("i", SHAKE_ERROR);
-	}
-
-	if(devicelist[id] != NULL) {
-		int ret, pos = 0;
-
-		sample_length = PyList_GET_SIZE(list);
-		/* size is already checked in shake.py */
-
-		/* copy each list value into sample array */
-		for(pos = 0; pos < sample_length; pos++) {
-			if(!PyInt_Check(PyList_GET_ITEM(list, pos))) {
-				PyObject* ex = PyExc_TypeError;
-				PyErr_SetString(ex, "Found non-integer argument in list!");
-				return NULL;
-			}
-			sample[pos] = PyInt_AsLong(PyList_GET_ITEM(list, pos));
-		}
-
-		ret = shake_upload_vib_sample_extended(devicelist[id], profile, sample, sample_length / 2, mode, freq, duty);
-		return Py_BuildValue("i", ret);
-	}
-
-	//Py_INCREF(Py_None);
-	//return Py_None;
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_read_temperature(PyObject* self, PyObject* args) {
-	int id;
-	float val;
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		val = shake_read_temperature(devicelist[id]);
-		return Py_BuildValue("f", val);
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_register_event_callback(PyObject* self, PyObject* args) {
-    PyObject *callback;
-	PyObject *device_object;
-	int id;
-	PyObject *result = NULL;
-
-    if (PyArg_ParseTuple(args, "iOO", &id, &callback, &device_object)) {
-		if(id < 0 || id >= MAX_SHAKES) {
-			Py_INCREF(Py_None);
-			return Py_None;
-		}	
-
-		// if unregistering the callback
-		if(callback == Py_None) {
-			Py_INCREF(Py_None);
-			result = Py_None;
-			shake_register_event_callback(devicelist[id], NULL);
-		} else {
-			// registering a new callback
-			if (PyCallable_Check(callback) == 0) {
-				PyErr_SetString(PyExc_TypeError, "parameter must be callable");
-				Py_INCREF(Py_None);
-				return Py_None;
-			}
-
-			Py_XINCREF(callback);         /* Add a reference to new callback */
-			Py_XDECREF(callbacks[id][0]);  /* Dispose of previous callback */
-			callbacks[id][0] = callback;       /* Remember new callback */
-			callbacks[id][1] = device_object;
-			shake_register_event_callback(devicelist[id], main_callback);
-
-			
-			//main_callback(devicelist[id], 1);
-			//result = PyEval_CallFunction(callbacks[id], "(i)", 3);
-		}
-    }
-	result = Py_BuildValue("i", SHAKE_SUCCESS);
-    return result;
-}
-
-static PyObject* pyshake_logging_play(PyObject* self, PyObject* args) {
-	int id;
-	char* filename;
-
-	PyArg_ParseTuple(args, "is", &id, &filename);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_logging_play(devicelist[id], filename));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_logging_packets_read(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_logging_packets_read(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_shaking_peakaccel(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_shaking_peakaccel(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_shaking_direction(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_shaking_direction(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_shaking_timestamp(PyObject* self, PyObject* args) {
-	int id;
-
-	PyArg_ParseTuple(args, "i", &id);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_shaking_timestamp(devicelist[id]));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_data_timestamp(PyObject* self, PyObject* args) {
-	int id, sensor;
-
-	PyArg_ParseTuple(args, "ii", &id, &sensor);
-
-	if(id < 0 || id >= MAX_SHAKES)
-		return Py_BuildValue("i", SHAKE_ERROR);
-
-	if(devicelist[id] != NULL)
-		return Py_BuildValue("i", shake_data_timestamp(devicelist[id], sensor));
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-// (shake_device* sh, unsigned short address, short* sample_data, unsigned short sample_len);
-
-static PyObject* pyshake_upload_audio_sample(PyObject* self, PyObject* args) {
-	int id;
-	unsigned address;
-	short sample[1056], sample_length;
-	PyObject* list;
-
-	PyArg_ParseTuple(args, "iiO", &id, &address, &list);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		int ret, pos = 0;
-
-		sample_length = PyList_GET_SIZE(list);
-		/* size is already checked in shake.py */
-
-		/* copy each list value into sample array */
-		memset(sample, 0, 1056);
-		for(pos = 0; pos < sample_length; pos++) {
-			if(!PyInt_Check(PyList_GET_ITEM(list, pos))) {
-				PyObject* ex = PyExc_TypeError;
-				PyErr_SetString(ex, "Found non-integer argument in list!");
-				return NULL;
-			}
-			sample[pos] = PyInt_AsLong(PyList_GET_ITEM(list, pos));
-		}
-
-		ret = shake_upload_audio_sample(devicelist[id], address, sample, sample_length / 2);
-		return Py_BuildValue("i", ret);
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_play_audio_sample(PyObject* self, PyObject* args) {
-	int id;
-	unsigned start_addr, end_addr, amplitude;
-
-	PyArg_ParseTuple(args, "iiii", &id, &start_addr, &end_addr, &amplitude);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		int ret = shake_play_audio_sample(devicelist[id], start_addr, end_addr, amplitude);
-		return Py_BuildValue("i", ret);
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_register_audio_callback(PyObject* self, PyObject* args) {
-	PyObject *callback;
-	PyObject *device_object;
-	int id;
-	PyObject *result = NULL;
-
-    if (PyArg_ParseTuple(args, "iOO", &id, &callback, &device_object)) {
-		if(id < 0 || id >= MAX_SHAKES) {
-			Py_INCREF(Py_None);
-			return Py_None;
-		}	
-
-		// if unregistering the callback
-		if(callback == Py_None) {
-			//printf("register_audio_callback : clearing\n");
-			unregister_audio_callback(id);
-		} else {
-			// registering a new callback
-			if (PyCallable_Check(callback) == 0) {
-				PyErr_SetString(PyExc_TypeError, "parameter must be callable");
-				Py_INCREF(Py_None);
-				return Py_None;
-			}
-
-			//printf("Setting audio callback\n");
-
-			Py_XINCREF(callback);         /* Add a reference to new callback */
-			Py_XDECREF(audio_callbacks[id][0]);  /* Dispose of previous callback */
-			audio_callbacks[id][0] = callback;       /* Remember new callback */
-			audio_callbacks[id][1] = device_object;
-			audio_callbacks[id][2] = NULL; //PyList_New(SHAKE_AUDIO_DATA_LEN);
-			audio_callbacks[id][3] = NULL; //PyList_New(SHAKE_AUDIO_DATA_LEN);
-			shake_register_audio_callback(devicelist[id], main_audio_callback);
-			
-		}
-    }
-	result = Py_BuildValue("i", SHAKE_SUCCESS);
-    return result;
-}
-
-static PyObject* pyshake_heart_rate(PyObject* self, PyObject* args) {
-	PyObject *callback;
-	PyObject *device_object;
-	int id;
-	PyObject *result = NULL;
-
-    if (PyArg_ParseTuple(args, "i", &id)) {
-		if(id < 0 || id >= MAX_SHAKES) {
-			Py_INCREF(Py_None);
-			return Py_None;
-		}	
-
-		return Py_BuildValue("i", shake_heart_rate(devicelist[id]));
-	}
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
-
-static PyObject* pyshake_exp_upload_vib_sample(PyObject* self, PyObject* args) {
-	int id;
-	unsigned address;
-	unsigned char sample[1056];
-	unsigned sample_length;
-	PyObject* list;
-
-	PyArg_ParseTuple(args, "iiO", &id, &address, &list);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		int ret, pos = 0;
-
-		sample_length = PyList_GET_SIZE(list);
-		/* size is already checked in shake.py */
-
-		/* copy each list value into sample array */
-		memset(sample, 0, 1056);
-		for(pos = 0; pos < sample_length; pos++) {
-			if(!PyInt_Check(PyList_GET_ITEM(list, pos))) {
-				PyObject* ex = PyExc_TypeError;
-				PyErr_SetString(ex, "Found non-integer argument in list!");
-				return NULL;
-			}
-			sample[pos] = PyInt_AsLong(PyList_GET_ITEM(list, pos));
-		}
-
-		ret = shake_exp_upload_vib_sample(devicelist[id], address, (char*)sample, sample_length);
-		return Py_BuildValue("i", ret);
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_exp_play_vib_sample(PyObject* self, PyObject* args) {
-	int id;
-	unsigned start_addr, end_addr, amplitude;
-
-	PyArg_ParseTuple(args, "iiii", &id, &start_addr, &end_addr, &amplitude);
-
-	if(id < 0 || id >= MAX_SHAKES) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	if(devicelist[id] != NULL) {
-		int ret = shake_exp_play_vib_sample(devicelist[id], start_addr, end_addr, amplitude);
-		return Py_BuildValue("i", ret);
-	}
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject* pyshake_rfid_tid(PyObject* self, PyObject* args) {
-	int id;
-
-    if (PyArg_ParseTuple(args, "i", &id)) {
-		if(id < 0 || id >= MAX_SHAKES) {
-			Py_INCREF(Py_None);
-			return Py_None;
-		}	
-
-		return Py_BuildValue("s", shake_rfid_tid(devicelist[id]));
-	}
-
-	return Py_BuildValue("s", "");
-}
-
-static PyObject* pyshake_rfid_scan(PyObject* self, PyObject* args) {
-	int id;
-
-    if (PyArg_ParseTuple(args, "i", &id)) {
-		if(id < 0 || id >= MAX_SHAKES) {
-			Py_INCREF(Py_None);
-			return Py_None;
-		}	
-
-		return Py_BuildValue("i", shake_rfid_scan(devicelist[id]));
-	}
-
-	return Py_BuildValue("i", SHAKE_ERROR);
-}
+#undef _DEBUG /* Link with python24.lib and not python24_d.lib */
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <mmsystem.h>
+#else
+#include <stdlib.h>
+#endif
+
+#include "shake_driver.h"
+#include "shake_btdefs.h"
+
+#ifdef _WIN32
+#include "Python.h"
+#else
+#include <Python.h>
+#endif
+#include "pyshake.h"
+
+static PyObject* pyshake_ex;
+
+/*	Maximum number of SHAKES to allow on a single host device. For PocketPCs this
+*	is limited to 1 by the OS as far as I can tell. For Windows PCs/laptops, it could
+*	be higher, but since every SHAKE would have to use the same BT adapter, and I guess
+*	that would eventually cause problems... */
+
+#define MAX_SHAKES		8
+
+static shake_device* devicelist[MAX_SHAKES];
+static PyObject* callbacks[MAX_SHAKES][2];
+static PyObject* audio_callbacks[MAX_SHAKES][4];
+static int devicelist_count = 0;
+
+static int event_callback_active[MAX_SHAKES] = { 0 };
+static int audio_callback_active[MAX_SHAKES] = { 0 };
+
+static void SHAKE_CALLBACK main_callback(shake_device* dev, int ev) {
+	int i;
+    PyObject *result;
+
+	for(i=0;i<devicelist_count;i++) {
+		if(devicelist[i] == dev) {
+			// call python callback in callbacks[i]
+			PyGILState_STATE gstate;
+			gstate = PyGILState_Ensure();
+
+			/* Perform Python actions here.  */
+			result = PyEval_CallFunction(callbacks[i][0], "(Oi)", callbacks[i][1], ev);
+			PyGILState_Release(gstate);
+			
+			Py_XDECREF(result);
+			break;
+		}
+	}
+}
+
+static void unregister_audio_callback(int id) {
+	// if this value is 0 safe to delete immediately, not in a callback
+	if(audio_callback_active[id] == 0 || audio_callback_active[id] == 2) {
+		audio_callbacks[id][1] = NULL;
+		Py_XDECREF(audio_callbacks[id][0]);
+		shake_register_audio_callback(devicelist[id], NULL);
+		// TODO delete list objects??
+		audio_callback_active[id] = 0;
+	} else if (audio_callback_active[id] == 1) {
+		// if value is 1, callback is active - set value to 2 and this function will be called automatically
+		// when the callback returns
+		audio_callback_active[id] = 2;
+	}
+}
+
+static void SHAKE_CALLBACK main_audio_callback(shake_device* dev, short* mic_samples, int mic_len, short* playback_samples, int playback_len) {
+	int i;
+    PyObject *result = NULL;
+
+	//printf("pyshake_audio_callback\n");
+
+	for(i=0;i<devicelist_count;i++) {
+		if(devicelist[i] == dev && audio_callbacks[i][1] != NULL) {
+			int j = 0;
+			PyGILState_STATE gstate;
+			gstate = PyGILState_Ensure();
+			audio_callback_active[i] = 1;
+
+			//printf("pyshake_audio_callback for device %d, %d samples for mic (%d), %d samples for playback (%d)\n", i, mic_len, mic_samples == NULL, playback_len, playback_samples == NULL);
+			
+			if(mic_samples == NULL) {
+				audio_callbacks[i][3] = PyList_New(SHAKE_AUDIO_DATA_LEN);
+				for(j=0;j<playback_len;j++) {
+					PyList_SetItem(audio_callbacks[i][3], j, PyLong_FromLong(playback_samples[j]));
+				}
+				Py_INCREF(audio_callbacks[i][3]);
+
+				Py_INCREF(Py_None);
+				audio_callbacks[i][2] = Py_None; // mic samples
+			} else {
+				audio_callbacks[i][2] = PyList_New(SHAKE_AUDIO_DATA_LEN);
+				for(j=0;j<mic_len;j++) {
+					PyList_SetItem(audio_callbacks[i][2], j, PyLong_FromLong(mic_samples[j]));
+				}
+				Py_INCREF(audio_callbacks[i][2]);
+				//printf("Building list of samples\n");
+
+				Py_INCREF(Py_None);
+				audio_callbacks[i][3] = Py_None; // playback samples
+			}
+			
+			// call python callback in audio_callbacks[i]
+			if(audio_callbacks[i][1] != NULL) {
+				result = PyEval_CallFunction(audio_callbacks[i][0], "(OOO)", audio_callbacks[i][1], audio_callbacks[i][2], audio_callbacks[i][3]);
+				Py_XDECREF(result);
+			}
+			
+			Py_XDECREF(audio_callbacks[i][2]);
+			Py_XDECREF(audio_callbacks[i][3]);
+
+			// if value still == 1, do nothing
+			// if value now == -1, means that callback should be removed immediately as it has been unregistered
+			if(audio_callback_active[i] == 1) {
+				audio_callback_active[i] = 0;
+			} else {
+				unregister_audio_callback(i);
+			}
+			PyGILState_Release(gstate);
+			break;
+		}
+	}
+}
+
+static PyObject* pyshake_cleanup(PyObject* self, PyObject* args) {
+	int i;
+
+	for(i=0;i<MAX_SHAKES;i++) {
+		if(devicelist[i] != NULL)
+			shake_free_device(devicelist[i]);
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+PYSHAKE_EXPORT void initpyshake(void) {
+	PyObject* mod = Py_InitModule("pyshake", pyshake_methods);
+	PyEval_InitThreads();
+	pyshake_ex = PyErr_NewException("pyshake.error", NULL, NULL);
+	Py_INCREF(pyshake_ex);
+	PyModule_AddObject(mod, "PyshakeError", pyshake_ex);
+}
+
+// arguments: a COM port number or a BT addr 
+static PyObject* pyshake_init_device(PyObject* self, PyObject* args) {
+	int com_port, parsedok;
+	char* btaddr;
+	shake_device* dev;
+	int devtype;
+
+	if(devicelist_count >= MAX_SHAKES) {
+		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
+		return Py_BuildValue("i", SHAKE_ERROR);
+	}
+
+	#ifdef _WIN32
+	parsedok = PyArg_ParseTuple(args, "ii", &com_port, &devtype);
+	dev = shake_init_device(com_port, devtype);
+	#endif
+	
+	if(dev == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	devicelist[devicelist_count] = dev;
+	devicelist_count++;
+
+	return Py_BuildValue("i", devicelist_count - 1);
+}
+
+static PyObject* pyshake_init_device_rfcomm_i64(PyObject* self, PyObject* args) {
+	#ifdef SHAKE_RFCOMM_SUPPORTED
+	shake_device* dev;
+	PY_LONG_LONG btaddr;
+	int devtype;
+
+	if(devicelist_count >= MAX_SHAKES) {
+		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
+		return Py_BuildValue("i", SHAKE_ERROR);
+	}
+
+	// XXX has to be "L" not "l" despite what API docs say
+	PyArg_ParseTuple(args, "Li", &btaddr, &devtype);
+	dev = shake_init_device_rfcomm_i64(btaddr, devtype);
+
+	if(dev == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	devicelist[devicelist_count] = dev;
+	devicelist_count++;
+
+	return Py_BuildValue("i", devicelist_count - 1);
+
+	#else
+	return Py_BuildValue("i", SHAKE_ERROR);
+	#endif
+}
+
+static PyObject* pyshake_init_device_rfcomm_str(PyObject* self, PyObject* args) {
+	#ifdef SHAKE_RFCOMM_SUPPORTED
+	shake_device* dev;
+	char* btaddr;	
+	int devtype;
+
+	if(devicelist_count >= MAX_SHAKES) {
+		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
+		return Py_BuildValue("i", SHAKE_ERROR);
+	}
+
+	PyArg_ParseTuple(args, "si", &btaddr, &devtype);
+	dev = shake_init_device_rfcomm_str(btaddr, devtype);
+
+	if(dev == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	devicelist[devicelist_count] = dev;
+	devicelist_count++;
+
+	return Py_BuildValue("i", devicelist_count - 1);
+
+	#else
+	return Py_BuildValue("i", SHAKE_ERROR);
+	#endif
+}
+
+static PyObject* pyshake_init_device_usb(PyObject* self, PyObject* args) {
+#ifndef _WIN32
+	shake_device* dev;
+	char* usb_dev;	
+	int devtype;
+
+	if(devicelist_count >= MAX_SHAKES) {
+		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
+		return Py_BuildValue("i", SHAKE_ERROR);
+	}
+
+	PyArg_ParseTuple(args, "si", &usb_dev, &devtype);
+	dev = shake_init_device_usb_serial(usb_dev, devtype);
+
+	if(dev == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	devicelist[devicelist_count] = dev;
+	devicelist_count++;
+
+	return Py_BuildValue("i", devicelist_count - 1);
+#else
+	return Py_BuildValue("i", SHAKE_ERROR);
+#endif
+}
+
+static PyObject* pyshake_init_device_debug(PyObject* self, PyObject* args) {
+	shake_device* dev;
+	char* inp, *outp;
+	int devtype;
+
+	if(devicelist_count >= MAX_SHAKES) {
+		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
+		return Py_BuildValue("i", SHAKE_ERROR);
+	}
+
+	PyArg_ParseTuple(args, "ssi", &inp, &outp, &devtype);
+
+	printf("Connecting to: %s | %s\n", inp, outp);
+	dev = shake_init_device_DEBUGFILE(inp, outp, devtype);
+
+	if(dev == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	devicelist[devicelist_count] = dev;
+	devicelist_count++;
+
+	return Py_BuildValue("i", devicelist_count - 1);
+}
+
+// arguments: filename, device type, replay mode, speed
+static PyObject* pyshake_init_device_replay(PyObject* self, PyObject* args) {
+	shake_device* dev;
+	char* inp;
+	int devtype, mode;
+	float speed;
+
+	if(devicelist_count >= MAX_SHAKES) {
+		PyRun_SimpleString("print 'Maximum number of SHAKES reached!'");
+		return Py_BuildValue("i", SHAKE_ERROR);
+	}
+
+	PyArg_ParseTuple(args, "siif", &inp, &devtype, &mode, &speed);
+	dev = shake_init_device_replay(inp, devtype, mode, speed);
+
+	if(dev == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	devicelist[devicelist_count] = dev;
+	devicelist_count++;
+
+	return Py_BuildValue("i", devicelist_count - 1);
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_replay_complete(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_replay_complete(devicelist[id]));
+}
+
+// arguments: 1 int, ID number; 1 string, capture filename
+static PyObject* pyshake_capture_start(PyObject* self, PyObject* args) {
+	int id;
+	char* filename;
+
+	PyArg_ParseTuple(args, "is", &id, &filename);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_capture_start(devicelist[id], filename));
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_capture_stop(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_capture_stop(devicelist[id]));
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_free_device(PyObject* self, PyObject* args) {
+	int id, i;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	shake_free_device(devicelist[id]);
+	if(audio_callback_active[id] != 0) {
+		//printf("Waiting on an audio callback!\n");
+		while(audio_callback_active[id] != 0) {
+			shake_sleep(1000);
+			//printf("%d\n", audio_callback_active[id]);
+		}
+	}
+
+
+	devicelist[id] = NULL;
+	for(i=id;i<MAX_SHAKES-1;i++) {
+		devicelist[id] = devicelist[id+1];
+		callbacks[id][0] = callbacks[id+1][0];
+		callbacks[id][1] = callbacks[id+1][1];
+	}
+	devicelist_count--;
+
+	return Py_BuildValue("i", 1);
+}
+
+static PyObject* pyshake_info_firmware_revision(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("d", 0.0);
+
+	return Py_BuildValue("f", shake_info_firmware_revision(devicelist[id]));
+}
+
+static PyObject* pyshake_info_hardware_revision(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("d", 0.0);
+
+	return Py_BuildValue("f", shake_info_hardware_revision(devicelist[id]));
+}
+
+static PyObject* pyshake_info_serial_number(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("s", "");
+
+	return Py_BuildValue("s", shake_info_serial_number(devicelist[id]));
+}
+
+
+static PyObject* pyshake_info_module_slot1(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_info_module_slot1(devicelist[id]));
+}
+
+static PyObject* pyshake_info_module_slot2(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_info_module_slot2(devicelist[id]));
+}
+
+static PyObject* pyshake_info_retrieve(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	printf("pyshake_info_retrieve...\n");
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("s", "");
+
+	return Py_BuildValue("i", shake_info_retrieve(devicelist[id]));
+}
+
+static PyObject* pyshake_factory_reset(PyObject* self, PyObject* args) {
+	int id, repeats;
+
+	PyArg_ParseTuple(args, "ii", &id, &repeats);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_factory_reset(devicelist[id], repeats));
+}
+
+static PyObject* pyshake_wait_for_acks(PyObject* self, PyObject* args) {
+	int id, wait_for_ack;
+
+	PyArg_ParseTuple(args, "ii", &id, &wait_for_ack);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", 0);
+
+	shake_wait_for_acks(devicelist[id], wait_for_ack);
+	return Py_BuildValue("i", 1);
+}
+
+// arguments: 1 int, ID number; 1 int, number of commands
+static PyObject* pyshake_set_command_window(PyObject* self, PyObject* args) {
+	int id, window;
+
+	PyArg_ParseTuple(args, "ii", &id, &window);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_set_command_window(devicelist[id], window));
+}
+
+// arguments: 1 int, ID number; 1 int, nonzero to enable
+static PyObject* pyshake_enable_register_shadow(PyObject* self, PyObject* args) {
+	int id, enabled;
+
+	PyArg_ParseTuple(args, "ii", &id, &enabled);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_enable_register_shadow(devicelist[id], enabled));
+}
+
+// arguments: 1 int, ID number; 1 int, register address or SHAKE_SHADOW_ALL
+static PyObject* pyshake_invalidate_register_shadow(PyObject* self, PyObject* args) {
+	int id, addr;
+
+	PyArg_ParseTuple(args, "ii", &id, &addr);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_invalidate_register_shadow(devicelist[id], addr));
+}
+
+// arguments: 1 int, ID number. Returns [hits, misses]
+static PyObject* pyshake_register_shadow_stats(PyObject* self, PyObject* args) {
+	int id;
+	shake_stats stats;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL || shake_get_stats(devicelist[id], &stats) != SHAKE_SUCCESS) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	return Py_BuildValue("[i, i]", stats.register_shadow_hits, stats.register_shadow_misses);
+}
+
+// arguments: 1 int, ID number; 1 int, one of the SHAKE_DISPATCH_ modes
+static PyObject* pyshake_set_event_dispatch(PyObject* self, PyObject* args) {
+	int id, mode;
+
+	PyArg_ParseTuple(args, "ii", &id, &mode);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_set_event_dispatch(devicelist[id], mode));
+}
+
+// arguments: 1 int, number of threads
+static PyObject* pyshake_event_pool_start(PyObject* self, PyObject* args) {
+	int num_threads;
+
+	PyArg_ParseTuple(args, "i", &num_threads);
+
+	return Py_BuildValue("i", shake_event_pool_start(num_threads));
+}
+
+// arguments: none
+static PyObject* pyshake_event_pool_stop(PyObject* self, PyObject* args) {
+	int ret;
+
+	// the pool threads may be waiting for the GIL to make a callback
+	Py_BEGIN_ALLOW_THREADS
+	ret = shake_event_pool_stop();
+	Py_END_ALLOW_THREADS
+	return Py_BuildValue("i", ret);
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_accx(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_accx(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_accy(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_accy(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_accz(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_accz(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_acc(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		int xyz[3];
+		PyObject* obj;
+
+		shake_acc(devicelist[id], xyz);
+		obj = Py_BuildValue("[i, i, i]", xyz[0], xyz[1], xyz[2]);
+		return obj;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_gyrx(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_gyrx(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+static PyObject* pyshake_gyry(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_gyry(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_gyrz(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_gyrz(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_gyr(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		int xyz[3];
+		PyObject* obj;
+
+		shake_gyr(devicelist[id], xyz);
+		obj = Py_BuildValue("[i, i, i]", xyz[0], xyz[1], xyz[2]);
+		return obj;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_magx(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_magx(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_magy(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_magy(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_magz(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_magz(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_mag(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		int xyz[3];
+		PyObject* obj;
+
+		shake_mag(devicelist[id], xyz);
+		obj = Py_BuildValue("[i, i, i]", xyz[0], xyz[1], xyz[2]);
+		return obj;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_heading(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_heading(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_sk7_roll_pitch_heading(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		int rph[3];
+		PyObject* obj;
+
+		sk7_roll_pitch_heading(devicelist[id], rph);
+		obj = Py_BuildValue("[i, i, i]", rph[0], rph[1], rph[2]);
+		return obj;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_sk7_roll_pitch_heading_quaternions(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		float rphq[4];
+		PyObject* obj;
+
+		sk7_roll_pitch_heading_quaternions(devicelist[id], rphq);
+		obj = Py_BuildValue("[d, d, d, d]", rphq[0], rphq[1], rphq[2], rphq[3]);
+		return obj;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_parse_decimal_fields(PyObject* self, PyObject* args) {
+	char* text;
+	int len, count, i;
+
+	if(!PyArg_ParseTuple(args, "s#i", &text, &len, &count) || count < 0 || count > 16) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	float values[16];
+	PyObject* obj;
+	
+	count = shake_parse_decimal_fields(text, len, values, count);
+	obj = PyList_New(count);
+	for(i=0;i<count;i++)
+		PyList_SetItem(obj, i, Py_BuildValue("d", values[i]));
+	return obj;
+}
+
+static PyObject* pyshake_sk6_cap0(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", sk6_cap0(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_sk6_cap1(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", sk6_cap1(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_sk6_cap(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		PyObject* obj;
+		int prox[2];
+
+		sk6_cap(devicelist[id], prox);
+		obj = Py_BuildValue("[i, i]", prox[0], prox[1]);
+		return obj;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_sk7_cap(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		PyObject* obj;
+		int prox[12];
+
+		sk7_cap(devicelist[id], prox);
+		obj = Py_BuildValue("[i, i, i, i, i, i, i, i, i, i, i, i]", prox[0], prox[1], prox[2], prox[3], prox[4], prox[5], prox[6], prox[7], prox[8], prox[9], prox[10], prox[11]);
+		return obj;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_sk7_cap_ext(PyObject* self, PyObject* args) {
+	int id, blocks;
+
+	PyArg_ParseTuple(args, "ii", &id, &blocks);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		int prox[24];
+
+		if(sk7_cap_ext(devicelist[id], blocks, prox) == SHAKE_ERROR) {
+			Py_INCREF(Py_None);
+			return Py_None;
+		}
+		PyObject* result = NULL;
+		if(blocks == 0 || blocks == 1) {
+			result = PyList_New(12);
+			//Py_INCREF(result);
+			for(int j=0;j<12;j++) {
+				PyList_SetItem(result, j, PyLong_FromLong(prox[j]));
+			}
+		} else {
+			result = PyList_New(24);
+			//Py_INCREF(result);
+			for(int j=0;j<24;j++) {
+				PyList_SetItem(result, j, PyLong_FromLong(prox[j]));
+			}
+		}
+			
+		return result;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_analog0(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_analog0(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_analog1(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_analog1(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_analog(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		PyObject* obj;
+		int a0a1[2];
+
+		shake_analog(devicelist[id], a0a1);
+		obj = Py_BuildValue("[i, i]", a0a1[0], a0a1[1]);
+		return obj;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_read(PyObject* self, PyObject* args) {
+	int id, reg;
+
+	PyArg_ParseTuple(args, "ii", &id, &reg);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		unsigned char value, ret;
+		PyObject* obj;
+
+		value = 0;
+		ret = shake_read(devicelist[id], reg, &value);
+		obj = Py_BuildValue("[i, i]", ret, value);
+		return obj;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_write(PyObject* self, PyObject* args) {
+	int id, reg, val;
+
+	PyArg_ParseTuple(args, "iii", &id, &reg, &val);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		short ret;
+
+		ret = shake_write(devicelist[id], reg, val);
+		return Py_BuildValue("i", ret);
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+/*	fills <entries> from a list whose items are either a register address or an (address, value[, status])
+*	tuple. Returns the number of entries, or -1 if the list is invalid */
+static int pyshake_parse_entries(PyObject* list, shake_register_entry** entries) {
+	int i, count;
+	PyObject* item;
+
+	if(!PySequence_Check(list) || (count = PySequence_Size(list)) < 0)
+		return -1;
+
+	*entries = (shake_register_entry*)malloc(sizeof(shake_register_entry) * (count > 0 ? count : 1));
+	for(i=0;i<count;i++) {
+		int addr, value = 0, status = SHAKE_COMMAND_ACK;
+
+		item = PySequence_GetItem(list, i);
+		if(PyInt_Check(item)) {
+			addr = PyInt_AsLong(item);
+		} else if(!PyArg_ParseTuple(item, "i|ii", &addr, &value, &status)) {
+			Py_DECREF(item);
+			free(*entries);
+			return -1;
+		}
+		Py_DECREF(item);
+
+		(*entries)[i].address = addr;
+		(*entries)[i].value = (unsigned char)value;
+		(*entries)[i].status = status;
+	}
+	return count;
+}
+
+// returns [result, [(address, value, status), ...]]
+static PyObject* pyshake_build_entries(int ret, shake_register_entry* entries, int count) {
+	PyObject* obj;
+	int i;
+
+	obj = PyList_New(count);
+	for(i=0;i<count;i++)
+		PyList_SetItem(obj, i, Py_BuildValue("(i, i, i)", entries[i].address, entries[i].value, entries[i].status));
+	return Py_BuildValue("[i, N]", ret, obj);
+}
+
+/*	arguments: 1 int, ID number; 1 list of registers; 1 int, nonzero to write. Also used for
+*	restoring a snapshot, when <write> is 2 */
+static PyObject* pyshake_batch(PyObject* args, int write) {
+	int id, count, ret;
+	PyObject* list;
+	shake_register_entry* entries;
+
+	if(!PyArg_ParseTuple(args, "iO", &id, &list)) {
+		PyErr_Clear();
+		return Py_BuildValue("[i, []]", SHAKE_ERROR);
+	}
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL || (count = pyshake_parse_entries(list, &entries)) < 0) {
+		PyErr_Clear();
+		return Py_BuildValue("[i, []]", SHAKE_ERROR);
+	}
+
+	if(write == 2)
+		ret = shake_nv_restore(devicelist[id], entries, count);
+	else if(write)
+		ret = shake_write_batch(devicelist[id], entries, count);
+	else
+		ret = shake_read_batch(devicelist[id], entries, count);
+
+	PyObject* obj = pyshake_build_entries(ret, entries, count);
+	free(entries);
+	return obj;
+}
+
+// arguments: 1 int, ID number; 1 list of (address, value) tuples
+static PyObject* pyshake_write_batch(PyObject* self, PyObject* args) {
+	return pyshake_batch(args, 1);
+}
+
+// arguments: 1 int, ID number; 1 list of addresses
+static PyObject* pyshake_read_batch(PyObject* self, PyObject* args) {
+	return pyshake_batch(args, 0);
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_nv_snapshot(PyObject* self, PyObject* args) {
+	int id, count = 0, ret;
+	shake_register_entry entries[SHAKE_NV_SNAPSHOT_MAX];
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("[i, []]", SHAKE_ERROR);
+
+	ret = shake_nv_snapshot(devicelist[id], entries, SHAKE_NV_SNAPSHOT_MAX, &count);
+	return pyshake_build_entries(ret, entries, count);
+}
+
+// arguments: 1 int, ID number; 1 list of (address, value, status) tuples from nv_snapshot
+static PyObject* pyshake_nv_restore(PyObject* self, PyObject* args) {
+	return pyshake_batch(args, 2);
+}
+
+static PyObject* pyshake_playvib(PyObject* self, PyObject* args) {
+	int id;
+	int channel, profile;
+
+	PyArg_ParseTuple(args, "iii", &id, &channel, &profile);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		return Py_BuildValue("i", SHAKE_ERROR);
+	}
+
+	if(devicelist[id] != NULL) {
+		return Py_BuildValue("i", shake_playvib(devicelist[id], channel, profile));
+	}
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_sk6_upload_vib_sample(PyObject* self, PyObject* args) {
+	int id;
+	unsigned profile;
+	int sample[64], sample_length;
+	PyObject* list;
+
+	PyArg_ParseTuple(args, "iiO", &id, &profile, &list);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		//Py_INCREF(Py_None);
+		//return Py_None;
+		return Py_BuildValue("i", SHAKE_ERROR);
+	}
+
+	if(devicelist[id] != NULL) {
+		int ret, pos = 0;
+
+		sample_length = PyList_GET_SIZE(list);
+		/* size is already checked in shake.py */
+
+		/* copy each list value into sample array */
+		for(pos = 0; pos < sample_length; pos++) {
+			if(!PyInt_Check(PyList_GET_ITEM(list, pos))) {
+				PyObject* ex = PyExc_TypeError;
+				PyErr_SetString(ex, "Found non-integer argument in list!");
+				return NULL;
+			}
+			sample[pos] = PyInt_AsLong(PyList_GET_ITEM(list, pos));
+		}
+
+		ret = sk6_upload_vib_sample(devicelist[id], profile, sample, sample_length / 2);
+		return Py_BuildValue("i", ret);
+	}
+
+	//Py_INCREF(Py_None);
+	//return Py_None;
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_upload_vib_sample_extended(PyObject* self, PyObject* args) {
+	int id;
+	unsigned profile;
+	int sample[64], sample_length;
+	PyObject* list;
+	int mode, freq, duty;
+
+	PyArg_ParseTuple(args, "iiOiii", &id, &profile, &list, &mode, &freq, &duty);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		//Py_INCREF(Py_None);
+		//return Py_None;
+		return Py_BuildValue("i", SHAKE_ERROR);
+	}
+
+	if(devicelist[id] != NULL) {
+		int ret, pos = 0;
+
+		sample_length = PyList_GET_SIZE(list);
+		/* size is already checked in shake.py */
+
+		/* copy each list value into sample array */
+		for(pos = 0; pos < sample_length; pos++) {
+			if(!PyInt_Check(PyList_GET_ITEM(list, pos))) {
+				PyObject* ex = PyExc_TypeError;
+				PyErr_SetString(ex, "Found non-integer argument in list!");
+				return NULL;
+			}
+			sample[pos] = PyInt_AsLong(PyList_GET_ITEM(list, pos));
+		}
+
+		ret = shake_upload_vib_sample_extended(devicelist[id], profile, sample, sample_length / 2, mode, freq, duty);
+		return Py_BuildValue("i", ret);
+	}
+
+	//Py_INCREF(Py_None);
+	//return Py_None;
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_read_temperature(PyObject* self, PyObject* args) {
+	int id;
+	float val;
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		val = shake_read_temperature(devicelist[id]);
+		return Py_BuildValue("f", val);
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_register_event_callback(PyObject* self, PyObject* args) {
+    PyObject *callback;
+	PyObject *device_object;
+	int id;
+	PyObject *result = NULL;
+
+    if (PyArg_ParseTuple(args, "iOO", &id, &callback, &device_object)) {
+		if(id < 0 || id >= MAX_SHAKES) {
+			Py_INCREF(Py_None);
+			return Py_None;
+		}	
+
+		// if unregistering the callback
+		if(callback == Py_None) {
+			Py_INCREF(Py_None);
+			result = Py_None;
+			shake_register_event_callback(devicelist[id], NULL);
+		} else {
+			// registering a new callback
+			if (PyCallable_Check(callback) == 0) {
+				PyErr_SetString(PyExc_TypeError, "parameter must be callable");
+				Py_INCREF(Py_None);
+				return Py_None;
+			}
+
+			Py_XINCREF(callback);         /* Add a reference to new callback */
+			Py_XDECREF(callbacks[id][0]);  /* Dispose of previous callback */
+			callbacks[id][0] = callback;       /* Remember new callback */
+			callbacks[id][1] = device_object;
+			shake_register_event_callback(devicelist[id], main_callback);
+
+			
+			//main_callback(devicelist[id], 1);
+			//result = PyEval_CallFunction(callbacks[id], "(i)", 3);
+		}
+    }
+	result = Py_BuildValue("i", SHAKE_SUCCESS);
+    return result;
+}
+
+static PyObject* pyshake_logging_play(PyObject* self, PyObject* args) {
+	int id;
+	char* filename;
+
+	PyArg_ParseTuple(args, "is", &id, &filename);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_logging_play(devicelist[id], filename));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_logging_packets_read(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_logging_packets_read(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_shaking_peakaccel(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_shaking_peakaccel(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_shaking_direction(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_shaking_direction(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_shaking_timestamp(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_shaking_timestamp(devicelist[id]));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_data_timestamp(PyObject* self, PyObject* args) {
+	int id, sensor;
+
+	PyArg_ParseTuple(args, "ii", &id, &sensor);
+
+	if(id < 0 || id >= MAX_SHAKES)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	if(devicelist[id] != NULL)
+		return Py_BuildValue("i", shake_data_timestamp(devicelist[id], sensor));
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+// arguments: 3 ints, ID number, sensor mask, timeout in ms
+static PyObject* pyshake_wait_sample(PyObject* self, PyObject* args) {
+	int id, sensor_mask, timeout_ms, ret;
+
+	PyArg_ParseTuple(args, "iii", &id, &sensor_mask, &timeout_ms);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	// let other Python threads run while this one is blocked
+	Py_BEGIN_ALLOW_THREADS
+	ret = shake_wait_sample(devicelist[id], sensor_mask, timeout_ms);
+	Py_END_ALLOW_THREADS
+
+	return Py_BuildValue("i", ret);
+}
+
+// arguments: 2 ints, ID number, sensor
+static PyObject* pyshake_get_stream_stats(PyObject* self, PyObject* args) {
+	int id, sensor;
+	shake_stream_stats stats;
+
+	PyArg_ParseTuple(args, "ii", &id, &sensor);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL || shake_get_stream_stats(devicelist[id], sensor, &stats) == SHAKE_ERROR) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	return Py_BuildValue("[I, I, I, I]", stats.received, stats.missing, stats.duplicated, stats.out_of_order);
+}
+
+// arguments: 2 ints, ID number, sensor
+static PyObject* pyshake_reset_stream_stats(PyObject* self, PyObject* args) {
+	int id, sensor;
+
+	PyArg_ParseTuple(args, "ii", &id, &sensor);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_reset_stream_stats(devicelist[id], sensor));
+}
+
+// builds a python list from an array of counters
+static PyObject* pyshake_counter_list(unsigned int* counters, int count) {
+	PyObject* list = PyList_New(count);
+	int i;
+
+	for(i=0;i<count;i++)
+		PyList_SET_ITEM(list, i, PyLong_FromUnsignedLong(counters[i]));
+	return list;
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_get_stats(PyObject* self, PyObject* args) {
+	int id;
+	shake_stats stats;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL || shake_get_stats(devicelist[id], &stats) == SHAKE_ERROR) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	// "N" hands the new lists over to the dictionary
+	return Py_BuildValue("{s:d,s:d,s:L,s:N,s:I,s:I,s:I,s:N,s:N,s:d,s:d,s:d,s:I}",
+		"elapsed", stats.elapsed, 
+		"bytes_per_sec", stats.bytes_per_sec, 
+		"bytes_received", stats.bytes_received,
+		"packets", pyshake_counter_list(stats.packets, SHAKE_STATS_PACKET_TYPES),
+		"resyncs", stats.resyncs,
+		"resync_bytes_discarded", stats.resync_bytes_discarded,
+		"checksum_failures", stats.checksum_failures,
+		"ack_latency", pyshake_counter_list(stats.ack_latency, SHAKE_STATS_LATENCY_BINS),
+		"callback_latency", pyshake_counter_list(stats.callback_latency, SHAKE_STATS_LATENCY_BINS),
+		"io_wait_time", stats.io_wait_time,
+		"framing_time", stats.framing_time,
+		"decoding_time", stats.decoding_time,
+		"events_dropped", stats.events_dropped);
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_reset_stats(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_reset_stats(devicelist[id]));
+}
+
+/* passes the progress of an upload to the Python function given to upload_audio_sample or exp_upload_vib_sample */
+static void SHAKE_CALLBACK upload_callback(shake_device* dev, const shake_upload_stats* progress, void* user) {
+	PyObject* result;
+	PyGILState_STATE gstate;
+
+	gstate = PyGILState_Ensure();
+	result = PyEval_CallFunction((PyObject*)user, "(ii)", progress->pages_done, progress->pages_total);
+	if(result == NULL) {
+		// stop the upload rather than carry on without telling anyone
+		PyErr_Print();
+		shake_cancel_upload(dev);
+	}
+	Py_XDECREF(result);
+	PyGILState_Release(gstate);
+}
+
+/*	uploads the samples in <list> to the SHAKE, as 16 bit audio if <audio> is nonzero or as 8 bit
+*	vibration data otherwise. <callback> is an optional Python function called with the number of
+*	pages stored so far and the total number of pages */
+static PyObject* upload_sample_list(PyObject* args, int audio) {
+	int id, ret, pos, sample_length;
+	unsigned address;
+	PyObject* list;
+	PyObject* callback = NULL;
+	short* samples;
+	char* bytes;
+
+	if(!PyArg_ParseTuple(args, "iiO|O", &id, &address, &list, &callback))
+		return NULL;
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(callback == Py_None)
+		callback = NULL;
+
+	sample_length = PyList_GET_SIZE(list);
+
+	/* copy each list value into sample array */
+	samples = (short*)malloc(sizeof(short) * (sample_length + 1));
+	bytes = (char*)samples;
+	for(pos = 0; pos < sample_length; pos++) {
+		if(!PyInt_Check(PyList_GET_ITEM(list, pos))) {
+			PyObject* ex = PyExc_TypeError;
+			PyErr_SetString(ex, "Found non-integer argument in list!");
+			free(samples);
+			return NULL;
+		}
+		if(audio)
+			samples[pos] = (short)PyInt_AsLong(PyList_GET_ITEM(list, pos));
+		else
+			bytes[pos] = (char)PyInt_AsLong(PyList_GET_ITEM(list, pos));
+	}
+
+	// uploads take a while, so let other Python threads run (and call cancel_upload) in the meantime
+	Py_XINCREF(callback);
+	Py_BEGIN_ALLOW_THREADS
+	if(audio)
+		ret = shake_upload_audio(devicelist[id], address, samples, sample_length, callback ? upload_callback : NULL, callback);
+	else
+		ret = shake_exp_upload_vib(devicelist[id], address, bytes, sample_length, callback ? upload_callback : NULL, callback);
+	Py_END_ALLOW_THREADS
+	Py_XDECREF(callback);
+
+	free(samples);
+	return Py_BuildValue("i", ret);
+}
+
+static PyObject* pyshake_upload_audio_sample(PyObject* self, PyObject* args) {
+	return upload_sample_list(args, 1);
+}
+
+static PyObject* pyshake_play_audio_sample(PyObject* self, PyObject* args) {
+	int id;
+	unsigned start_addr, end_addr, amplitude;
+
+	PyArg_ParseTuple(args, "iiii", &id, &start_addr, &end_addr, &amplitude);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		int ret = shake_play_audio_sample(devicelist[id], start_addr, end_addr, amplitude);
+		return Py_BuildValue("i", ret);
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_register_audio_callback(PyObject* self, PyObject* args) {
+	PyObject *callback;
+	PyObject *device_object;
+	int id;
+	PyObject *result = NULL;
+
+    if (PyArg_ParseTuple(args, "iOO", &id, &callback, &device_object)) {
+		if(id < 0 || id >= MAX_SHAKES) {
+			Py_INCREF(Py_None);
+			return Py_None;
+		}	
+
+		// if unregistering the callback
+		if(callback == Py_None) {
+			//printf("register_audio_callback : clearing\n");
+			unregister_audio_callback(id);
+		} else {
+			// registering a new callback
+			if (PyCallable_Check(callback) == 0) {
+				PyErr_SetString(PyExc_TypeError, "parameter must be callable");
+				Py_INCREF(Py_None);
+				return Py_None;
+			}
+
+			//printf("Setting audio callback\n");
+
+			Py_XINCREF(callback);         /* Add a reference to new callback */
+			Py_XDECREF(audio_callbacks[id][0]);  /* Dispose of previous callback */
+			audio_callbacks[id][0] = callback;       /* Remember new callback */
+			audio_callbacks[id][1] = device_object;
+			audio_callbacks[id][2] = NULL; //PyList_New(SHAKE_AUDIO_DATA_LEN);
+			audio_callbacks[id][3] = NULL; //PyList_New(SHAKE_AUDIO_DATA_LEN);
+			shake_register_audio_callback(devicelist[id], main_audio_callback);
+			
+		}
+    }
+	result = Py_BuildValue("i", SHAKE_SUCCESS);
+    return result;
+}
+
+// arguments: 4 ints, ID number, buffer size, jitter allowance (ms), concealment
+static PyObject* pyshake_enable_mic_buffer(PyObject* self, PyObject* args) {
+	int id, size, jitter_ms, concealment;
+
+	PyArg_ParseTuple(args, "iiii", &id, &size, &jitter_ms, &concealment);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_enable_mic_buffer(devicelist[id], size, jitter_ms, concealment));
+}
+
+// arguments: 3 ints, ID number, number of samples, timeout (ms)
+static PyObject* pyshake_read_mic(PyObject* self, PyObject* args) {
+	int id, num_samples, timeout_ms, count, i;
+	short* samples;
+	PyObject* list;
+
+	PyArg_ParseTuple(args, "iii", &id, &num_samples, &timeout_ms);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL || num_samples < 0) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	samples = (short*)malloc(sizeof(short) * (num_samples + 1));
+
+	// let other Python threads run while this one is blocked
+	Py_BEGIN_ALLOW_THREADS
+	count = shake_read_mic(devicelist[id], samples, num_samples, timeout_ms);
+	Py_END_ALLOW_THREADS
+
+	if(count == SHAKE_ERROR) {
+		free(samples);
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	list = PyList_New(count);
+	for(i=0;i<count;i++)
+		PyList_SET_ITEM(list, i, PyInt_FromLong(samples[i]));
+	free(samples);
+	return list;
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_get_mic_stats(PyObject* self, PyObject* args) {
+	int id;
+	shake_mic_stats stats;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL || shake_get_mic_stats(devicelist[id], &stats) == SHAKE_ERROR) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	return Py_BuildValue("[I, I, I, I]", stats.received, stats.lost, stats.concealed, stats.overflows);
+}
+
+// arguments: 4 ints, ID number, buffer size, prefill, fill
+static PyObject* pyshake_enable_playback_buffer(PyObject* self, PyObject* args) {
+	int id, size, prefill, fill;
+
+	PyArg_ParseTuple(args, "iiii", &id, &size, &prefill, &fill);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_enable_playback_buffer(devicelist[id], size, prefill, fill));
+}
+
+// arguments: 1 int, ID number, list of samples, 1 int, timeout (ms)
+static PyObject* pyshake_write_playback(PyObject* self, PyObject* args) {
+	int id, timeout_ms, count, i, ret;
+	short* samples;
+	PyObject* list;
+
+	PyArg_ParseTuple(args, "iOi", &id, &list, &timeout_ms);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL || !PyList_Check(list))
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	count = (int)PyList_Size(list);
+	samples = (short*)malloc(sizeof(short) * (count + 1));
+	for(i=0;i<count;i++)
+		samples[i] = (short)PyInt_AsLong(PyList_GetItem(list, i));
+
+	// let other Python threads run while this one waits for space
+	Py_BEGIN_ALLOW_THREADS
+	ret = shake_write_playback(devicelist[id], samples, count, timeout_ms);
+	Py_END_ALLOW_THREADS
+
+	free(samples);
+	return Py_BuildValue("i", ret);
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_playback_space(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_playback_space(devicelist[id]));
+}
+
+// arguments: 1 int, ID number
+static PyObject* pyshake_get_playback_stats(PyObject* self, PyObject* args) {
+	int id;
+	shake_playback_stats stats;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL || shake_get_playback_stats(devicelist[id], &stats) == SHAKE_ERROR) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	return Py_BuildValue("[I, I, I]", stats.sent, stats.underruns, stats.filled);
+}
+
+static PyObject* pyshake_heart_rate(PyObject* self, PyObject* args) {
+	PyObject *callback;
+	PyObject *device_object;
+	int id;
+	PyObject *result = NULL;
+
+    if (PyArg_ParseTuple(args, "i", &id)) {
+		if(id < 0 || id >= MAX_SHAKES) {
+			Py_INCREF(Py_None);
+			return Py_None;
+		}	
+
+		return Py_BuildValue("i", shake_heart_rate(devicelist[id]));
+	}
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
+
+static PyObject* pyshake_exp_upload_vib_sample(PyObject* self, PyObject* args) {
+	return upload_sample_list(args, 0);
+}
+
+static PyObject* pyshake_set_upload_options(PyObject* self, PyObject* args) {
+	int id, window, retries, timeout_ms, chunk_size, delay_ms;
+
+	PyArg_ParseTuple(args, "iiiiii", &id, &window, &retries, &timeout_ms, &chunk_size, &delay_ms);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_set_upload_options(devicelist[id], window, retries, timeout_ms, chunk_size, delay_ms));
+}
+
+static PyObject* pyshake_cancel_upload(PyObject* self, PyObject* args) {
+	int id;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL)
+		return Py_BuildValue("i", SHAKE_ERROR);
+
+	return Py_BuildValue("i", shake_cancel_upload(devicelist[id]));
+}
+
+static PyObject* pyshake_get_upload_stats(PyObject* self, PyObject* args) {
+	int id;
+	shake_upload_stats stats;
+
+	PyArg_ParseTuple(args, "i", &id);
+
+	if(id < 0 || id >= MAX_SHAKES || devicelist[id] == NULL || shake_get_upload_stats(devicelist[id], &stats) == SHAKE_ERROR) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	return Py_BuildValue("[i, i, i, i, i, d, d]", stats.status, stats.pages_total, stats.pages_done, stats.pages_sent, stats.retries, stats.elapsed, stats.bytes_per_sec);
+}
+
+static PyObject* pyshake_exp_play_vib_sample(PyObject* self, PyObject* args) {
+	int id;
+	unsigned start_addr, end_addr, amplitude;
+
+	PyArg_ParseTuple(args, "iiii", &id, &start_addr, &end_addr, &amplitude);
+
+	if(id < 0 || id >= MAX_SHAKES) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	if(devicelist[id] != NULL) {
+		int ret = shake_exp_play_vib_sample(devicelist[id], start_addr, end_addr, amplitude);
+		return Py_BuildValue("i", ret);
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* pyshake_rfid_tid(PyObject* self, PyObject* args) {
+	int id;
+
+    if (PyArg_ParseTuple(args, "i", &id)) {
+		if(id < 0 || id >= MAX_SHAKES) {
+			Py_INCREF(Py_None);
+			return Py_None;
+		}	
+
+		return Py_BuildValue("s", shake_rfid_tid(devicelist[id]));
+	}
+
+	return Py_BuildValue("s", "");
+}
+
+static PyObject* pyshake_rfid_scan(PyObject* self, PyObject* args) {
+	int id;
+
+    if (PyArg_ParseTuple(args, "i", &id)) {
+		if(id < 0 || id >= MAX_SHAKES) {
+			Py_INCREF(Py_None);
+			return Py_None;
+		}	
+
+		return Py_BuildValue("i", shake_rfid_scan(devicelist[id]));
+	}
+
+	return Py_BuildValue("i", SHAKE_ERROR);
+}
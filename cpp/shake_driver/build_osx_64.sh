@@ -5,5 +5,5 @@ LIBSHAKE="libshake_driver.so"
 
 rm -f $LIBSHAKE
 
-$CPP -o $LIBSHAKE -shared $CFLAGS src/shake_driver.cpp src/shake_thread.cpp src/shake_serial_usb.cpp src/shake_io.cpp src/shake_packets.cpp src/shake_parsing.cpp src/SK6.cpp src/SK7.cpp src/SHAKE.cpp 
+$CPP -o $LIBSHAKE -shared $CFLAGS src/shake_driver.cpp src/shake_thread.cpp src/shake_queue.cpp src/shake_clock.cpp src/shake_stats.cpp src/shake_reactor.cpp src/shake_replay.cpp src/shake_capture.cpp src/shake_command.cpp src/shake_shadow.cpp src/shake_event.cpp src/shake_audio.cpp src/shake_upload.cpp src/shake_serial_usb.cpp src/shake_io.cpp src/shake_packets.cpp src/shake_parsing.cpp src/SK6.cpp src/SK7.cpp src/SHAKE.cpp 
 
@@ -0,0 +1,85 @@
+#ifndef _SHAKE_AUDIO_H_
+#define _SHAKE_AUDIO_H_
+
+
+
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	Microphone audio from the SK6. Once shake_enable_mic_buffer() has been called, the reader
+*	thread decodes each packet of audio into a single producer/single consumer ring buffer
+*	(see shake_mic_buffer in shake_structs.h) rather than passing it straight to the audio
+*	callback, filling in any packets it thinks were lost on the way. The application reads the
+*	buffer itself, or has blocks of it delivered to a callback by the thread that delivers its
+*	events (see shake_event.h).
+*
+*	Playback audio goes the other way through a shake_playback_buffer: the application compresses
+*	audio into it ahead of time with shake_write_playback(), and each time the SHAKE asks for more
+*	the reader thread just sends the next packet's worth, without calling the application. */
+
+// allocates the buffer (if required) and enables/disables it
+int shake_mic_enable(shake_device_private* devpriv, int size, int jitter_ms, int concealment);
+
+// frees the buffer, only safe once the reader thread has stopped
+void shake_mic_free(shake_device_private* devpriv);
+
+// TRUE if audio packets should go into the buffer rather than to the audio callback
+static inline BOOL shake_mic_enabled(shake_device_private* devpriv) {
+	return shake_atomic_load_acquire(&(devpriv->mic.enabled));
+}
+
+/*	decodes a packet of SHAKE_AUDIO_DATA_LEN mu-law samples into the buffer, after filling in 
+*	for any packets lost before it. Called by the reader thread */
+void shake_mic_push(shake_device_private* devpriv, const unsigned char* data);
+
+// returns the number of samples waiting in the buffer
+int shake_mic_count(shake_device_private* devpriv);
+
+// copies up to <max> samples into <samples> and removes them from the buffer
+int shake_mic_pop(shake_device_private* devpriv, short* samples, int max);
+
+/*	passes every complete block of audio waiting in the buffer to the mic callback. Called by 
+*	shake_event_dispatch() with the dispatch lock held */
+void shake_mic_deliver(shake_device_private* devpriv);
+
+// allocates the playback buffer (if required) and enables/disables it
+int shake_playback_enable(shake_device_private* devpriv, int size, int prefill, int fill);
+
+// frees the playback buffer, only safe once the reader thread has stopped
+void shake_playback_free(shake_device_private* devpriv);
+
+// TRUE if the SHAKE's requests for playback audio should be answered from the buffer rather than the audio callback
+static inline BOOL shake_playback_enabled(shake_device_private* devpriv) {
+	return shake_atomic_load_acquire(&(devpriv->playback.enabled));
+}
+
+/*	sends the next SHAKE_AUDIO_DATA_LEN samples from the buffer, or makes up for them if there 
+*	aren't enough. Called by the reader thread when the SHAKE asks for more audio */
+void shake_playback_send(shake_device_private* devpriv);
+
+// returns the number of samples that can be added to the buffer
+int shake_playback_free_space(shake_device_private* devpriv);
+
+// compresses up to <max> samples into the buffer, returning the number added
+int shake_playback_push(shake_device_private* devpriv, const short* samples, int max);
+
+#endif /* _SHAKE_AUDIO_H_ */
@@ -0,0 +1,59 @@
+#ifndef _SHAKE_CAPTURE_H_
+#define _SHAKE_CAPTURE_H_
+
+
+
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	Recording everything passing over a device's connection to a capture file (see shake_replay.h
+*	for the format), so a session can be replayed later with shake_init_device_replay().
+*
+*	The driver threads only copy each chunk into a memory buffer, which a separate writer thread 
+*	empties into the file, so recording never makes the reader thread wait for the disk. If the
+*	disk can't keep up and the buffer fills, chunks are dropped and counted instead. */
+
+/* size of each of the two buffers between the driver threads and the writer thread */
+#define SHAKE_CAPTURE_BUFFER_SIZE (1 << 20)
+/* longest time (ms) recorded data waits in the buffer before being written out */
+#define SHAKE_CAPTURE_FLUSH_INTERVAL 100
+
+/*	starts recording the connection of <devpriv> into <filename>, replacing any recording already 
+*	in progress. Returns SHAKE_SUCCESS, or SHAKE_ERROR if the file couldn't be created. */
+int shake_capture_open(shake_device_private* devpriv, char* filename);
+
+/*	stops recording and writes everything still buffered out to the file. Returns SHAKE_SUCCESS, 
+*	or SHAKE_ERROR if no recording was in progress. */
+int shake_capture_close(shake_device_private* devpriv);
+
+/*	adds <length> bytes of data that arrived from (<flags> == 0) or were sent to (<flags> == 
+*	SHAKE_CAPTURE_SENT) the device at host time <time> to the recording. Called by the driver
+*	for every read and write while devpriv->capturing is set */
+void shake_capture_record(shake_device_private* devpriv, double time, unsigned int flags, char* data, int length);
+
+/* number of chunks dropped from the current or last recording because the buffer was full */
+unsigned int shake_capture_dropped(shake_device_private* devpriv);
+
+/* stops any recording and frees everything allocated by shake_capture_open(), when the device is freed */
+void shake_capture_free(shake_device_private* devpriv);
+
+#endif /* _SHAKE_CAPTURE_H_ */
@@ -0,0 +1,39 @@
+#ifndef _SHAKE_CLOCK_H_
+#define _SHAKE_CLOCK_H_
+
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	Sample clock models, see shake_sensor_clock in shake_structs.h. */
+
+// range of the sequence numbers in ASCII packets (2 decimal digits)
+#define SHAKE_ASCII_SEQ_RANGE 100
+// range of the sequence numbers in raw packets (1 byte)
+#define SHAKE_RAW_SEQ_RANGE 256
+
+/*	unwraps the sequence number of <sample> (which wraps at <seq_range>) into its sample index
+*	and fits the receive time of <sample> into the model for its sensor. Fills in the index
+*	and sample_time fields of <sample>, the other fields must already be set, and updates the
+*	packet counts in <clk> */
+void shake_clock_update(shake_sensor_clock* clk, int seq_range, shake_sample* sample);
+
+#endif /* _SHAKE_CLOCK_H_ */
@@ -0,0 +1,76 @@
+#ifndef _SHAKE_COMMAND_H_
+#define _SHAKE_COMMAND_H_
+
+
+
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	Sending commands to the SHAKE and matching up the ACK/NAK replies. Each command that expects a
+*	reply gets an entry in the device's shake_command_engine before it is sent, and the reader 
+*	thread completes the oldest entry with the same register address as each reply that arrives.
+*	Threads waiting for a command sleep until a reply arrives instead of polling for it. */
+
+/* address for commands whose reply doesn't carry a register address (eg uploads), which take any reply */
+#define SHAKE_COMMAND_ANY_ADDR -1
+
+/* sets up the engine of a new device, with a window of 1 command */
+void shake_command_init(shake_device_private* devpriv);
+
+/*	completes any commands still waiting with SHAKE_COMMAND_TIMEOUT and frees the engine. Only 
+*	called once the reader thread has stopped */
+void shake_command_free(shake_device_private* devpriv);
+
+/*	sends the <len> byte command in <buf>, waiting first if the command window is full. If 
+*	<chunk_size> is nonzero the command is sent with write_bytes_delayed(), otherwise with 
+*	write_bytes(). The reply is expected to carry <addr>, and the command times out if it hasn't 
+*	arrived <timeout_ms> milliseconds after the command was sent. If <window> is nonzero it replaces
+*	the engine's window for this command. <future> and <callback> are both optional. Returns 
+*	SHAKE_SUCCESS if the command was sent, SHAKE_ERROR otherwise. */
+int shake_command_send(shake_device_private* devpriv, char* buf, int len, int chunk_size, int delay_ms, int addr, int timeout_ms, int window, shake_future* future, shake_command_callback callback, void* user);
+
+/*	sends a command as shake_command_send() does and waits for the reply, putting the value it carries
+*	into <value> (if not NULL). If <wait> is FALSE the command is only sent. Returns SHAKE_SUCCESS 
+*	if the command was sent and (if waiting) acknowledged, SHAKE_ERROR otherwise. */
+int shake_command_run(shake_device_private* devpriv, char* buf, int len, int chunk_size, int delay_ms, int addr, int timeout_ms, BOOL wait, unsigned char* value);
+
+/*	waits for up to <timeout_ms> milliseconds (forever if negative) for the command using <future>
+*	to complete. Returns the status of the command. */
+int shake_command_wait(shake_device_private* devpriv, shake_future* future, int timeout_ms);
+
+/*	called by the reader thread when an ACK (<ack> is TRUE) or NAK arrives. Returns FALSE if no
+*	command was waiting for it */
+BOOL shake_command_reply(shake_device_private* devpriv, BOOL ack, int addr, int value);
+
+/* how often (ms) shake_command_tick() is called while commands are waiting for a reply */
+#define SHAKE_COMMAND_TICK_MS 60
+
+/*	times out any commands whose replies are overdue, so that a command with only a callback 
+*	completes even when no thread is waiting for it. Called every SHAKE_COMMAND_TICK_MS by the 
+*	device's callback thread (or its reactor thread) for as long as this returns TRUE, meaning 
+*	commands are still in flight. The first command sent after that wakes the thread up again */
+BOOL shake_command_tick(shake_device_private* devpriv);
+
+/* sets the number of commands that can wait for a reply at once. Returns SHAKE_SUCCESS or SHAKE_ERROR */
+int shake_command_set_window(shake_device_private* devpriv, int window);
+
+#endif /* _SHAKE_COMMAND_H_ */
@@ -1,1701 +1,2582 @@
-/**
-*	@file shake_driver.h
-*	Main SHAKE header, for use with firmware version: 2.00/2.01 betas and higher
-*
-*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#ifndef _SHAKE_HEADER_
-#define _SHAKE_HEADER_
-
-#include "shake_platform.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-
-/**	Global success code for SHAKE functions. */
-#define SHAKE_SUCCESS 	 1
-
-/** Global error code for SHAKE functions. */
-#define SHAKE_ERROR 	 -1
-
-/** Values that can appear as the parameter of the SHAKE event callback function.
-*	The SHAKE event callback function is used to relay several different events that can
-*	be produced by the device. This enumeration defines a value for each individual event
-*	so that the callback function can determine the type of the event that has occurred.
-*	See the shake_register_event_callback() function for information on setting up the callback. */
-enum shake_events { 
-	/** Nav switch moved up */
-	SHAKE_NAV_UP = 1,
-	/** Nav switch moved down */
-	SHAKE_NAV_DOWN = 2,
-	/** Nav switch pressed */
-	SHAKE_NAV_CENTRE,
-	/** Nav switch released */
-	SHAKE_NAV_NORMAL,
-	/** Cap switch 0 upper threshold reached (SK6 only) */
-	SK6_CS0_UPPER,
-	/** Cap switch 0 lower threshold reached (SK6 only) */
-	SK6_CS0_LOWER,
-	/** Cap switch 1 upper threshold reached (SK6 only) */
-	SK6_CS1_UPPER,
-	/** Cap switch 1 lower threshold reached (SK6 only) */
-	SK6_CS1_LOWER,
-	/** Logging data playback complete */
-	SHAKE_PLAYBACK_COMPLETE,
-	/** Shaking event was triggered */
-	SHAKE_SHAKING_EVENT,
-	/** Heart rate monitor event */
-	SHAKE_HEART_RATE_EVENT,
-	/** RFID TID detection event */
-	SHAKE_RFID_TID_EVENT,
-	/**	Capacitive sensor 0 upper threshold reached (SK7 only) */
-	SK7_CS0_UPPER,
-	/** Capacitive sensor 0 lower threshold reached (SK7 only) */
-	SK7_CS0_LOWER,
-	/**	Capacitive sensor 1 upper threshold reached (SK7 only) */
-	SK7_CS1_UPPER,
-	/** Capacitive sensor 1 lower threshold reached (SK7 only) */
-	SK7_CS1_LOWER,
-	/**	Capacitive sensor 2 upper threshold reached (SK7 only) */
-	SK7_CS2_UPPER,
-	/** Capacitive sensor 2 lower threshold reached (SK7 only) */
-	SK7_CS2_LOWER,
-	/**	Capacitive sensor 3 upper threshold reached (SK7 only) */
-	SK7_CS3_UPPER,
-	/** Capacitive sensor 3 lower threshold reached (SK7 only) */
-	SK7_CS3_LOWER,
-	/**	Capacitive sensor 4 upper threshold reached (SK7 only) */
-	SK7_CS4_UPPER,
-	/** Capacitive sensor 4 lower threshold reached (SK7 only) */
-	SK7_CS4_LOWER,
-	/**	Capacitive sensor 5 upper threshold reached (SK7 only) */
-	SK7_CS5_UPPER,
-	/** Capacitive sensor 5 lower threshold reached (SK7 only) */
-	SK7_CS5_LOWER,
-	/**	Capacitive sensor 6 upper threshold reached (SK7 only) */
-	SK7_CS6_UPPER,
-	/** Capacitive sensor 6 lower threshold reached (SK7 only) */
-	SK7_CS6_LOWER,
-	/**	Capacitive sensor 7 upper threshold reached (SK7 only) */
-	SK7_CS7_UPPER,
-	/** Capacitive sensor 7 lower threshold reached (SK7 only) */
-	SK7_CS7_LOWER,
-	/**	Capacitive sensor 8 upper threshold reached (SK7 only) */
-	SK7_CS8_UPPER,
-	/** Capacitive sensor 8 lower threshold reached (SK7 only) */
-	SK7_CS8_LOWER,
-	/**	Capacitive sensor 9 upper threshold reached (SK7 only) */
-	SK7_CS9_UPPER,
-	/** Capacitive sensor 9 lower threshold reached (SK7 only) */
-	SK7_CS9_LOWER,
-	/**	Capacitive sensor 10 upper threshold reached (SK7 only) */
-	SK7_CSA_UPPER,
-	/** Capacitive sensor 10 lower threshold reached (SK7 only) */
-	SK7_CSA_LOWER,
-	/**	Capacitive sensor 11 upper threshold reached (SK7 only) */
-	SK7_CSB_UPPER,
-	/** Capacitive sensor 11 lower threshold reached (SK7 only) */
-	SK7_CSB_LOWER,
-};
-
-/**	These are the set of optional modules that can be installed in the SHAKE SK6.
-*	They are divided into two sets, one for each of the two available slots.
-*	Most modules will only fit into one slot, eg the RFID module can only be installed
-*	in slot 1. To check which module(s) are installed in a SHAKE, use the
-*	shake_info_module_slot1() and shake_info_module_slot2() functions. Each function will
-*	a value from the enumeration indicating which module is installed in the selected slot.
-*	If no module is installed, the value SHAKE_MODULE_NONE is returned. */
-enum sk6_optional_modules {
-	/** indicates no module is installed */
-	SK6_MODULE_NONE = 0,
-
-	/** slot 1; G-01 gyro module */
-	SK6_MODULE_GYRO1 = 1,		
-	/** slot 1; G-02 gyro module */
-	SK6_MODULE_GYRO2,			
-	/** slot 1; RFID module */
-	SK6_MODULE_RFID,	
-
-	
-	/** slot 2; audio module */
-	SK6_MODULE_AUDIO,	
-	/** slot 2; external vibration module */
-	SK6_MODULE_EXTVIB,
-	/** slot 2; usb module (none of these yet) */
-	SK6_MODULE_USB,	
-	/** slot 2; expansion module (STANE) */
-	SK6_MODULE_EXPANSION,
-	
-	SK6_MODULE_LAST,
-};
-
-// TODO
-enum sk7_optional_modules {
-	SK7_MODULE_NONE = SK6_MODULE_LAST+1,
-
-	SK7_MODULE_LAST,
-};
-
-/**	Valid values for the device_type parameter for all shake_init_device functions */
-enum shake_device_types {
-	SHAKE_SK6 = 0,
-	SHAKE_SK7 = 1,
-};
-
-/** Instances of this structure represent a connection to a single SHAKE device. 
-*	A succesful call to shake_init_device() will return a pointer to an instance of this structure. 
-*	The application using the driver then has to pass this pointer as the first parameter when calling 
-*	other SHAKE functions */
-typedef struct {
-	/** device ID number. */
-	int handle; 		
-	/** Pointer to internal data. */
-	void* priv;			
-} shake_device;
-
-#include "shake_registers.h"
-
-/*	=== Startup/shutdown functions === */
-
-// NOTE:
-//	valid forms for bluetooth address string in rfcomm funcs:
-//		1. "aabbccddeeff"
-//		2. "0xaabbccddeeff"
-//		3. "aa:bb:cc:dd:ee:ff"
-//	ALL LETTERS MUST BE LOWER CASE FOR NOW
-
-#ifdef _WIN32
-/**	(Windows only) Creates a connection to a SHAKE device.
-*	This function attempts to create a Bluetooth connection to a SHAKE device. Typically on a 
-*	Windows system you cannot specify a Bluetooth name or hardware address, so the only parameter
-*	required is the outgoing COM port number to connect to the device through (see SHAKE user manual)
-*	@param com_port The COM port number (accepted range is -1 to autodetect, else 1-100)
-*	@param device_type indicates if the target is an SK6 or SK7
-*
-*	@return NULL on failure, otherwise a pointer to a shake_device structure */
-SHAKE_API shake_device* shake_init_device(int com_port, int device_type);
-
-/**	(Windows XP SP2 / Windows Mobile 5) Creates a connection to a SHAKE device.
-*	Unlike the shake_init_device() function, this function uses the Microsoft Bluetooth API to
-*	open an RFCOMM connection to a specific SHAKE device, currently specified by a numeric 
-*	Bluetooth address. 
-*	This function will not work if you are using non-Microsoft Bluetooth drivers!
-*	@param btaddr Bluetooth MAC address of the target SHAKE
-*	@param device_type indicates if the target is an SK6 or SK7
-*	
-*	@return NULL on failure, otherwise a pointer to a shake_device structure */
-
-SHAKE_API shake_device* shake_init_device_rfcomm_i64(SHAKE_INT64 btaddr, int device_type);
-SHAKE_API shake_device* shake_init_device_rfcomm_str(char* btaddr, int device_type);
-
-#else
-/*	++ Linux only ++
-*	Main initialisation function for setting up a link to a SHAKE device.
-*	<btaddr> is the Bluetooth MAC address of the device to connect to, 
-*	given in string format (eg "12:34:56:78:90:ab")
-*	
-*	Returns NULL on failure, otherwise a pointer to a shake_device 
-*	structure which can then be passed to the functions below. */
-SHAKE_API shake_device* shake_init_device_rfcomm_i64(SHAKE_INT64 btaddr, int device_type);
-SHAKE_API shake_device* shake_init_device_rfcomm_str(char* btaddr, int device_type);
-#endif
-
-#ifndef _WIN32
-SHAKE_API shake_device* shake_init_device_usb_serial(char* usb_dev, int device_type);
-#endif
-
-/**	Only for debugging use */
-SHAKE_API shake_device* shake_init_device_DEBUGFILE(char* readfile, char* writefile, int device_type);
-
-/**
-*	Close the link with a SHAKE device and free up any resources used in maintaining the connection.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*
-*	@return SHAKE_SUCCESS on success, SHAKE_ERROR on failure. */
-SHAKE_API int shake_free_device(shake_device* sh);
-
-/* === SHAKE miscellaneous functions === */
-
-/**	Query SHAKE firmware revision number.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE firmware revision number (format is x.yz), or 0.0 on error. */
-SHAKE_API float shake_info_firmware_revision(shake_device* sh);
-
-/**	Query SHAKE hardware revision number.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE hardware revision number (format is x.yz), or 0.0 on error. */
-SHAKE_API float shake_info_hardware_revision(shake_device* sh);
-
-/**	Query SHAKE serial number.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return pointer to a null terminated string containing the SHAKE serial number. Format is
-*	SK6-xxxx, eg SK6-0003. Do not modify or attempt to deallocate the returned string. 
-*	On error, NULL is returned. */
-SHAKE_API char* shake_info_serial_number(shake_device* sh);
-
-/**	Query SHAKE Bluetooth firmware revision (SK7 only)
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE hardware revision number (format is x.yz), or 0.0 on error. */
-SHAKE_API float shake_info_bluetooth_firmware_revision(shake_device* sh);
-
-/**	Query SHAKE slot1 expansion module
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return one of the values in the ::shake_optional_modules enumeration, indicating the type of module installed 
-*	On error, SHAKE_ERROR is returned */
-SHAKE_API int shake_info_module_slot1(shake_device* sh);
-
-/**	Query SHAKE slot2 expansion module
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return one of the values in the ::shake_optional_modules enumeration, indicating the type of module installed 
-*	On error, SHAKE_ERROR is returned */
-SHAKE_API int shake_info_module_slot2(shake_device* sh);
-
-/**	Query SHAKE expansion module for a particular slot. For the SK6, valid values are 0-1. For the SK7, 0-3.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return one of the values in the ::sk6_optional_modules or ::sk7_optional_modules enumeration, indicating the type of module installed 
-*	On error, SHAKE_ERROR is returned */
-SHAKE_API int shake_info_module(shake_device* sh, int slot_number);
-
-/**	Returns a string name for a SHAKE expansion module.
-*	@param module a value returned from shake_info_module_slot1() or shake_info_module_slot2
-*	@return pointer to a string containing the name of the specified module, eg "RFID module" */
-SHAKE_API char* shake_info_module_name(int module);
-
-/**	Requests device specific information from the connected SHAKE, including firmware and hardware versions plus
-*	the serial number. After successfully calling this function, you can retrieve the information about the device
-*	using the other functions with prefix shake_info, eg shake_info_firmware_revision(). You can also call these
-*	functions directly, this function will be called internally if necessary. 
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_info_retrieve(shake_device* sh);
-
-/**	Reset various registers on the SHAKE to their default values. If a SHAKE has stopped outputting sensor data
-*	or is otherwise behaving abnormally, using this function may solve the problem. It may need to be called several
-*	times to take effect completely.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param repeat if >0, the reset process will be repeated <repeat> times
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_factory_reset(shake_device* sh, int repeat);
-
-/** Allows you to register a callback function for receiving events from the SHAKE.
-*	The callback function should have the signature:
-*	
-*	void callback(shake_device* dev, int event)
-*
-*	The event parameter will be one of the ::shake_events constants indicating the type of event, 
-*	and the dev parameter will be the shake_device object that received the event.
-*	To unregister the callback, call the function again with a NULL parameter. 
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param callback pointer to user specified callback function
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_register_event_callback(shake_device* sh, void (SHAKE_CALLBACK *callback)(shake_device*, int));
-
-/**	Allows you to control whether the driver will wait for acknowledgement packets when sending
-*	commands to the SHAKE. The default is to enable this functionality as it can be used to confirm
-*	whether a command succeeded or not. Register read commands will always wait for acknowledgements
-*	since the acknowledgement contains the contents of the requested register.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param wait_for_ack zero to disable waiting for ACKs, nonzero to enable 
-*
-*	@return */
-SHAKE_API void shake_wait_for_acks(shake_device* sh, int wait_for_ack);
-
-/**	Allows you to override the LED colour of the SHAKE (SK7 only!)
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()	
-*	@param red red value (1-255)
-*	@param green green value (1-255)
-*	@param blue blue (1-255)
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk7_override_led(shake_device* sh, unsigned char red, unsigned char green, unsigned char blue);
-
-#ifdef _WIN32
-/** Identical to the shake_register_event_callback() function in every way, except that it accepts a pointer to
-*	a callback function using the stdcall calling convention, while shake_register_event_callback requires a cdecl
-*	function pointer. 
-*
-*	While both callbacks can be registered separately, in virtually all cases only one should be required.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param callback pointer to user specified callback function (with stdcall calling convention)
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_register_event_callback_STDCALL(shake_device* sh, void (SHAKE_STDCALL_CALLBACK *callback)(shake_device*, int));
-#endif
-
-/* === SHAKE audio functions === */
-
-/*	Allows you to register a callback function for receiving audio data from SHAKEs with modified hardware.
-*	The callback function should have the signature:
-*
-*	void callback(shake_device* dev, short* mic_samples, int mic_length, short* playback_samples, int playback_length);
-*
-*	The 'dev' parameter will be the shake_device* object that received the audio data. The 'mic_samples' parameter
-*	will be a pointer to the latest set of audio samples, while the 'mic_length' parameter gives the number
-*	of SAMPLES (ie not the number of bytes). The samples are provided in 16-bit signed PCM format, and can
-*	be played back or written to a .wav file directly without any further conversion. The 'playback_samples' parameter
-*	will be a pointer to a buffer where you can optionally place a new set of audio data to be played back on the SHAKE.
-*	The 'playback_length' parameter gives the number of samples to write (again, not bytes). The samples should be 16-bit
-*	signed PCM.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param callback pointer to user specified callback function
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_register_audio_callback(shake_device* sh, void (SHAKE_CALLBACK *callback)(shake_device*, short*, int, short*, int));
-
-#ifdef _WIN32
-/** Identical to the shake_register_audio_callback() function in every way, except that it accepts a pointer to
-*	a callback function using the stdcall calling convention, while shake_register_audio_callback requires a cdecl
-*	function pointer. 
-*
-*	While both callbacks can be registered separately, in virtually all cases only one should be required.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param callback pointer to user specified callback function (with stdcall calling convention)
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_register_audio_callback_STDCALL(shake_device* sh, void (SHAKE_STDCALL_CALLBACK *callback)(shake_device*, short*, int, short*, int));
-#endif
-
-/**	Uploads an audio sample to the internal memory of the SHAKE.
-*	NOTE: this functionality shares memory with data logging, do not use both at the same time!
-*	
-*	The SHAKE has 8000 "pages" of memory for audio, each containing 1056 samples.
-*	Once uploaded successfully, samples can be played back using the shake_play_audio_sample() function.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param address the page number to upload the sample to (valid range is SHAKE_UPLOAD_MIN_PAGE to SHAKE_UPLOAD_MAX_PAGE)
-*	@param sample_data pointer to the audio data in 16 bit signed format. The data will be compressed to an 8-bit format
-*	before transmission. 
-*	@param sample_len length of the audio data in samples (not bytes). If this is less than SHAKE_AUDIO_PAGE_SIZE, the remainder
-*	of the sample will be filled with zeroes.
-*	
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_upload_audio_sample(shake_device* sh, unsigned short address, short* sample_data, unsigned short sample_len);
-
-/**	Plays back an audio sample from the SHAKEs internal memory. The sample can span multiple memory "pages".
-*
-*	Use the shake_write_audio_config() function to enable sample playback before using this function.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param start_address starting page of the audio sample
-*	@param end_address ending page (inclusive) of the audio sample
-*	@param amplitude amplitude for audio playback, valid range is SHAKE_AUDIO_AMPLTIUDE_MIN to SHAKE_AUDIO_AMPLITUDE_MAX inclusive
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_play_audio_sample(shake_device* sh, unsigned short start_address, unsigned short end_address, unsigned short amplitude);
-
-/* === SHAKE Expansion Module functions === */
-
-/**	Uploads a vibration sample to the internal memory of the SHAKE.
-*	NOTE: this functionality shares memory with data logging, do not use both at the same time!
-*	Only available on SHAKEs with expansion module E01
-*	
-*	The SHAKE has 8000 "pages" of memory for vibration data, each containing 1056 samples.
-*	Once uploaded successfully, samples can be played back using the shake_exp_play_vib_sample() function.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param address the page number to upload the sample to (valid range is SHAKE_UPLOAD_MIN_PAGE to SHAKE_UPLOAD_MAX_PAGE)
-*	@param sample_data pointer to the vibration data in linear 8-bit 2's complement signed format.
-*	@param sample_len length of the audio data in samples (not bytes). If this is less than SHAKE_UPLOAD_PAGE_SIZE, the remainder
-*	of the sample will be filled with zeroes.
-*	
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_exp_upload_vib_sample(shake_device* sh, unsigned short address, char* sample_data, unsigned short sample_len);
-
-/**	Plays back a vibration sample from the SHAKEs internal memory. The sample can span multiple memory "pages".
-*	Only available on SHAKEs with expansion module E01
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param start_address starting page of the audio sample
-*	@param end_address ending page (inclusive) of the audio sample
-*	@param amplitude amplitude for audio playback, valid range is SHAKE_AUDIO_AMPLTIUDE_MIN to SHAKE_AUDIO_AMPLITUDE_MAX inclusive
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_exp_play_vib_sample(shake_device* sh, unsigned short start_address, unsigned short end_address, unsigned short amplitude);
-
-/** Writes a value into one of the 6 general purpose registers available on SHAKEs with the E01 module installed.
-*	These can be used to power LEDs or similar devices.
-*	Only available on SHAKEs with expansion module E01
-*
-*	Valid values for each register range from 0-255, representing an output current of 0mA-10mA.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param reg_number the register to update, must be 0-5
-*	@param value the value to write into the selected register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_exp_write_gp_register(shake_device* sh, int reg_number, unsigned value);
-
-
-
-/* === SHAKE data access functions === 
-*	Each of these returns one or more sensor
-*	readings from the given SHAKE device. Every function takes a pointer to
-*	a shake_device structure as returned by shake_init_device. */
-
-/**	Read current x-axis accelerometer value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return current x-axis accelerometer value */
-SHAKE_API int shake_accx(shake_device* sh);
-
-/**	Read current y-axis accelerometer value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return current y-axis accelerometer value */
-SHAKE_API int shake_accy(shake_device* sh);
-
-/**	Read current z-axis accelerometer value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return current z-axis accelerometer value */
-SHAKE_API int shake_accz(shake_device* sh);
-
-/**	Read current accelerometer values.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param xyz pointer to a 3 element array of integers, into which the 3 accelerometer readings will
-*	be placed (in x,y,z order).
-*	@return SHAKE_SUCCESS, or SHAKE_ERROR if either parameter is NULL */
-SHAKE_API int shake_acc(shake_device* sh, int* xyz);
-
-/**	Read current x-axis gyroscope value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return current x-axis gyroscope value */
-SHAKE_API int shake_gyrx(shake_device* sh);
-
-/**	Read current y-axis gyroscope value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return current y-axis gyroscope value */
-SHAKE_API int shake_gyry(shake_device* sh);
-
-/**	Read current z-axis gyroscope value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return current z-axis gyroscope value */
-SHAKE_API int shake_gyrz(shake_device* sh);
-
-/**	Read current gyroscope values.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param xyz pointer to a 3 element array of integers, into which the 3 gyroscope readings will
-*	be placed (in x,y,z order).
-*	@return SHAKE_SUCCESS, or SHAKE_ERROR if either parameter is NULL */
-SHAKE_API int shake_gyr(shake_device* sh, int* xyz);
-
-/**	Read current x-axis magnetometer value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return current x-axis magnetometer value */
-SHAKE_API int shake_magx(shake_device* sh);
-
-/**	Read current y-axis magnetometer value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return current y-axis magnetometer value */
-SHAKE_API int shake_magy(shake_device* sh);
-
-/**	Read current z-axis magnetometer value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return current z-axis magnetometer value */
-SHAKE_API int shake_magz(shake_device* sh);
-
-/**	Read current magnetometer values.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param xyz pointer to a 3 element array of integers, into which the 3 magnetometer readings will
-*	be placed (in x,y,z order).
-*	@return SHAKE_SUCCESS, or SHAKE_ERROR if either parameter is NULL */
-SHAKE_API int shake_mag(shake_device* sh, int* xyz);
-
-/** Read current compass heading value.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return A value are in the range 0-3599 (tenths of a degree), SHAKE_ERROR otherwise */
-SHAKE_API int shake_heading(shake_device* sh);
-
-/**	SK7 only. Read current roll-pitch-heading values (requires the roll-pitch-heading packet output
-*	to be enabled first, see sk7_configure_roll_pitch_heading). If legacy heading packet output is
-*	enabled, use shake_heading to retrieve that data.
-*	
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param rph pointer to a 3 element array of integers, into which the roll, pitch and heading readings
-*			will be placed (in that order). See the user manual for details of the format of each value.
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk7_roll_pitch_heading(shake_device* sh, int* rph);
-
-/**	SK7 only. Read current roll-pitch-heading values when in quaternion output mode. 
-*	(requires the roll-pitch-heading packet output
-*	to be enabled first, see sk7_configure_roll_pitch_heading). If legacy heading packet output is
-*	enabled, use shake_heading to retrieve that data.
-*	
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param rph pointer to a 4 element array of floats, into which the quaternions will be placed. 
-*										See the user manual for details of the format of each value.
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk7_roll_pitch_heading_quaternions(shake_device* sh, float* rphq);
-
-/** Read the proximity value of the first capacitive sensor.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return A value in the range 0-255 (255 is highest proximity), SHAKE_ERROR otherwise */
-SHAKE_API int sk6_cap0(shake_device* sh);
-
-/** Read the proximity value of the second capacitive sensor.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return A value in the range 0-255 (255 is highest proximity), SHAKE_ERROR otherwise */
-SHAKE_API int sk6_cap1(shake_device* sh);
-
-/** Read the proximity values of both capacitive sensors on the SK6
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param proxboth pointer to a 2 element int array, into which the proximity values will be placed.
-*	in the order cap0, cap1.
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk6_cap(shake_device* sh, int* proxboth);
-
-/** Read the proximity values of all 12 capacitive sensors on the SK7
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param prox pointer to a 12 element int array, into which the proximity values will be placed.
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk7_cap(shake_device* sh, int* prox);
-
-/**	Read capacitive data from one or both blocks on an SK7 external capactive device. 
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param prox pointer to a 12 element int array, into which the proximity values will be placed.
-*	@param blocks the blocks to return data for;	0 for 1st block only (prox array must be >= 12 elements long),
-*													1 for 2nd block only (prox array must be >= 12 elements long),
-*													2 for both blocks (prox array must be >= 24 elements long).
-*	@param prox pointer to an array into which the proximity values will be placed (note length requirements above!)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk7_cap_ext(shake_device* sh, int blocks, int* prox);
-
-/**	Read the current value of the first analog input.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return a value in the range 0-2500 (mV), SHAKE_ERROR on error */
-SHAKE_API int shake_analog0(shake_device* sh);
-
-/**	Read the current value of the second analog input.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return a value in the range 0-2500 (mV), SHAKE_ERROR on error */
-SHAKE_API int shake_analog1(shake_device* sh);
-
-/**	Read the current values of both analog inputs.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param a0a1 pointer to a 2 element int array, into which the two values will be placed, 
-*	in the order analog0, analog1.
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_analog(shake_device* sh, int* a0a1);
-
-/**	Reads the peak acceleration value for the last shaking event detected by the onboard
-*	shake detection algorithm. You should normally call this function from your SHAKE event
-*	callback function, since the values will be updated when a SHAKE_SHAKING_EVENT is received.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return the peak acceleration value in 0.1g units */
-SHAKE_API int shake_shaking_peakaccel(shake_device* sh);
-
-/**	Reads the direction value for the last shaking event detected by the onboard
-*	shake detection algorithm. You should normally call this function from your SHAKE event
-*	callback function, since the values will be updated when a SHAKE_SHAKING_EVENT is received.
-*
-*	Possible return values are 0 (direction detection is disabled), 1 (x-axis), 2 (y-axis) and
-*	3 (z-axis).
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return the direction value, SHAKE_ERROR on error */
-SHAKE_API int shake_shaking_direction(shake_device* sh);
-
-/**	Reads the timestamp value for the last shaking event detected by the onboard
-*	shake detection algorithm. You should normally call this function from your SHAKE event
-*	callback function, since the values will be updated when a SHAKE_SHAKING_EVENT is received.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return the time modulo 1 second in units of 1/1024 second that the event was detected */
-SHAKE_API int shake_shaking_timestamp(shake_device* sh);
-
-/** Reads the current heart rate BPM value from the heart rate monitor (not installed in all SHAKEs!)
-*	You should normally call this function from your SHAKE event callback function, since the value
-*	will be updated when a SHAKE_HEART_RATE_EVENT is received.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return the current heart rate in beats per minute */
-SHAKE_API int shake_heart_rate(shake_device* sh);
-
-/** Reads the last detected RFID TID tag for RFID-enabled SHAKEs. Normally you should call this function
-*	from your SHAKE event callback, since the tag is only updated when a SHAKE_RFID_TID_EVENT is received.
-*
-*	The returned value will be a pointer to a 16 byte ASCII hex string containing the tag. It will be overwritten
-*	by subsequent tags, so applications should store a copy themselves if they wish to keep a history.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return the last detected RFID TID tag */
-SHAKE_API char* shake_rfid_tid(shake_device* sh);
-
-/**	Triggers an RFID scan by writing to the VO_REG_RFID_SCAN register. You can use this to start a
-*	scan when RFID autoscanning is disabled.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_rfid_scan(shake_device* sh);
-
-/**	Retrieves temperatures of gyro (and in binary output mode also accelerometer) sensors.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param temps pointer to a 4 element array. On return this will be populated with the current temperatures of
-*				the gyro sensors in the following order: pitch, roll, yaw. Additionally if the SK7 is in binary
-*				output mode, the 4th element will contain the temperature of the accelerometer sensor (this is not
-*				available in ASCII output mode).
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_gyro_temperatures(shake_device* sh, float* temps);
-
-/**	Each SHAKE data packet contains a sequence number in the range 0-99. This function can be used to retrieve
-*	the sequence number from the last accessed packet for a particular sensor. For example, if the accelerometer
-*	sensor is selected, the value returned will be the sequence number of the current accelerometer packet at
-*	the time of the last call to one of the shake_acc() group of functions.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param sensor the sensor to read the sequence number for
-*	@return the last sequence number for the selected sensor*/
-SHAKE_API int shake_data_timestamp(shake_device* sh, int sensor);
-
-/* 	=== Data logging functions === 
-*	These functions allow you to control the SHAKE data logging functionality found in firmware 2.00 and later */
-
-/** Initiates playback of recorded data over the serial link.
-*	Playback will start from the current position in memory, call shake_logging_stop() first to read from the start. 
-*	
-*	To detect the end of the playback process, use shake_register_event_callback() to register a callback function, 
-*	and wait for the SHAKE_PLAYBACK_COMPLETE event to be triggered.
-*	
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param output_filename (optional path) and filename to write the log data into.
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_logging_play(shake_device* sh, char* output_filename);
-
-/**	If recording or playback active, pauses the process at the current write/read position in memory.
-*	To resume a paused operation, simply call shake_logging_record() or shake_logging_play() as appropriate.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_logging_pause(shake_device* sh);
-
-/** Stops recording or playback AND resets the write/read position to the start of internal memory.
-*	This command will also close any output logfile currently open. 
-*
-*	You should usually call this function before calling either shake_logging_play() or shake_logging_record(), 
-*	to reset the write/read position. 
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_logging_stop(shake_device* sh);
-
-/**	Starts logging data into internal memory from the current writing position. 
-*	Call shake_logging_stop() first to reset the writing position to the start of internal memory. 
-*
-*	Note that while recording in progress, changes to the SHAKE configuration registers (using the register access functions)
-*	will be disallowed. If you need to change sample rates etc mid-recording, call shake_logging_pause(), change
-*	the registers, then resume logging by calling shake_logging_record() again
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_logging_record(shake_device* sh);
-
-/** Resets the data logging timestamp clock to zero.
-*	Should usually only be sent prior to a shake_logging_record command.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_logging_reset(shake_device* sh);
-
-/** Indicates the current status of data logging on the SHAKE. 
-*	The value returned will be a bitwise combination of these three values:
-*	- SHAKE_LOGGING_RECORDING		(recording is in progress)
-*	- SHAKE_LOGGING_PLAYING		(playback is in progress)
-*	- SHAKE_LOGGING_MEMORYFULL	(memory is almost full, <1% available)
-*
-*	Obviously only 1 of the RECORDING/PLAYING values will be set at any particular time. 
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_logging_status(shake_device* sh);
-
-/** Indicates the proportion of internal memory remaining free for logged data.
-*	The value returned will be between 0 and 255, with 0 meaning no space remaining, and 255
-*	meaning the whole memory is free. 
-*
-*	@warning Currently doesn't work properly, may always report 100% full.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_logging_memory_status(shake_device* sh);
-
-/** Returns the approximate number of packets logged to internal memory. 
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return The number of packets logged (only accurate to nearest 100), or SHAKE_ERROR */
-SHAKE_API int shake_logging_packet_count(shake_device* sh);
-
-/** During playback of logged data, this function can be used to count incoming packets.
-*	Unlike the shake_logging_packet_count() function, which indicates the total number of packets stored in
-*	the SHAKE itself, this function queries a local value which gives the number of packets received from
-*	the SHAKE. This value can then be used to estimate overall progress when taken along with the result 
-*	of the shake_logging_packet_count() function.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_logging_packets_read(shake_device* sh);
-
-/**	The SHAKE SK7 can optionally power down the Bluetooth module while logging is active to increase 
-*	battery life. To power down the Bluetooth module, simply call this function. The module will remain
-*	inactive until the SK7 is reconnected using a USB cable. 
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk7_logging_bt_power_down(shake_device* sh);
-
-/*	=== Register access functions === 
-*	These functions allow you to easily get/set the values of the various configuration registers
-*	on a SHAKE device */
-
-/** Read the SHAKE_NV_REG_POWER1 register, which controls power to the various sensors on the device. 
-*	The value returned will be a combination of the values from the ::shake_power1 enumeration.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_power_state(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_POWER1 register, which controls power to the various sensors on the device. 
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value to write into the register (should be a combination of the values from the ::shake_power1 enumeration)
-*		For example, to power on the accelerometer and magnetometer (disabling everything else), the value should be:
-*		SHAKE_POWER_ACC | SHAKE_POWER_MAG
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_power_state(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_POWER2 register, which enables/disables capacitive switch thresholds and event output.
-*	The value returned will be a combination of the values from the ::shake_power2 enumeration.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_power_state_2(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_POWER2 register, which enables/disables capacitive switch thresholds and event output.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value to write into the register (should be a combination of the values from the ::shake_power2 enumeration)
-*		For example, to enable upper and lower thresholds for cap switch 0, plus event packet output, the value
-*		would be SHAKE_POWER_CS0_INC | SHAKE_POWER_CS0_DEC | SHAKE_POWER_CS_EVENTS
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_power_state_2(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_ACC_CONFIG register, which configures a couple of aspects of the accelerometer.
-*	The first bit in the returned value indicates the accelerometer range:
-*	- if 0, the range is +/- 2g
-*	- if 1, the range is +/- 6g
-*
-*	If set, the 2nd bit indicates the high pass filter is enabled, if unset the filter is disabled.
-*
-*	The remaining bits are not currently used.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_acc_config(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_ACC_CONFIG register, which configures a couple of aspects of the accelerometer.
-*	The first bit of \a value controls the accelerometer range:
-*		- if 0, the range is +/- 2g
-*		- if 1, the range is +/- 6g
-*
-*		If set, the 2nd bit enabless the high pass filter. If unset the filter is disabled.
-*
-*		The remaining bits are not currently used.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register.
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_acc_config(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_DATAFMT register, which configures the output data format from the SHAKE.
-*	If set, the first bit of the returned value indicates that checksums will be attached to ASCII data packets.
-*
-*	If set, the second bit indicates that output will be in raw (binary) mode, if not set, output is ASCII.
-*
-*	The remaining bits are not currently used.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_data_format(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_DATAFMT register, which configures the output data format from the SHAKE.
-*	If set, the first bit of \a value enables checksums for ASCII data packets. If not set, checksums are disabled.
-*
-*	If set, the second bit indicates that output will be in raw (binary) mode. If not set, output is ASCII.
-*
-*	The remaining bits are not currently used.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_data_format(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CALIB_BYPASS register, which can be used to obtain uncalibrated data from selected sensors.
-*	The value returned will be a combination of the values from the ::shake_bypass_sensor_calib enumeration. If 
-*	the bit for a particular sensor is set, it means uncalibrated output is enabled.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_calib_bypass(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CALIB_BYPASS register, which can be used to obtain uncalibrated data from selected sensors.
-*	The value to write should be a combination of the values from the ::shake_bypass_sensor_calib enumeration. If 
-*	the bit for a particular sensor is set, it means uncalibrated output will be enabled.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_calib_bypass(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CX_CALIB_BYPASS register, which can be used to disable the cross axes calibration for
-*	sensors with multiple degrees of freedom (accelerometer, gyro, magnetometer).
-*	The value returned will be a combination of the values from the ::shake_cx_bypass_sensor_calib enumeration. If 
-*	the bit for a particular sensor is set, it means uncalibrated output is enabled.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_cx_bypass(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CX_CALIB_BYPASS register, which can be used to disable the cross axes calibration for
-*	sensors with multiple degrees of freedom (accelerometer, gyro, magnetometer).
-*	The value to write will be a combination of the values from the ::shake_cx_bypass_sensor_calib enumeration. If 
-*	the bit for a particular sensor is set, it means uncalibrated output will be enabled.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_cx_bypass(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_TEMP_COMPENSATION register, which indicates the state of temperature compensation for sensor output.
-*	Currently only gyroscope compensation is possible
-*	@warning This might not be working yet.
-*	The 2nd bit in the register is currently the only one used - if set, gyro temperature compensation is enabled.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_temp_compensation(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_TEMP_COMPENSATION register, which controls the state of temperature compensation for sensor output.
-*	Currently only gyroscope compensation is possible
-*	@warning This might not be working yet.
-*	The 2nd bit in the register is currently the only one used - if set, gyro temperature compensation is enabled.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_temp_compensation(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_STREAM_DISABLE register, which can be used to disable the streaming of data packets for selected sensors.
-*	The value returned will be a combination of the values from the ::shake_stream_disable enumeration. If 
-*	the bit for a particular sensor is set, it means data streaming is DISABLED for that sensor (even if sample rate above 0).
-*
-*	NOTE: this functionality is removed on SK7s with firmware version >= 1.00. Setting the sample rate to 0 has an 
-*	equivalent effect.
-*	
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_packet_streaming(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_STREAM_DISABLE register, which can be used to disable the streaming of data packets for selected sensors.
-*	The value to write should be a combination of the values from the ::shake_stream_disable enumeration. If 
-*	the bit for a particular sensor is set, it means data streaming will be DISABLED for that sensor (even if sample rate above 0).
-*
-*	NOTE: this functionality is removed on SK7s with firmware version >= 1.00. Setting the sample rate to 0 has an 
-*	equivalent effect.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_packet_streaming(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_AUDIO_CONFIG register, which can be used to configure the audio functionality on SHAKEs with
-*	supported hardware. 
-*	The value returned will be a combination of the values from the ::shake_audio_config enumeration.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_audio_config(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_AUDIO_CONFIG register, which can be used to configure the audio functionality on SHAKEs with
-*	supported hardware. 
-*	The value to write should be a combination of the values from the ::shake_audio_config enumeration. 
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_audio_config(shake_device* sh, unsigned char value);
-
-/** Write the VO_REG_MIDI_AMPLITUDE register, which can be used to configure the ampltiude of the SHAKE
-*	MIDI synthesiser. 
-*	The value to write should be SHAKE_MIDI_AMPLITUDE_MUTE if the amplitude should be muted, otherwise
-*	a value between SHAKE_MID_AMPLITUDE_MIN and SHAKE_MIDI_AMPLITUDE_MAX inclusive.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_midi_amplitude(shake_device* sh, unsigned char value);
-
-/** Write the VO_REG_MIDI_NOTE register, which can be used to configure the MIDI note to play from the SHAKE
-*	MIDI synthesiser.
-*	The value to write should be in the range SHAKE_MIDI_NOTE_MIN and SHAKE_MIDI_NOTE_MAX inclusive.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_midi_note(shake_device* sh, unsigned char value);
-
-/** Write the VO_REG_MIDI_WAVEFORM register, which can be used to configure the waveform to use from the SHAKE
-*	MIDI synthesiser. 
-*	The value to write should be a member of the ::shake_midi_waveforms enumeration. 
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_midi_waveform(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CS0_INC register, which contains the increasing threshold value for capacitive switch 0.
-*
-*	SK6 only.
-*	The value returned will be in the range 0-255 (the same range as the normal output from the sensor).
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk6_read_cs0_inc(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CS0_INC register, which contains the increasing threshold value for capacitive switch 0.
-*
-*	SK6 only.
-*	The value for the threshold should be in the range 0-255 (the same range as the normal output from the sensor).
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the threshold value (must be greater than the decreasing threshold!)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR 
-*	@see shake_write_cs0_dec() */
-SHAKE_API int sk6_write_cs0_inc(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CS0_DEC register, which contains the decreasing threshold value for capacitive switch 0.
-*
-*	SK6 only.
-*	The value returned will be in the range 0-255 (the same range as the normal output from the sensor).
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register.
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk6_read_cs0_dec(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CS0_DEC register, which contains the decreasing threshold value for capacitive switch 0.
-*
-*	SK6 only.
-*	The value for the threshold should be in the range 0-255 (the same range as the normal output from the sensor).
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the threshold value (must be less than the increasing threshold!)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR
-*	@see shake_write_cs0_inc() */
-SHAKE_API int sk6_write_cs0_dec(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CS0_INC_PROFILE register, which contains the number of the vibration profile to play when
-*	the increasing threshold on capacitive switch 0 is triggered.
-*
-*	SK6 only.
-*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
-*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR 
-*	@see shake_read_power_state_2()
-*	@see shake_write_power_state_2() */
-SHAKE_API int sk6_read_cs0_inc_profile(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CS0_INC_PROFILE register, which controls the number of the vibration profile to play when
-*	the increasing threshold on capacitive switch 0 is triggered.
-*
-*	SK6 only.
-*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
-*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR 
-*	@see shake_read_power_state_2()
-*	@see shake_write_power_state_2() */
-SHAKE_API int sk6_write_cs0_inc_profile(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CS0_DEC_PROFILE register, which contains the number of the vibration profile to play when
-*	the decreasing threshold on capacitive switch 0 is triggered.
-*
-*	SK6 only.
-*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
-*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR 
-*	@see shake_read_power_state_2()
-*	@see shake_write_power_state_2()*/
-SHAKE_API int sk6_read_cs0_dec_profile(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CS0_DEC_PROFILE register, which controls the number of the vibration profile to play when
-*	the decreasing threshold on capacitive switch 0 is triggered.
-*
-*	SK6 only.
-*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
-*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR 
-*	@see shake_read_power_state_2()
-*	@see shake_write_power_state_2() */
-SHAKE_API int sk6_write_cs0_dec_profile(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CS1_INC register, which contains the increasing threshold value for capacitive switch 1.
-*
-*	SK6 only.
-*	The value returned will be in the range 0-255 (the same range as the normal output from the sensor).
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk6_read_cs1_inc(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CS1_INC register, which contains the decreasing threshold value for capacitive switch 1.
-*
-*	SK6 only.
-*	The value for the threshold should be in the range 0-255 (the same range as the normal output from the sensor).
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the threshold value (must be less than the increasing threshold!)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR
-*	@see shake_write_cs1_dec() */
-SHAKE_API int sk6_write_cs1_inc(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CS1_DEC register, which contains the decreasing threshold value for capacitive switch 1.
-*
-*	SK6 only.
-*	The value returned will be in the range 0-255 (the same range as the normal output from the sensor).
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk6_read_cs1_dec(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CS1_DEC register, which contains the increasing threshold value for capacitive switch 1.
-*
-*	SK6 only.
-*	The value for the threshold should be in the range 0-255 (the same range as the normal output from the sensor).
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the threshold value (must be less than the increasing threshold!)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR
-*	@see shake_write_cs1_inc() */
-SHAKE_API int sk6_write_cs1_dec(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CS1_INC_PROFILE register, which contains the number of the vibration profile to play when
-*	the increasing threshold on capacitive switch 1 is triggered.
-*
-*	SK6 only.
-*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
-*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR 
-*	@see shake_read_power_state_2()
-*	@see shake_write_power_state_2()*/
-SHAKE_API int sk6_read_cs1_inc_profile(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CS1_INC_PROFILE register, which controls the number of the vibration profile to play when
-*	the increasing threshold on capacitive switch 1 is triggered.
-*
-*	SK6 only.
-*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
-*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR 
-*	@see shake_read_power_state_2()
-*	@see shake_write_power_state_2() */
-SHAKE_API int sk6_write_cs1_inc_profile(shake_device* sh, unsigned char value);
-
-/** Read the SHAKE_NV_REG_CS1_DEC_PROFILE register, which contains the number of the vibration profile to play when
-*	the decreasing threshold on capacitive switch 1 is triggered.
-*
-*	SK6 only.
-*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
-*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR 
-*	@see shake_read_power_state_2()
-*	@see shake_write_power_state_2()*/
-SHAKE_API int sk6_read_cs1_dec_profile(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_CS1_DEC_PROFILE register, which controls the number of the vibration profile to play when
-*	the increasing threshold on capacitive switch 1 is triggered.
-*
-*	SK6 only.
-*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
-*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR 
-*	@see shake_read_power_state_2()
-*	@see shake_write_power_state_2() */
-SHAKE_API int sk6_write_cs1_dec_profile(shake_device* sh, unsigned char value);
-
-/**	This function allows you to read all 8 registers related to capacitive switch thresholds in a single operation.
-*
-*	SK6 only.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param values pointer to an 8 element array, which will be populated with the values from each of the 8
-*	registers in the following order:
-*	- SK6_NV_REG_CS0_INC			(cap switch 0, increasing threshold)
-*	- SK6_NV_REG_CS0_DEC			(cap switch 0, decreasing threshold)
-*	- SK6_NV_REG_CS0_INC_PROFILE	(cap switch 0, increasing threshold vib profile)
-*	- SK6_NV_REG_CS0_DEC_PROFILE	(cap switch 0, decreasing threshold vib profile)
-*	- SK6_NV_REG_CS1_INC			(cap switch 1, increasing threshold)
-*	- SK6_NV_REG_CS1_DEC			(cap switch 1, decreasing threshold)
-*	- SK6_NV_REG_CS1_INC_PROFILE	(cap switch 1, increasing threshold vib profile)
-*	- SK6_NV_REG_CS1_DEC_PROFILE	(cap switch 1, decreasing threshold vib profile)
-* 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR
-*/
-SHAKE_API int sk6_read_cap_thresholds(shake_device* sh, unsigned char* values);
-
-/**	This function allows you to write all 8 registers related to capacitive switch thresholds in a single operation.
-*
-*	SK6 only.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param values pointer to an 8 element array, which should be populated with the values for each of the 8
-*	registers in the following order:
-*	- SK6_NV_REG_CS0_INC			(cap switch 0, increasing threshold)
-*	- SK6_NV_REG_CS0_DEC			(cap switch 0, decreasing threshold)
-*	- SK6_NV_REG_CS0_INC_PROFILE	(cap switch 0, increasing threshold vib profile)
-*	- SK6_NV_REG_CS0_DEC_PROFILE	(cap switch 0, decreasing threshold vib profile)
-*	- SK6_NV_REG_CS1_INC			(cap switch 1, increasing threshold)
-*	- SK6_NV_REG_CS1_DEC			(cap switch 1, decreasing threshold)
-*	- SK6_NV_REG_CS1_INC_PROFILE	(cap switch 1, increasing threshold vib profile)
-*	- SK6_NV_REG_CS1_DEC_PROFILE	(cap switch 1, decreasing threshold vib profile)
-*	
-*	@return SHAKE_SUCCESS or SHAKE_ERROR
-*/
-SHAKE_API int sk6_write_cap_thresholds(shake_device* sh, unsigned char* values);
-
-/**	This function allows you to read all 4 registers related to capacitive switch thresholds in a single operation.
-*
-*	SK7 only.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param values pointer to a 4 element array, which will be populated with the values from each of the 4 relevant
-*	registers in the following order:
-*	- SK7_NV_REG_CAP_INC			(increasing threshold)
-*	- SK7_NV_REG_CAP_DEC			(decreasing threshold)
-*	- SK7_NV_REG_CAP_INC_PROFILE	(increasing threshold vib profile)
-*	- SK7_NV_REG_CAP_DEC_PROFILE	(decreasing threshold vib profile)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR
-*/
-SHAKE_API int sk7_read_cap_thresholds(shake_device* sh, unsigned char* values);
-
-/**	This function allows you to write all 4 registers related to capacitive switch thresholds in a single operation.
-*
-*	SK7 only.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param values pointer to a 4 element array, which should be populated with the values for each of the 4
-*	registers in the following order:
-*	- SK7_NV_REG_CAP_INC			(increasing threshold)
-*	- SK7_NV_REG_CAP_DEC			(decreasing threshold)
-*	- SK7_NV_REG_CAP_INC_PROFILE	(increasing threshold vib profile)
-*	- SK7_NV_REG_CAP_DEC_PROFILE	(decreasing threshold vib profile)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR
-*/
-SHAKE_API int sk7_write_cap_thresholds(shake_device* sh, unsigned char* values);
-
-/** Reads the various registers which control the output sample rate for each sensor.
-*	Each sensor has a an output sample rate range between 0 and some maximum, which is given by the
-*	value of the corresponding constant from the ::shake_max_output_rates enumeration. For example,
-*	SHAKE_ACC_MAX_RATE is the maximum accelerometer sample rate. Each sensor also has a dedicated register
-*	containing the current output sample rate.
-*
-*	To get the sample rate for a selected sensor, use the appropriate value from ::shake_sensors as the
-*	\a sensor_id parameter (eg SHAKE_SENSOR_ACC for accelerometer).
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param sensor_id sensor to get sample rate for (from ::shake_sensors)
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_sample_rate(shake_device* sh, int sensor_id, unsigned char* value);
-
-/** Write the various registers which control the output sample rate for each sensor.
-*	Each sensor has a an output sample rate range between 0 and some maximum, which is given by the
-*	value of the corresponding constant from the ::shake_max_output_rates enumeration. For example,
-*	SHAKE_ACC_MAX_RATE is the maximum accelerometer sample rate. Each sensor also has a dedicated register
-*	containing the current output sample rate.
-*
-*	To set the sample rate for a selected sensor, use the appropriate value from ::shake_sensors as the
-*	\a sensor_id parameter (eg SHAKE_SENSOR_ACC for accelerometer).
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param sensor_id sensor to set sample rate for (from ::shake_sensors)
-*	@param value the sample rate to set for the selected sensor
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_sample_rate(shake_device* sh, int sensor_id, unsigned char value);
-
-/** Reads the various registers which control the digital filter settings for each sensor.
-*	The first bit in the returned value indicates filtering is enabled (if set) or disabled (if unset).
-*
-*	The second bit in the returned value indicates the type of filtering - if set, minimum phase, if unset, linear phase.
-*
-*	See the user manual for more details on digital filtering.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param sensor_id sensor to get digital filtering configuration for (from ::shake_sensors)
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_digital_filter(shake_device* sh, int sensor_id, unsigned char* value);
-
-/** Write the various registers which control the digital filter settings for each sensor.
-*	The first bit in \a value controls whether filtering is enabled (if set) or disabled (if unset).
-*
-*	The second bit in \a value controls the type of filtering - if set, minimum phase, if unset, linear phase.
-*
-*	See the user manual for more details on digital filtering.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param sensor_id sensor to set digital filtering configuration for (from ::shake_sensors)
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_digital_filter(shake_device* sh, int sensor_id, unsigned char value);
-
-/** Read the value of the SHAKE_NV_REG_SHAKING_CONFIG register, which controls the state of the
-*	shaking detection algorithm in firmware >= 2.01.
-*
-*	The value returned by the function will be zero, or a combination of values from the ::shake_shaking_configuration enumeration.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_shaking_config(shake_device* sh, unsigned char* value);
-
-/** Write a value into the SHAKE_NV_REG_SHAKING_CONFIG register, which allows you to configure the state of the
-*	shaking detection algorithm in firmware >= 2.01.
-*
-*	Using this register, you can separately enable/disable the shaking detection algorithm, the direction detection 
-*	part of the algorithm, and the use of vibrotactile feedback for shaking events.
-*
-*	The value to write should be zero or a combination of values from the ::shake_shaking_configuration enumeration.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR
-*/
-SHAKE_API int shake_write_shaking_config(shake_device* sh, unsigned char value);
-
-/** Reads the value of the SHAKE_NV_REG_SHAKING_ACCEL_THRESHOLD register.
-*
-*	This register controls the minimum peak acceleration below which shaking events will not be triggered.
-*
-*	The value returned by the function gives the peak acceleration in 0.1g units, so a value of 10 = 1g.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_shaking_accel_threshold(shake_device* sh, unsigned char* value);
-
-/** Writes a value into the SHAKE_NV_REG_SHAKING_ACCEL_THRESHOLD register.
-*
-*	This register controls the minimum peak acceleration below which shaking events will not be triggered.
-*
-*	\a value should be the minimum peak acceleration in units of 0.1g (10 = 1g).
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_shaking_accel_threshold(shake_device* sh, unsigned char value);
-
-/** Reads the value of the SHAKE_NV_REG_SHAKING_HOLDOFF_TIME register.
-*
-*	This register controls the hold-off time that the detection algorithm will wait after an acceleration
-*	peak before beginning to look for the next peak.
-*
-*	The value returned by the function gives the time in units of 7.8ms, so a value of 10 = 78ms.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_shaking_holdoff_time(shake_device* sh, unsigned char* value);
-
-/** Writes a value into the SHAKE_NV_REG_SHAKING_HOLDOFF_TIME register.
-*
-*	This register controls the hold-off time that the detection algorithm will wait after an acceleration
-*	peak before beginning to look for the next peak.
-*
-*	\a value should be the hold-off time in units of 7.8ms (10 = 78ms).
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_shaking_holdoff_time(shake_device* sh, unsigned char value);
-
-/** Reads the value of the SHAKE_NV_REG_SHAKING_VIBRATION_PROFILE register.
-*
-*	This register controls the vibration profile that will be activated when a shaking event is triggered (assuming
-*	the vibration control flag is enabled, see the shake_write_shaking_config() function).
-*
-*	The value returned by the function gives the address of the vibration profile that will be played.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_shaking_vibration_profile(shake_device* sh, unsigned char* value);
-
-/** Writes a value into the SHAKE_NV_REG_SHAKING_VIBRATION_PROFILE register.
-*
-*	This register controls the vibration profile that will be activated when a shaking event is triggered (assuming
-*	the vibration control flag is enabled, see the shake_write_shaking_config() function).
-*
-*	\a value should be the vibration profile address (between SHAKE_VIB_PROFILE_MIN and SHAKE_VIB_PROFILE_MAX inclusive)
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_shaking_vibration_profile(shake_device* sh, unsigned char value);
-
-/** Reads the value of the SHAKE_NV_REG_SHAKING_HPF_CONSTANT register.
-*
-*	This register controls the high pass filter length in the detection algorithm. The higher this value is,
-*	the more sensitive the algorithm will be to very low frequency movements.
-*
-*	The value returned by the function gives the length in units of 7.8ms, so a value of 10 = 78ms.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_shaking_hpf_constant(shake_device* sh, unsigned char* value);
-
-/** Writes a value into the SHAKE_NV_REG_SHAKING_HPF_CONSTANT register.
-*
-*	This register controls the high pass filter length in the detection algorithm. The higher this value is,
-*	the more sensitive the algorithm will be to very low frequency movements.
-*
-*	\a value should be the filter length in units of 7.8ms (10 = 78ms).
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_shaking_hpf_constant(shake_device* sh, unsigned char value);
-
-/** Reads the value of the SHAKE_NV_REG_SHAKING_LPF_CONSTANT register.
-*
-*	This register controls the low pass filter length in the detection algorithm. The higher this value is,
-*	the less susceptible the algorithm will be to higher frequency vibration.
-*
-*	The value returned by the function gives the length in units of 7.8ms, so a value of 10 = 78ms.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_shaking_lpf_constant(shake_device* sh, unsigned char* value);
-
-/** Writes a value into the SHAKE_NV_REG_SHAKING_LPF_CONSTANT register.
-*
-*	This register controls the low pass filter length in the detection algorithm. The higher this value is,
-*	the less susceptible the algorithm will be to higher frequency vibration.
-*
-*	\a value should be the filter length in units of 7.8ms (10 = 78ms).
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_shaking_lpf_constant(shake_device* sh, unsigned char value);
-
-/** Resets the state of the shaking algorithm configuration registers to their recommended values.
-*
-*	Calling this function performs the following operations:
-*		- the minimum peak acceleration threshold is set to 1g
-*		- the hold-off time is set to 47ms
-*		- the vibration profile address is set to zero
-*		- the high pass filter length is set to 250ms
-*		- the low pass filter length is set to 47ms
-*		- shaking detection is enabled
-*		- shaking detection direction detection is enabled
-*		- shaking detection vibration playback is enabled 
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_reset_shaking_detection(shake_device* sh);
-
-/**	Reads the value of the SHAKE_NV_REG_HEART_RATE_CONFIG register.
-*
-*	This register controls the configuration of the heart rate monitor installed in some SHAKEs.
-*
-*	The value returned by the function will be zero or a combination of one or more values from the
-*	::shake_heart_rate_configuration enumeration.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_heart_rate_config(shake_device* sh, unsigned char* value);
-
-/** Writes a value into the SHAKE_NV_REG_HEART_RATE_CONFIG register.
-*
-*	This register controls the configuration of the heart rate monitor installed in some SHAKEs.
-*
-*	\a value should be zero or a combination of one or more values from ::shake_heart_rate_configuration
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_heart_rate_config(shake_device* sh, unsigned char value);
-
-/** Write a value into the VO_REG_PKTREQ register, which allows you to explicitly request that the SHAKE send a particular type or
-*	types of data packet.
-*
-*	This function writes into a volatile register (write-only) that allows you to request
-*	a single set of data from one or more sensors (this is instead of or in addition to the usual
-*	data stream(s) generated by the device). 
-*
-*	The value you write should be a logical OR of one or more of the members of the ::shake_packet_requests enumeration,
-*	indicating which sensor(s) you want to request a data packet from.
-*
-*	The data will arrive in the usual way and so you should use the normal data access functions to read it.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_packet_request(shake_device* sh, unsigned char value);
-
-/** Write a value into the VO_REG_DATAREQ register, which allows you to request that the SHAKE re-output the 
-*	startup splash text (including firmware/hardware version) at any time.
-*
-*	The only valid value for the register at the moment is 1, which will cause the startup text to be output.
-*
-*	Future firmware versions may add extra functionality.
-*	
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the register
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_data_request(shake_device* sh, unsigned char value);
-
-/** Plays a vibration profile on one of the channels supported by the SHAKE (SK6 and SK7)
-*
-*	Note that for typical SHAKEs, the only valid channel is SHAKE_VIB_MAIN - the other channel
-*	values refer to externally connected vibrotactile units or plugin modules that may not be installed.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param channel should be a value from the ::shake_vib_channels enumeration
-*	@param profile should indicate the number of the vibration profile to playback from the SHAKE internal memory. The valid range of this number is SHAKE_VIB_PROFILE_MIN - SHAKE_VIB_PROFILE_MAX inclusive.
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_playvib(shake_device* sh, int channel, unsigned char profile);
-
-/**	Plays a continuous vibration through one of two external channels supported by the SK6 (NOT SK7)
-*
-*	This function can only be used with a SHAKE SK6 that has firmware version >= 2.50, and has one or
-*	more external piezo vibrators attached. For more information see the SHAKE SK6 manual. 
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param channel should be either SHAKE_VIB_LEFT or SHAKE_VIB_RIGHT
-*	@param amplitude amplitude of the vibration signal. Valid values are 0, 33, 66 and 100. 
-*	@param time period of the vibration signal. The range is 0-63, in units of 26ms (1 = 26ms, 63 = 1.66s)
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk6_playvib_continuous(shake_device* sh, int channel, unsigned char amplitude, unsigned char time);
-
-/** This function uploads a vibration sample to the SHAKE SK6, storing it in one of the available locations in internal memory.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param profile should indicate the number of the vibration profile to store the sample in.
-*	The valid range of this number is SHAKE_VIB_PROFILE_MIN - SHAKE_VIB_PROFILE_MAX inclusive.
-*	@param sample should point to an array of integers containing the sample data. The array should
-*	contain pairs of speed/time values (ie speed1,time1,speed2,time2,...). The speed values
-*	should be in the range 0 - SHAKE_VIB_SPEED_MAX inclusive. The time values should be in the
-*	range 0 - SHAKE_VIB_TIME_MAX inclusive, and are in units of 10 MILLISECONDS, so a value of
-*	10 means 100ms. 
-*	@param sample_length should be the the number of PAIRS in the @param sample array (NOT the total number
-*	of values). The maximum number of pairs is given by SHAKE_VIB_SAMPLE_MAX_LENGTH.
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR. Note that if and when the function returns
-*	SHAKE_SUCCESS, it means that the sample has been fully uploaded and is now available
-*	for immediate playback using shake_playvib() */
-SHAKE_API int sk6_upload_vib_sample(shake_device* sh, unsigned char profile, int* sample, int sample_length);
-
-/**	Similar to the above function except that it allows setting extra parameters in the vibration profile.
-*	This function can be used with the following device configurations:
-*		- A SHAKE SK6 with the SK6-V01 module, with continuous vibration support (firmware >= 2.60).
-*		- A SHAKE SK7
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param profile should indicate the number of the vibration profile to store the sample in.
-*	The valid range of this number is SHAKE_VIB_PROFILE_MIN - SHAKE_VIB_PROFILE_MAX inclusive.
-*	@param sample should point to an array of integers containing the sample data. The array should
-*	contain pairs of speed/time values (ie speed1,time1,speed2,time2,...). The speed values
-*	should be in the range 0 - SHAKE_VIB_SPEED_MAX inclusive. The time values should be in the
-*	range 0 - SHAKE_VIB_TIME_MAX inclusive, and are in units of 10 MILLISECONDS, so a value of
-*	10 means 100ms. 
-*	@param sample_length should be the the number of PAIRS in the @param sample array (NOT the total number
-*	of values). The maximum number of pairs is given by SHAKE_VIB_SAMPLE_MAX_LENGTH.
-*
-*	@param mode represents the mode of the drive when the actuation is triggered. For pulse drive must be 0x02 (this is the only
-*				valid option for the SK6!)
-*	@param freq frequency of the pulsed waveform. Actual output frequency is twice this value (eg 250Hz = 0x7D)
-*	@param duty ratio of the pulsed output. Range of values is 1-9, representing 10%-90% respectively.
-*	
-*	@return SHAKE_SUCCESS or SHAKE_ERROR. Note that if and when the function returns
-*	SHAKE_SUCCESS, it means that the sample has been fully uploaded and is now available
-*	for immediate playback using shake_playvib() */
-SHAKE_API int shake_upload_vib_sample_extended(shake_device* sh, unsigned char profile, int* sample, int sample_length, unsigned char mode, unsigned char freq, unsigned char duty);
-
-/** Reads the battery level from the device. 
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the result (range is 0 to SHAKE_BATTERY_MAX)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_battery_level(shake_device* sh, unsigned char* value);
-
-/** Reads the power status of the device.
-*
-*	The value from this register is a combination of 3 different items:
-*		- External power on/off
-*		- Battery charging/not charging
-*		- Battery charged/not fully charged
-*
-*	There are 3 simple macros defined in shake_registers.h to make checking each item 
-*	convenient (x is the value read from the device):
-*		- SHAKE_EXT_POWER_ON(x) (nonzero when ext power connected)
-*		- SHAKE_BATTERY_CHARGING(x) (nonzero if battery charging)
-*		- SHAKE_BATTERY_FULL(x) (nonzero if battery fully charged)
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_power_status(shake_device* sh, unsigned char* value);
-
-/** Reads the temperature sensor on the SHAKE device. 
-*	The value of this sensor is updated every second, but must be retrieved manually using this function 
-*	rather than as part of the normal data stream from the other sensors. 
-*	The measureable range is 0-64 degrees C, mapped onto 255 0.25 degree steps in the
-*	1-byte register. The reading returned by the function will be converted into 
-*	this 0-64C range automatically.
-*	
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@return a value between 0-64 on success, SHAKE_ERROR on error */
-SHAKE_API float shake_read_temperature(shake_device* sh);
-
-/** Read the SHAKE_NV_REG_EXPANSION_CONFIG register, which controls power to the various sensors on the
-*	E01 expansion module.
-*
-*	The value returned will be a combination of the values from the ::shake_expansion_configuration enumeration.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_expansion_config(shake_device* sh, unsigned char* value);
-
-/** Write the SHAKE_NV_REG_EXPANSION_CONFIG register, which controls power to the various sensors 
-*	E01 expansion module.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value to write into the register (should be a combination of the values from the ::shake_expansion_configuration enumeration)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_expansion_config(shake_device* sh, unsigned char value);
-
-/**	Read the SHAKE_NV_REG_RFID_CONFIG register, which controls the RFID expansion module settings.
-*
-*	The value returned will be a combination of the values from the ::shake_rfid_config enumeration.
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_rfid_config(shake_device* sh, unsigned char* value);
-
-/**	Write the SHAKE_NV_REG_RFID_CONFIG register, which controls the RFID expansion module settings.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value to write into the register (should be a combination of the values from the ::shake_rfid_config enumeration)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_rfid_config(shake_device* sh, unsigned char value);
-
-/**	Read the SHAKE_NV_REG_RFID_FREQUENCY register, which controls the RFID autoscan frequency
-*
-*	The value returned will be between SHAKE_RFID_AUTOSCAN_MIN_FREQ and SHAKE_RFID_AUTOSCAN_MAX_FREQ
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read_rfid_scan_freq(shake_device* sh, unsigned char* value);
-
-/**	Write the SHAKE_NV_REG_RFID_FREQUENCY register, which controls the RFID autoscan frequency
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value to write into the register (between SHAKE_RFID_AUTOSCAN_MIN_FREQ and SHAKE_RFID_AUTOSCAN_MAX_FREQ)
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write_rfid_scan_freq(shake_device* sh, unsigned char value);
-
-/**	SK7 only. Configures vibration feedback which is activated when the compass heading enters a defined range. Note that
-*	vibration feedback must be enabled using sk7_configure_heading_feedback, and the vibrator power must be turned on.
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param lower_threshold lower threshold for the heading value, in tenths of a degree
-*	@param upper_threshold upper threshold for the heading value, in tenths of a degree
-*	@param hysteresis the amount by which the heading must change above/below a threshold before the vibration
-*			feedback will be triggered again. Allowed values are 0-255, in tenths of a degree.
-*	@param vib_profile the address of the vibration profile to play when a threshold is crossed.
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk7_configure_heading_feedback(shake_device* sh, int lower_threshold, int upper_threshold, int hysteresis, int vib_profile);
-
-/**	SK7 only. Enable/disable heading vibration feedback partially or completely 
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param enabled set to 0 to disable ALL heading feedback, any other value to enable it
-*	@param vib_looping set to 0 to disable vibration looping, any other value to enable it
-*	@param led_feedback set to 0 to disable LED feedback when a threshold is crossed, any other value to enable it
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk7_control_heading_feedback(shake_device* sh, int enabled, int vib_looping, int led_feedback);
-
-/**	SK7 only. Configure output of roll-pitch-heading packet in firmware >= v1.00
-*
-*	The value parameter should be set as follows (21/6/09):
-*		0:	disable RPH output, use old heading only packet instead
-*		1:	output RPH packets using accelerometer and magnetometer to calculate the data
-*	More options may be available in future firmware releases.
-*	
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param value the value to write into the roll-pitch-heading configuration register
-*
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int sk7_configure_roll_pitch_heading(shake_device* sh, int value);
-
-/* 	=== Basic register access functions === 
-*	These functions allow you direct access to the various registers on the device.
-*	Usually it's easier to use one of the functions above, which don't involve
-*	searching for the correct register address or checking if a register is
-*	read/write etc. */
-
-/** Reads one of the SHAKE device configuration registers and returns its contents.
-*
-*	This function can be used to read the contents of any valid register (as an alternative to using
-*	the other register specific functions).
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param addr the register address (use one of the SHAKE_NV_REG/VO_REG constants from shake_registers.h)
-*	@param value pointer to an unsigned char variable which will receive the contents of the register 
-*	
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_read(shake_device* sh, int addr, unsigned char* value);
-
-/** Writes a value into one of the SHAKE device configuration registers.
-*
-*	This function can be used to write a value into any valid register (as an alternative to using
-*	the other register specific functions).
-*
-*	@param sh pointer to a shake_device structure as returned by shake_init_device()
-*	@param addr the register address (use one of the SHAKE_NV_REG/VO_REG constants from shake_registers.h)
-*	@param value the value that will be placed into the register (note that the range
-*		of values is dependent on the selected register, see user manual for details)
-* 
-*	@return SHAKE_SUCCESS or SHAKE_ERROR */
-SHAKE_API int shake_write(shake_device* sh, int addr, unsigned char value);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* _SHAKE_HEADER_ */
+/**
+*	@file shake_driver.h
+*	Main SHAKE header, for use with firmware version: 2.00/2.01 betas and higher
+*
+*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef _SHAKE_HEADER_
+#define _SHAKE_HEADER_
+
+#include "shake_platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**	Global success code for SHAKE functions. */
+#define SHAKE_SUCCESS 	 1
+
+/** Global error code for SHAKE functions. */
+#define SHAKE_ERROR 	 -1
+
+/** Values that can appear as the parameter of the SHAKE event callback function.
+*	The SHAKE event callback function is used to relay several different events that can
+*	be produced by the device. This enumeration defines a value for each individual event
+*	so that the callback function can determine the type of the event that has occurred.
+*	See the shake_register_event_callback() function for information on setting up the callback. */
+enum shake_events { 
+	/** Nav switch moved up */
+	SHAKE_NAV_UP = 1,
+	/** Nav switch moved down */
+	SHAKE_NAV_DOWN = 2,
+	/** Nav switch pressed */
+	SHAKE_NAV_CENTRE,
+	/** Nav switch released */
+	SHAKE_NAV_NORMAL,
+	/** Cap switch 0 upper threshold reached (SK6 only) */
+	SK6_CS0_UPPER,
+	/** Cap switch 0 lower threshold reached (SK6 only) */
+	SK6_CS0_LOWER,
+	/** Cap switch 1 upper threshold reached (SK6 only) */
+	SK6_CS1_UPPER,
+	/** Cap switch 1 lower threshold reached (SK6 only) */
+	SK6_CS1_LOWER,
+	/** Logging data playback complete */
+	SHAKE_PLAYBACK_COMPLETE,
+	/** Shaking event was triggered */
+	SHAKE_SHAKING_EVENT,
+	/** Heart rate monitor event */
+	SHAKE_HEART_RATE_EVENT,
+	/** RFID TID detection event */
+	SHAKE_RFID_TID_EVENT,
+	/**	Capacitive sensor 0 upper threshold reached (SK7 only) */
+	SK7_CS0_UPPER,
+	/** Capacitive sensor 0 lower threshold reached (SK7 only) */
+	SK7_CS0_LOWER,
+	/**	Capacitive sensor 1 upper threshold reached (SK7 only) */
+	SK7_CS1_UPPER,
+	/** Capacitive sensor 1 lower threshold reached (SK7 only) */
+	SK7_CS1_LOWER,
+	/**	Capacitive sensor 2 upper threshold reached (SK7 only) */
+	SK7_CS2_UPPER,
+	/** Capacitive sensor 2 lower threshold reached (SK7 only) */
+	SK7_CS2_LOWER,
+	/**	Capacitive sensor 3 upper threshold reached (SK7 only) */
+	SK7_CS3_UPPER,
+	/** Capacitive sensor 3 lower threshold reached (SK7 only) */
+	SK7_CS3_LOWER,
+	/**	Capacitive sensor 4 upper threshold reached (SK7 only) */
+	SK7_CS4_UPPER,
+	/** Capacitive sensor 4 lower threshold reached (SK7 only) */
+	SK7_CS4_LOWER,
+	/**	Capacitive sensor 5 upper threshold reached (SK7 only) */
+	SK7_CS5_UPPER,
+	/** Capacitive sensor 5 lower threshold reached (SK7 only) */
+	SK7_CS5_LOWER,
+	/**	Capacitive sensor 6 upper threshold reached (SK7 only) */
+	SK7_CS6_UPPER,
+	/** Capacitive sensor 6 lower threshold reached (SK7 only) */
+	SK7_CS6_LOWER,
+	/**	Capacitive sensor 7 upper threshold reached (SK7 only) */
+	SK7_CS7_UPPER,
+	/** Capacitive sensor 7 lower threshold reached (SK7 only) */
+	SK7_CS7_LOWER,
+	/**	Capacitive sensor 8 upper threshold reached (SK7 only) */
+	SK7_CS8_UPPER,
+	/** Capacitive sensor 8 lower threshold reached (SK7 only) */
+	SK7_CS8_LOWER,
+	/**	Capacitive sensor 9 upper threshold reached (SK7 only) */
+	SK7_CS9_UPPER,
+	/** Capacitive sensor 9 lower threshold reached (SK7 only) */
+	SK7_CS9_LOWER,
+	/**	Capacitive sensor 10 upper threshold reached (SK7 only) */
+	SK7_CSA_UPPER,
+	/** Capacitive sensor 10 lower threshold reached (SK7 only) */
+	SK7_CSA_LOWER,
+	/**	Capacitive sensor 11 upper threshold reached (SK7 only) */
+	SK7_CSB_UPPER,
+	/** Capacitive sensor 11 lower threshold reached (SK7 only) */
+	SK7_CSB_LOWER,
+	/** Everything in a replayed recording has been parsed (see shake_init_device_replay()) */
+	SHAKE_REPLAY_COMPLETE,
+};
+
+/** Ways of replaying a recording, see shake_init_device_replay(). */
+enum shake_replay_modes {
+	/** Data is passed to the driver as fast as it can parse it, for offline processing and benchmarking */
+	SHAKE_REPLAY_UNTHROTTLED = 0,
+	/** Data arrives at the same rate it was recorded at */
+	SHAKE_REPLAY_REALTIME,
+	/** Data arrives at a multiple of the rate it was recorded at */
+	SHAKE_REPLAY_SPEED,
+};
+
+/** Progress of a command sent with shake_read_async() or shake_write_async(), see shake_future. */
+enum shake_command_status {
+	/** No reply has arrived yet */
+	SHAKE_COMMAND_PENDING = 0,
+	/** The device accepted the command (ACK) */
+	SHAKE_COMMAND_ACK,
+	/** The device rejected the command (NAK) */
+	SHAKE_COMMAND_NAK,
+	/** No reply arrived in time, or the device was closed first */
+	SHAKE_COMMAND_TIMEOUT,
+};
+
+/**	These are the set of optional modules that can be installed in the SHAKE SK6.
+*	They are divided into two sets, one for each of the two available slots.
+*	Most modules will only fit into one slot, eg the RFID module can only be installed
+*	in slot 1. To check which module(s) are installed in a SHAKE, use the
+*	shake_info_module_slot1() and shake_info_module_slot2() functions. Each function will
+*	a value from the enumeration indicating which module is installed in the selected slot.
+*	If no module is installed, the value SHAKE_MODULE_NONE is returned. */
+enum sk6_optional_modules {
+	/** indicates no module is installed */
+	SK6_MODULE_NONE = 0,
+
+	/** slot 1; G-01 gyro module */
+	SK6_MODULE_GYRO1 = 1,		
+	/** slot 1; G-02 gyro module */
+	SK6_MODULE_GYRO2,			
+	/** slot 1; RFID module */
+	SK6_MODULE_RFID,	
+
+	
+	/** slot 2; audio module */
+	SK6_MODULE_AUDIO,	
+	/** slot 2; external vibration module */
+	SK6_MODULE_EXTVIB,
+	/** slot 2; usb module (none of these yet) */
+	SK6_MODULE_USB,	
+	/** slot 2; expansion module (STANE) */
+	SK6_MODULE_EXPANSION,
+	
+	SK6_MODULE_LAST,
+};
+
+// TODO
+enum sk7_optional_modules {
+	SK7_MODULE_NONE = SK6_MODULE_LAST+1,
+
+	SK7_MODULE_LAST,
+};
+
+/**	Valid values for the device_type parameter for all shake_init_device functions */
+enum shake_device_types {
+	SHAKE_SK6 = 0,
+	SHAKE_SK7 = 1,
+};
+
+/** Instances of this structure represent a connection to a single SHAKE device. 
+*	A succesful call to shake_init_device() will return a pointer to an instance of this structure. 
+*	The application using the driver then has to pass this pointer as the first parameter when calling 
+*	other SHAKE functions */
+typedef struct {
+	/** device ID number. */
+	int handle; 		
+	/** Pointer to internal data. */
+	void* priv;			
+} shake_device;
+
+#include "shake_registers.h"
+
+/*	=== Startup/shutdown functions === */
+
+// NOTE:
+//	valid forms for bluetooth address string in rfcomm funcs:
+//		1. "aabbccddeeff"
+//		2. "0xaabbccddeeff"
+//		3. "aa:bb:cc:dd:ee:ff"
+//	ALL LETTERS MUST BE LOWER CASE FOR NOW
+
+#ifdef _WIN32
+/**	(Windows only) Creates a connection to a SHAKE device.
+*	This function attempts to create a Bluetooth connection to a SHAKE device. Typically on a 
+*	Windows system you cannot specify a Bluetooth name or hardware address, so the only parameter
+*	required is the outgoing COM port number to connect to the device through (see SHAKE user manual)
+*	@param com_port The COM port number (accepted range is -1 to autodetect, else 1-100)
+*	@param device_type indicates if the target is an SK6 or SK7
+*
+*	@return NULL on failure, otherwise a pointer to a shake_device structure */
+SHAKE_API shake_device* shake_init_device(int com_port, int device_type);
+
+/**	(Windows XP SP2 / Windows Mobile 5) Creates a connection to a SHAKE device.
+*	Unlike the shake_init_device() function, this function uses the Microsoft Bluetooth API to
+*	open an RFCOMM connection to a specific SHAKE device, currently specified by a numeric 
+*	Bluetooth address. 
+*	This function will not work if you are using non-Microsoft Bluetooth drivers!
+*	@param btaddr Bluetooth MAC address of the target SHAKE
+*	@param device_type indicates if the target is an SK6 or SK7
+*	
+*	@return NULL on failure, otherwise a pointer to a shake_device structure */
+
+SHAKE_API shake_device* shake_init_device_rfcomm_i64(SHAKE_INT64 btaddr, int device_type);
+SHAKE_API shake_device* shake_init_device_rfcomm_str(char* btaddr, int device_type);
+
+#else
+/*	++ Linux only ++
+*	Main initialisation function for setting up a link to a SHAKE device.
+*	<btaddr> is the Bluetooth MAC address of the device to connect to, 
+*	given in string format (eg "12:34:56:78:90:ab")
+*	
+*	Returns NULL on failure, otherwise a pointer to a shake_device 
+*	structure which can then be passed to the functions below. */
+SHAKE_API shake_device* shake_init_device_rfcomm_i64(SHAKE_INT64 btaddr, int device_type);
+SHAKE_API shake_device* shake_init_device_rfcomm_str(char* btaddr, int device_type);
+#endif
+
+#ifndef _WIN32
+SHAKE_API shake_device* shake_init_device_usb_serial(char* usb_dev, int device_type);
+#endif
+
+/**	(Linux only) Creates a connection to a SHAKE device over a stream socket that is already 
+*	connected, eg one end of an AF_UNIX socketpair(). The socket is handled exactly like an RFCOMM
+*	connection, so this can stand in for one when testing without Bluetooth hardware.
+*	The driver owns the socket afterwards, and closes it in shake_free_device().
+*	@param sock the connected socket
+*	@param device_type indicates if the target is an SK6 or SK7
+*
+*	@return NULL on failure, otherwise a pointer to a shake_device structure */
+SHAKE_API shake_device* shake_init_device_socket(int sock, int device_type);
+
+/**	Only for debugging use. Replays <readfile> in SHAKE_REPLAY_REALTIME mode (see shake_init_device_replay()),
+*	and writes any commands sent to the device into <writefile>. */
+SHAKE_API shake_device* shake_init_device_DEBUGFILE(char* readfile, char* writefile, int device_type);
+
+/**	Opens a recording of the data sent by a SHAKE, and replays it through the driver as if it 
+*	was arriving from a real device. The file can either be a plain copy of the data, or a capture
+*	file with the time each chunk of data arrived. Plain files are replayed at the speed of the 
+*	device's serial link, capture files at the speed the data was recorded at.
+*
+*	When the whole file has been parsed the replay stops. The event callback (if any) is then called
+*	with SHAKE_REPLAY_COMPLETE, and shake_replay_complete() starts returning 1. The device can 
+*	be closed with shake_free_device() at any time. Commands sent to the device are discarded.
+*	@param readfile the file to replay
+*	@param device_type indicates if the recording is from an SK6 or SK7
+*	@param mode one of the values from shake_replay_modes
+*	@param speed for SHAKE_REPLAY_SPEED, how many times faster than real time to replay the data 
+*		(eg 0.5 for half speed). Ignored for the other modes.
+*
+*	@return NULL on failure, otherwise a pointer to a shake_device structure */
+SHAKE_API shake_device* shake_init_device_replay(char* readfile, int device_type, int mode, float speed);
+
+/**	Checks if a device opened with shake_init_device_replay() or shake_init_device_DEBUGFILE() has 
+*	reached the end of its recording.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device_replay()
+*
+*	@return 1 if everything in the file has been parsed, 0 if not, SHAKE_ERROR if the device isn't 
+*	replaying a file */
+SHAKE_API int shake_replay_complete(shake_device* sh);
+
+/**	Starts recording everything passing over the connection to a device into a capture file: 
+*	each chunk of data as it arrives from the device, and each command sent to it, along with 
+*	the time it happened. The file can be replayed with shake_init_device_replay() to repeat the 
+*	session exactly, timing included (the commands are skipped when replaying).
+*
+*	The file is written by a separate thread, so recording doesn't slow down the handling of 
+*	incoming data. If the disk can't keep up, chunks are dropped rather than holding up the 
+*	driver, see shake_capture_stop(). Starting a new recording stops any recording in progress.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param filename (optional path) and filename of the capture file to create
+*
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if the file couldn't be created */
+SHAKE_API int shake_capture_start(shake_device* sh, char* filename);
+
+/**	Stops a recording started by shake_capture_start(), once everything recorded so far has been
+*	written to the file. Also called by shake_free_device().
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*
+*	@return the number of chunks of data that had to be dropped from the recording (normally 0),
+*	or SHAKE_ERROR if nothing was being recorded */
+SHAKE_API int shake_capture_stop(shake_device* sh);
+
+/**
+*	Close the link with a SHAKE device and free up any resources used in maintaining the connection.
+*	Must not be called from a callback function run with SHAKE_DISPATCH_THREAD or SHAKE_DISPATCH_INLINE,
+*	since the threads running those are stopped here; it returns SHAKE_ERROR and leaves the device open.
+*	From a SHAKE_DISPATCH_POOL callback the device is closed straight away, and its memory is freed
+*	once the callback returns.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*
+*	@return SHAKE_SUCCESS on success, SHAKE_ERROR on failure. */
+SHAKE_API int shake_free_device(shake_device* sh);
+
+/**	Sets the size of the operating system's receive buffer (SO_RCVBUF) for an RFCOMM or socket 
+*	connection. This is what holds incoming data while the driver is busy, so a larger buffer 
+*	helps avoid losing packets at high data rates. By default the system setting is used.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param bytes requested size in bytes. The system may adjust this (Linux doubles it)
+*
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if the size couldn't be set or the device isn't 
+*	connected over a socket */
+SHAKE_API int shake_set_receive_buffer(shake_device* sh, int bytes);
+
+/**	Switches the driver into reactor mode (Linux only), for applications using many devices at once.
+*	Normally each device gets its own reader thread and event callback thread. Once this has been 
+*	called, USB serial and RFCOMM devices opened with the shake_init_device functions are instead 
+*	shared between <num_threads> reactor threads, each of which waits for data from all of its 
+*	devices at once with epoll and parses whatever has arrived. Event callbacks for the devices 
+*	on a reactor thread are made from one extra thread belonging to that reactor thread, unless
+*	changed with shake_set_event_dispatch(). 
+*	Devices opened before this call, and other types of connection, carry on using their own threads.
+*
+*	@param num_threads number of reactor threads to start (1 is enough for dozens of devices)
+*	@param pin_threads if nonzero, reactor thread i only runs on CPU i (wrapping round if there are 
+*		more threads than CPUs)
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if reactor mode is already running or isn't supported */
+SHAKE_API int shake_reactor_start(int num_threads, int pin_threads);
+
+/**	Stops the reactor threads started by shake_reactor_start(), so devices opened after this get 
+*	their own threads again. Every device using the reactor must have been closed with 
+*	shake_free_device() first.
+*
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if the reactor isn't running or still has devices */
+SHAKE_API int shake_reactor_stop();
+
+/* === SHAKE miscellaneous functions === */
+
+/**	Query SHAKE firmware revision number.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE firmware revision number (format is x.yz), or 0.0 on error. */
+SHAKE_API float shake_info_firmware_revision(shake_device* sh);
+
+/**	Query SHAKE hardware revision number.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE hardware revision number (format is x.yz), or 0.0 on error. */
+SHAKE_API float shake_info_hardware_revision(shake_device* sh);
+
+/**	Query SHAKE serial number.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return pointer to a null terminated string containing the SHAKE serial number. Format is
+*	SK6-xxxx, eg SK6-0003. Do not modify or attempt to deallocate the returned string. 
+*	On error, NULL is returned. */
+SHAKE_API char* shake_info_serial_number(shake_device* sh);
+
+/**	Query SHAKE Bluetooth firmware revision (SK7 only)
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE hardware revision number (format is x.yz), or 0.0 on error. */
+SHAKE_API float shake_info_bluetooth_firmware_revision(shake_device* sh);
+
+/**	Query SHAKE slot1 expansion module
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return one of the values in the ::shake_optional_modules enumeration, indicating the type of module installed 
+*	On error, SHAKE_ERROR is returned */
+SHAKE_API int shake_info_module_slot1(shake_device* sh);
+
+/**	Query SHAKE slot2 expansion module
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return one of the values in the ::shake_optional_modules enumeration, indicating the type of module installed 
+*	On error, SHAKE_ERROR is returned */
+SHAKE_API int shake_info_module_slot2(shake_device* sh);
+
+/**	Query SHAKE expansion module for a particular slot. For the SK6, valid values are 0-1. For the SK7, 0-3.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return one of the values in the ::sk6_optional_modules or ::sk7_optional_modules enumeration, indicating the type of module installed 
+*	On error, SHAKE_ERROR is returned */
+SHAKE_API int shake_info_module(shake_device* sh, int slot_number);
+
+/**	Returns a string name for a SHAKE expansion module.
+*	@param module a value returned from shake_info_module_slot1() or shake_info_module_slot2
+*	@return pointer to a string containing the name of the specified module, eg "RFID module" */
+SHAKE_API char* shake_info_module_name(int module);
+
+/**	Requests device specific information from the connected SHAKE, including firmware and hardware versions plus
+*	the serial number. After successfully calling this function, you can retrieve the information about the device
+*	using the other functions with prefix shake_info, eg shake_info_firmware_revision(). You can also call these
+*	functions directly, this function will be called internally if necessary. 
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_info_retrieve(shake_device* sh);
+
+/**	Reset various registers on the SHAKE to their default values. If a SHAKE has stopped outputting sensor data
+*	or is otherwise behaving abnormally, using this function may solve the problem. It may need to be called several
+*	times to take effect completely.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param repeat if >0, the reset process will be repeated <repeat> times
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_factory_reset(shake_device* sh, int repeat);
+
+/** Allows you to register a callback function for receiving events from the SHAKE.
+*	The callback function should have the signature:
+*	
+*	void callback(shake_device* dev, int event)
+*
+*	The event parameter will be one of the ::shake_events constants indicating the type of event, 
+*	and the dev parameter will be the shake_device object that received the event.
+*	To unregister the callback, call the function again with a NULL parameter. 
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param callback pointer to user specified callback function
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_register_event_callback(shake_device* sh, void (SHAKE_CALLBACK *callback)(shake_device*, int));
+
+/**	Allows you to control whether the driver will wait for acknowledgement packets when sending
+*	commands to the SHAKE. The default is to enable this functionality as it can be used to confirm
+*	whether a command succeeded or not. Register read commands will always wait for acknowledgements
+*	since the acknowledgement contains the contents of the requested register.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param wait_for_ack zero to disable waiting for ACKs, nonzero to enable 
+*
+*	@return */
+SHAKE_API void shake_wait_for_acks(shake_device* sh, int wait_for_ack);
+
+/**	Allows you to override the LED colour of the SHAKE (SK7 only!)
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()	
+*	@param red red value (1-255)
+*	@param green green value (1-255)
+*	@param blue blue (1-255)
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk7_override_led(shake_device* sh, unsigned char red, unsigned char green, unsigned char blue);
+
+#ifdef _WIN32
+/** Identical to the shake_register_event_callback() function in every way, except that it accepts a pointer to
+*	a callback function using the stdcall calling convention, while shake_register_event_callback requires a cdecl
+*	function pointer. 
+*
+*	While both callbacks can be registered separately, in virtually all cases only one should be required.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param callback pointer to user specified callback function (with stdcall calling convention)
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_register_event_callback_STDCALL(shake_device* sh, void (SHAKE_STDCALL_CALLBACK *callback)(shake_device*, int));
+#endif
+
+/*	=== SHAKE event delivery ===
+*	Events are queued as they arrive (up to SHAKE_EVENT_QUEUE_SIZE per device, so two events
+*	arriving close together are both delivered) and passed to the callbacks in order, in batches
+*	of up to SHAKE_EVENT_BATCH_MAX. If the callbacks fall so far behind that the queue fills, 
+*	further events are dropped and counted in shake_stats. */
+
+/** most events that can be waiting for delivery from one device */
+#define SHAKE_EVENT_QUEUE_SIZE 256
+
+/** most events passed to a batch callback in one call */
+#define SHAKE_EVENT_BATCH_MAX 32
+
+/** A single event, see shake_register_event_batch_callback(). */
+typedef struct {
+	/** one of the ::shake_events constants */
+	int type;
+	/** host time the packet carrying the event was received, on the same clock as shake_sample timestamps */
+	double timestamp;
+} shake_event;
+
+/**	Called with a batch of events from the SHAKE, oldest first.
+*	@param sh the device the events came from
+*	@param events the events, only valid until the callback returns
+*	@param count number of events, from 1 to SHAKE_EVENT_BATCH_MAX
+*	@param user the <user> pointer passed to shake_register_event_batch_callback() */
+typedef void (SHAKE_CALLBACK *shake_event_batch_callback)(shake_device* sh, shake_event* events, int count, void* user);
+
+/**	Registers a callback which receives events in batches, with the time each one arrived. While it
+*	is registered it is called instead of the callback set with shake_register_event_callback().
+*	To unregister the callback, call the function again with a NULL callback.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param callback pointer to user specified callback function
+*	@param user passed to each call of <callback>
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_register_event_batch_callback(shake_device* sh, shake_event_batch_callback callback, void* user);
+
+/** Threads the event callbacks can be called from, see shake_set_event_dispatch(). */
+enum shake_event_dispatch_modes {
+	/**	the device's own callback thread, or the callback thread of its reactor thread if the device
+	*	is run by one (see shake_reactor_start()). This is the default */
+	SHAKE_DISPATCH_THREAD = 0,
+	/** a pool of threads shared by all the devices using it, see shake_event_pool_start() */
+	SHAKE_DISPATCH_POOL,
+	/**	the thread that reads data from the device, as soon as each event has been parsed. This has
+	*	the lowest latency, but no more data is read until the callback returns, so it must be quick, 
+	*	and it must not call functions that wait for a reply from the device (eg shake_read()) */
+	SHAKE_DISPATCH_INLINE,
+};
+
+/**	Chooses the thread the event callbacks for a device are called from. Callbacks for a device
+*	are never made from two threads at once, and always arrive in order.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param mode one of the ::shake_event_dispatch_modes values
+*
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if <mode> is SHAKE_DISPATCH_POOL and the pool
+*	hasn't been started */
+SHAKE_API int shake_set_event_dispatch(shake_device* sh, int mode);
+
+/**	Starts a pool of threads to call the event callbacks of any devices switched to 
+*	SHAKE_DISPATCH_POOL. This saves having a thread per device waiting for events when many
+*	devices are open at once.
+*	@param num_threads number of threads in the pool
+*
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if the pool is already running */
+SHAKE_API int shake_event_pool_start(int num_threads);
+
+/**	Stops the threads started by shake_event_pool_start(). Any devices still using the pool
+*	must be switched to another mode or freed first.
+*
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if the pool isn't running or devices are still using it */
+SHAKE_API int shake_event_pool_stop();
+
+/* === SHAKE audio functions === */
+
+/*	Allows you to register a callback function for receiving audio data from SHAKEs with modified hardware.
+*	The callback function should have the signature:
+*
+*	void callback(shake_device* dev, short* mic_samples, int mic_length, short* playback_samples, int playback_length);
+*
+*	The 'dev' parameter will be the shake_device* object that received the audio data. The 'mic_samples' parameter
+*	will be a pointer to the latest set of audio samples, while the 'mic_length' parameter gives the number
+*	of SAMPLES (ie not the number of bytes). The samples are provided in 16-bit signed PCM format, and can
+*	be played back or written to a .wav file directly without any further conversion. The 'playback_samples' parameter
+*	will be a pointer to a buffer where you can optionally place a new set of audio data to be played back on the SHAKE.
+*	The 'playback_length' parameter gives the number of samples to write (again, not bytes). The samples should be 16-bit
+*	signed PCM.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param callback pointer to user specified callback function
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_register_audio_callback(shake_device* sh, void (SHAKE_CALLBACK *callback)(shake_device*, short*, int, short*, int));
+
+#ifdef _WIN32
+/** Identical to the shake_register_audio_callback() function in every way, except that it accepts a pointer to
+*	a callback function using the stdcall calling convention, while shake_register_audio_callback requires a cdecl
+*	function pointer. 
+*
+*	While both callbacks can be registered separately, in virtually all cases only one should be required.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param callback pointer to user specified callback function (with stdcall calling convention)
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_register_audio_callback_STDCALL(shake_device* sh, void (SHAKE_STDCALL_CALLBACK *callback)(shake_device*, short*, int, short*, int));
+#endif
+
+/** Ways of filling in microphone audio lost on the way from the SHAKE, see shake_enable_mic_buffer(). */
+enum shake_mic_concealment {
+	/** lost audio is left out, so the samples either side of the gap run together */
+	SHAKE_MIC_CONCEAL_NONE = 0,
+	/** lost audio is replaced with silence, keeping the stream in step with the SHAKE's clock */
+	SHAKE_MIC_CONCEAL_SILENCE,
+	/** lost audio is replaced with copies of the last packet received, halving in volume each time */
+	SHAKE_MIC_CONCEAL_REPEAT,
+};
+
+/** Default number of samples held by the microphone buffer (a little over a second at SHAKE_AUDIO_SAMPLE_RATE) */
+#define SHAKE_MIC_DEFAULT_BUFFER_SIZE 8192
+
+/** Default time a packet of microphone audio can be held up on the way before it counts as lost, in milliseconds */
+#define SHAKE_MIC_DEFAULT_JITTER_MS 100
+
+/** Largest block of samples that can be passed to a microphone callback */
+#define SHAKE_MIC_BLOCK_MAX 2048
+
+/**	Stores microphone audio from an SK6 in a buffer instead of passing it to the audio callback
+*	(see shake_register_audio_callback()) as each packet arrives. The application can then read
+*	as many samples as it likes at a time with shake_read_mic(), or have larger blocks passed to
+*	a callback with shake_register_mic_callback(), without holding up the thread reading data
+*	from the device. If the buffer fills up, new audio is discarded and counted.
+*
+*	Microphone packets don't carry sequence numbers, so lost packets are spotted from their
+*	arrival times instead: once the driver has measured the packet rate, a packet which arrives
+*	more than \a jitter_ms later than expected is taken to follow some lost ones, and the gap
+*	is filled in as \a concealment says. Silences of over a second are taken to mean the
+*	microphone was switched off, and are never filled in.
+*
+*	The buffer is allocated the first time this is called and is kept until the device is
+*	freed, so \a size can't be changed once it has been set. Calling the function again with
+*	the same size (or 0) re-enables or disables the buffer, and changes the other settings.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param size number of samples the buffer can hold, rounded up to a power of 2. 0 disables
+*	the buffer and goes back to using the audio callback.
+*	@param jitter_ms how late a packet can arrive before it is taken to follow lost ones, in
+*	milliseconds. Shorter times catch smaller gaps but mistake more delays for losses
+*	@param concealment one of the ::shake_mic_concealment values
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR (including if the device isn't an SK6) */
+SHAKE_API int shake_enable_mic_buffer(shake_device* sh, int size, int jitter_ms, int concealment);
+
+/**	Copies microphone audio from the buffer created by shake_enable_mic_buffer() into \a samples,
+*	oldest first. If fewer than \a num_samples samples are waiting, this waits up to \a timeout_ms
+*	for the rest to arrive, and then copies whatever there is.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param samples pointer to an array of at least \a num_samples 16-bit signed PCM samples
+*	@param num_samples number of samples wanted, no more than the size of the buffer
+*	@param timeout_ms maximum time to wait in milliseconds, 0 to return straight away or -1 to
+*	wait indefinitely
+*	@return the number of samples copied into \a samples, or SHAKE_ERROR if the buffer isn't
+*	enabled, a microphone callback is registered or \a num_samples is larger than the buffer */
+SHAKE_API int shake_read_mic(shake_device* sh, short* samples, int num_samples, int timeout_ms);
+
+/**	Returns the number of samples waiting in the buffer created by shake_enable_mic_buffer().
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return number of samples, or SHAKE_ERROR */
+SHAKE_API int shake_mic_available(shake_device* sh);
+
+/**	Called with a block of microphone audio, see shake_register_mic_callback().
+*	@param sh the device the audio came from
+*	@param samples 16-bit signed PCM samples at SHAKE_AUDIO_SAMPLE_RATE, only valid until the callback returns
+*	@param count number of samples, always the block size the callback was registered with
+*	@param user the <user> pointer passed to shake_register_mic_callback() */
+typedef void (SHAKE_CALLBACK *shake_mic_callback)(shake_device* sh, short* samples, int count, void* user);
+
+/**	Registers a callback which is passed the audio from the buffer created by shake_enable_mic_buffer()
+*	in blocks of \a block_size samples. It is called from the same thread as the event callbacks
+*	(see shake_set_event_dispatch()), never from the thread reading data from the device unless
+*	SHAKE_DISPATCH_INLINE is in use. While it is registered shake_read_mic() can't be used.
+*	To unregister the callback, call the function again with a NULL callback. This waits for 
+*	any event or microphone callback of the device in progress to return, so it mustn't be 
+*	called from one of them.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param callback pointer to user specified callback function
+*	@param block_size number of samples passed to each call, from 1 to SHAKE_MIC_BLOCK_MAX
+*	@param user passed to each call of <callback>
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_register_mic_callback(shake_device* sh, shake_mic_callback callback, int block_size, void* user);
+
+/** Microphone packet counts, filled in by shake_get_mic_stats(). */
+typedef struct {
+	/** number of packets of audio received (each SHAKE_AUDIO_DATA_LEN samples) */
+	unsigned int received;
+	/** number of packets thought to have been lost, judging by the gaps between the others */
+	unsigned int lost;
+	/** number of packets' worth of audio added to the buffer to fill in for lost ones */
+	unsigned int concealed;
+	/** number of samples discarded because the buffer was full */
+	unsigned int overflows;
+} shake_mic_stats;
+
+/**	Returns the microphone packet counts since shake_enable_mic_buffer() was first called.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param stats pointer to a shake_mic_stats structure to fill in
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_get_mic_stats(shake_device* sh, shake_mic_stats* stats);
+
+/** What to send when the SHAKE asks for playback audio that isn't there, see shake_enable_playback_buffer(). */
+enum shake_playback_fill {
+	/** a packet of silence, after any samples left in the buffer */
+	SHAKE_PLAYBACK_FILL_SILENCE = 0,
+	/** nothing, unless there are some samples left in the buffer (which are padded out with silence) */
+	SHAKE_PLAYBACK_FILL_NONE,
+};
+
+/** Default number of samples held by the playback buffer (a little over a second at SHAKE_AUDIO_SAMPLE_RATE) */
+#define SHAKE_PLAYBACK_DEFAULT_BUFFER_SIZE 8192
+
+/** Default number of samples the playback buffer must hold before playback starts (200ms at SHAKE_AUDIO_SAMPLE_RATE) */
+#define SHAKE_PLAYBACK_DEFAULT_PREFILL 1440
+
+/**	Plays audio written in advance with shake_write_playback() on an SK6, instead of asking the
+*	audio callback (see shake_register_audio_callback()) for each packet as the SHAKE requests
+*	it. The audio is compressed as it is written, so all the thread reading data from the device
+*	has to do when the SHAKE asks for more is send the next packet from the buffer.
+*
+*	Playback waits until \a prefill samples have been written, to give the application some
+*	leeway. If the buffer then runs dry, the shortfall is counted as an underrun and made up as
+*	\a fill says, and playback waits for the buffer to reach \a prefill samples again. A clip
+*	shorter than \a prefill is never started, so use a smaller value for short sounds.
+*
+*	The buffer is allocated the first time this is called and is kept until the device is
+*	freed, so \a size can't be changed once it has been set. Calling the function again with
+*	the same size (or 0) re-enables or disables the buffer, and changes the other settings.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param size number of samples the buffer can hold, rounded up to a power of 2. 0 disables
+*	the buffer and goes back to using the audio callback.
+*	@param prefill number of samples that must be waiting before playback (re)starts, from 0 to \a size
+*	@param fill one of the ::shake_playback_fill values
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR (including if the device isn't an SK6) */
+SHAKE_API int shake_enable_playback_buffer(shake_device* sh, int size, int prefill, int fill);
+
+/**	Adds audio to the end of the buffer created by shake_enable_playback_buffer(). If there isn't
+*	room for all of \a samples, this waits up to \a timeout_ms for the SHAKE to play enough of
+*	what is already there, and then adds as much as it can. Only one thread should write to
+*	the buffer at a time.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param samples pointer to an array of \a num_samples 16-bit signed PCM samples at SHAKE_AUDIO_SAMPLE_RATE
+*	@param num_samples number of samples to add
+*	@param timeout_ms maximum time to wait in milliseconds, 0 to return straight away or -1 to
+*	wait indefinitely
+*	@return the number of samples added, or SHAKE_ERROR if the buffer isn't enabled */
+SHAKE_API int shake_write_playback(shake_device* sh, const short* samples, int num_samples, int timeout_ms);
+
+/**	Returns the number of samples that can be added to the buffer created by shake_enable_playback_buffer()
+*	without waiting.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return number of samples, or SHAKE_ERROR */
+SHAKE_API int shake_playback_space(shake_device* sh);
+
+/** Playback packet counts, filled in by shake_get_playback_stats(). */
+typedef struct {
+	/** number of packets of audio from the buffer sent to the SHAKE (each SHAKE_AUDIO_DATA_LEN samples) */
+	unsigned int sent;
+	/** number of times the buffer ran dry during playback */
+	unsigned int underruns;
+	/** number of packets of silence sent because there wasn't enough audio in the buffer */
+	unsigned int filled;
+} shake_playback_stats;
+
+/**	Returns the playback packet counts since shake_enable_playback_buffer() was first called.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param stats pointer to a shake_playback_stats structure to fill in
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_get_playback_stats(shake_device* sh, shake_playback_stats* stats);
+
+/** State of the current or last sample upload, see shake_upload_stats. */
+enum shake_upload_status {
+	/** no upload has been started on this device */
+	SHAKE_UPLOAD_IDLE = 0,
+	/** an upload is in progress */
+	SHAKE_UPLOAD_RUNNING,
+	/** every page was acknowledged by the SHAKE */
+	SHAKE_UPLOAD_DONE,
+	/** a page was still rejected after being retried, or the connection failed */
+	SHAKE_UPLOAD_FAILED,
+	/** the upload was stopped by shake_cancel_upload() */
+	SHAKE_UPLOAD_CANCELLED,
+};
+
+/** Default number of pages that can be waiting for a reply from the SHAKE at once during an upload */
+#define SHAKE_UPLOAD_DEFAULT_WINDOW 2
+
+/** Default number of times a page is sent again after a NAK or timeout before an upload gives up */
+#define SHAKE_UPLOAD_DEFAULT_RETRIES 3
+
+/** Default time (ms) the driver waits for the reply to each page, from when the page has been sent */
+#define SHAKE_UPLOAD_DEFAULT_TIMEOUT_MS 1000
+
+/** Progress of a sample upload, filled in by shake_get_upload_stats() and passed to a shake_upload_callback. */
+typedef struct {
+	/** one of the ::shake_upload_status values */
+	int status;
+	/** number of pages being uploaded */
+	int pages_total;
+	/** number of pages acknowledged by the SHAKE so far */
+	int pages_done;
+	/** number of pages sent so far, including pages sent again */
+	int pages_sent;
+	/** number of times the upload went back to an earlier page after a NAK or timeout */
+	int retries;
+	/** time in seconds since the upload started, or that it took once it has finished */
+	double elapsed;
+	/** sample data acknowledged per second (SHAKE_UPLOAD_PAGE_SIZE bytes per page) */
+	double bytes_per_sec;
+} shake_upload_stats;
+
+/**	Called by shake_upload_audio() and shake_exp_upload_vib() each time more pages are known to 
+*	have been stored by the SHAKE (see shake_set_upload_options()). It is called on the thread 
+*	doing the upload, so it can safely update a progress display
+*	or call shake_cancel_upload(), but the next page isn't sent until it returns.
+*	@param sh the device the sample is being uploaded to
+*	@param progress the progress of the upload so far
+*	@param user the <user> pointer passed to the upload function */
+typedef void (SHAKE_CALLBACK *shake_upload_callback)(shake_device* sh, const shake_upload_stats* progress, void* user);
+
+/**	Changes how samples are uploaded by the functions below. An upload sends the first \a window
+*	pages without waiting for any replies, and then a new page each time the oldest one is 
+*	acknowledged, so the SHAKE can be storing one page while the next is on its way.
+*
+*	The replies from the SHAKE don't say which page they are for, so a page that goes missing 
+*	can make the replies to later pages look like replies to earlier ones. The pages are 
+*	therefore sent in groups of up to 8 windows' worth, and the upload lets the replies to each 
+*	group arrive before moving on. If a page was rejected or a reply didn't arrive within 
+*	\a timeout_ms, the upload goes back to the first page that might not have been stored and 
+*	sends it and the pages after it again, up to \a retries times per page.
+*
+*	Pages are written in chunks of \a chunk_size bytes with a pause of \a delay_ms after each 
+*	one, so the SHAKE's serial buffers aren't overrun. A \a chunk_size of 0 writes each page in
+*	one go. The defaults (SHAKE_UPLOAD_CHUNK_SIZE and SHAKE_UPLOAD_DELAY) are safe for every
+*	firmware version but account for most of the time an upload takes.
+*
+*	Pass -1 for any value to use its default. The options can't be changed during an upload.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param window number of pages waiting for a reply at once, from 1 to SHAKE_COMMAND_MAX_WINDOW (default SHAKE_UPLOAD_DEFAULT_WINDOW)
+*	@param retries times each page can be sent again (default SHAKE_UPLOAD_DEFAULT_RETRIES)
+*	@param timeout_ms time to wait for the reply to each page (default SHAKE_UPLOAD_DEFAULT_TIMEOUT_MS)
+*	@param chunk_size bytes written at a time (default SHAKE_UPLOAD_CHUNK_SIZE)
+*	@param delay_ms pause after each chunk (default SHAKE_UPLOAD_DELAY)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_set_upload_options(shake_device* sh, int window, int retries, int timeout_ms, int chunk_size, int delay_ms);
+
+/**	Stops the upload in progress on a device before it sends another page. The upload function
+*	returns SHAKE_ERROR once the replies to the pages already sent have arrived, leaving the 
+*	status as SHAKE_UPLOAD_CANCELLED. Can be called from any thread, including from the 
+*	upload's shake_upload_callback.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if no upload was in progress */
+SHAKE_API int shake_cancel_upload(shake_device* sh);
+
+/**	Returns the progress of the upload in progress on a device, or of the last one if none is
+*	in progress. Can be called from any thread.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param stats pointer to a shake_upload_stats structure to fill in
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_get_upload_stats(shake_device* sh, shake_upload_stats* stats);
+
+/**	Uploads an audio sample to the internal memory of the SHAKE.
+*	NOTE: this functionality shares memory with data logging, do not use both at the same time!
+*	
+*	The SHAKE has 8000 "pages" of memory for audio, each containing 1056 samples.
+*	Once uploaded successfully, samples can be played back using the shake_play_audio_sample() function.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param address the page number to upload the sample to (valid range is SHAKE_UPLOAD_MIN_PAGE to SHAKE_UPLOAD_MAX_PAGE)
+*	@param sample_data pointer to the audio data in 16 bit signed format. The data will be compressed to an 8-bit format
+*	before transmission. 
+*	@param sample_len length of the audio data in samples (not bytes). If this is less than SHAKE_AUDIO_PAGE_SIZE, the remainder
+*	of the sample will be filled with zeroes.
+*	
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_upload_audio_sample(shake_device* sh, unsigned short address, short* sample_data, unsigned short sample_len);
+
+/**	Uploads an audio sample of any length to the internal memory of the SHAKE, as 
+*	shake_upload_audio_sample() does, using the options set by shake_set_upload_options().
+*	Only one upload can run on a device at a time.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param address the first page to upload the sample to (the sample must end by SHAKE_UPLOAD_MAX_PAGE)
+*	@param samples the audio data in 16 bit signed format, which is compressed to 8 bits before it is sent
+*	@param num_samples length of the audio data in samples. The last page is filled up with zeroes.
+*	@param callback optional function called each time a page is acknowledged
+*	@param user passed to \a callback
+*
+*	@return SHAKE_SUCCESS if every page was acknowledged, SHAKE_ERROR otherwise (see shake_get_upload_stats() for why) */
+SHAKE_API int shake_upload_audio(shake_device* sh, int address, const short* samples, int num_samples, shake_upload_callback callback, void* user);
+
+/**	Plays back an audio sample from the SHAKEs internal memory. The sample can span multiple memory "pages".
+*
+*	Use the shake_write_audio_config() function to enable sample playback before using this function.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param start_address starting page of the audio sample
+*	@param end_address ending page (inclusive) of the audio sample
+*	@param amplitude amplitude for audio playback, valid range is SHAKE_AUDIO_AMPLTIUDE_MIN to SHAKE_AUDIO_AMPLITUDE_MAX inclusive
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_play_audio_sample(shake_device* sh, unsigned short start_address, unsigned short end_address, unsigned short amplitude);
+
+/* === SHAKE Expansion Module functions === */
+
+/**	Uploads a vibration sample to the internal memory of the SHAKE.
+*	NOTE: this functionality shares memory with data logging, do not use both at the same time!
+*	Only available on SHAKEs with expansion module E01
+*	
+*	The SHAKE has 8000 "pages" of memory for vibration data, each containing 1056 samples.
+*	Once uploaded successfully, samples can be played back using the shake_exp_play_vib_sample() function.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param address the page number to upload the sample to (valid range is SHAKE_UPLOAD_MIN_PAGE to SHAKE_UPLOAD_MAX_PAGE)
+*	@param sample_data pointer to the vibration data in linear 8-bit 2's complement signed format.
+*	@param sample_len length of the audio data in samples (not bytes). If this is less than SHAKE_UPLOAD_PAGE_SIZE, the remainder
+*	of the sample will be filled with zeroes.
+*	
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_exp_upload_vib_sample(shake_device* sh, unsigned short address, char* sample_data, unsigned short sample_len);
+
+/**	Uploads a vibration sample of any length to the internal memory of the SHAKE, as 
+*	shake_exp_upload_vib_sample() does, using the options set by shake_set_upload_options().
+*	Only one upload can run on a device at a time.
+*	Only available on SHAKEs with expansion module E01
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param address the first page to upload the sample to (the sample must end by SHAKE_UPLOAD_MAX_PAGE)
+*	@param samples the vibration data in linear 8-bit 2's complement signed format
+*	@param num_samples length of the vibration data in samples. The last page is filled up with zeroes.
+*	@param callback optional function called each time a page is acknowledged
+*	@param user passed to \a callback
+*
+*	@return SHAKE_SUCCESS if every page was acknowledged, SHAKE_ERROR otherwise (see shake_get_upload_stats() for why) */
+SHAKE_API int shake_exp_upload_vib(shake_device* sh, int address, const char* samples, int num_samples, shake_upload_callback callback, void* user);
+
+/**	Plays back a vibration sample from the SHAKEs internal memory. The sample can span multiple memory "pages".
+*	Only available on SHAKEs with expansion module E01
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param start_address starting page of the audio sample
+*	@param end_address ending page (inclusive) of the audio sample
+*	@param amplitude amplitude for audio playback, valid range is SHAKE_AUDIO_AMPLTIUDE_MIN to SHAKE_AUDIO_AMPLITUDE_MAX inclusive
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_exp_play_vib_sample(shake_device* sh, unsigned short start_address, unsigned short end_address, unsigned short amplitude);
+
+/** Writes a value into one of the 6 general purpose registers available on SHAKEs with the E01 module installed.
+*	These can be used to power LEDs or similar devices.
+*	Only available on SHAKEs with expansion module E01
+*
+*	Valid values for each register range from 0-255, representing an output current of 0mA-10mA.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param reg_number the register to update, must be 0-5
+*	@param value the value to write into the selected register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_exp_write_gp_register(shake_device* sh, int reg_number, unsigned value);
+
+
+
+/* === SHAKE data access functions === 
+*	Each of these returns one or more sensor
+*	readings from the given SHAKE device. Every function takes a pointer to
+*	a shake_device structure as returned by shake_init_device. */
+
+/**	Read current x-axis accelerometer value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return current x-axis accelerometer value */
+SHAKE_API int shake_accx(shake_device* sh);
+
+/**	Read current y-axis accelerometer value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return current y-axis accelerometer value */
+SHAKE_API int shake_accy(shake_device* sh);
+
+/**	Read current z-axis accelerometer value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return current z-axis accelerometer value */
+SHAKE_API int shake_accz(shake_device* sh);
+
+/**	Read current accelerometer values.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param xyz pointer to a 3 element array of integers, into which the 3 accelerometer readings will
+*	be placed (in x,y,z order).
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if either parameter is NULL */
+SHAKE_API int shake_acc(shake_device* sh, int* xyz);
+
+/**	Read current x-axis gyroscope value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return current x-axis gyroscope value */
+SHAKE_API int shake_gyrx(shake_device* sh);
+
+/**	Read current y-axis gyroscope value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return current y-axis gyroscope value */
+SHAKE_API int shake_gyry(shake_device* sh);
+
+/**	Read current z-axis gyroscope value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return current z-axis gyroscope value */
+SHAKE_API int shake_gyrz(shake_device* sh);
+
+/**	Read current gyroscope values.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param xyz pointer to a 3 element array of integers, into which the 3 gyroscope readings will
+*	be placed (in x,y,z order).
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if either parameter is NULL */
+SHAKE_API int shake_gyr(shake_device* sh, int* xyz);
+
+/**	Read current x-axis magnetometer value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return current x-axis magnetometer value */
+SHAKE_API int shake_magx(shake_device* sh);
+
+/**	Read current y-axis magnetometer value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return current y-axis magnetometer value */
+SHAKE_API int shake_magy(shake_device* sh);
+
+/**	Read current z-axis magnetometer value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return current z-axis magnetometer value */
+SHAKE_API int shake_magz(shake_device* sh);
+
+/**	Read current magnetometer values.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param xyz pointer to a 3 element array of integers, into which the 3 magnetometer readings will
+*	be placed (in x,y,z order).
+*	@return SHAKE_SUCCESS, or SHAKE_ERROR if either parameter is NULL */
+SHAKE_API int shake_mag(shake_device* sh, int* xyz);
+
+/** Read current compass heading value.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return A value are in the range 0-3599 (tenths of a degree), SHAKE_ERROR otherwise */
+SHAKE_API int shake_heading(shake_device* sh);
+
+/**	SK7 only. Read current roll-pitch-heading values (requires the roll-pitch-heading packet output
+*	to be enabled first, see sk7_configure_roll_pitch_heading). If legacy heading packet output is
+*	enabled, use shake_heading to retrieve that data.
+*	
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param rph pointer to a 3 element array of integers, into which the roll, pitch and heading readings
+*			will be placed (in that order). See the user manual for details of the format of each value.
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk7_roll_pitch_heading(shake_device* sh, int* rph);
+
+/**	SK7 only. Read current roll-pitch-heading values when in quaternion output mode. 
+*	(requires the roll-pitch-heading packet output
+*	to be enabled first, see sk7_configure_roll_pitch_heading). If legacy heading packet output is
+*	enabled, use shake_heading to retrieve that data.
+*	
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param rph pointer to a 4 element array of floats, into which the quaternions will be placed. 
+*										See the user manual for details of the format of each value.
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk7_roll_pitch_heading_quaternions(shake_device* sh, float* rphq);
+
+/**	Decodes comma separated decimal values in the format used by the SK7 quaternion packets 
+*	("+0.70711,-0.00012,+0.70710,+1.00000"). This is the parser the driver uses internally, 
+*	exposed so that the wrappers and other implementations can be checked against the same 
+*	inputs. It does not depend on the C locale and each result is the float nearest to the 
+*	printed decimal value (for up to 18 significant digits). The buffer doesn't need to be 
+*	null terminated. 
+*
+*	@param buf pointer to the ASCII text to decode
+*	@param len number of characters available in buf
+*	@param values pointer to an array of at least count floats to receive the decoded values
+*	@param count maximum number of values to decode
+*	@return the number of values decoded (parsing stops at the first malformed field), or 
+*		SHAKE_ERROR */
+SHAKE_API int shake_parse_decimal_fields(char* buf, int len, float* values, int count);
+
+/** Read the proximity value of the first capacitive sensor.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return A value in the range 0-255 (255 is highest proximity), SHAKE_ERROR otherwise */
+SHAKE_API int sk6_cap0(shake_device* sh);
+
+/** Read the proximity value of the second capacitive sensor.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return A value in the range 0-255 (255 is highest proximity), SHAKE_ERROR otherwise */
+SHAKE_API int sk6_cap1(shake_device* sh);
+
+/** Read the proximity values of both capacitive sensors on the SK6
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param proxboth pointer to a 2 element int array, into which the proximity values will be placed.
+*	in the order cap0, cap1.
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk6_cap(shake_device* sh, int* proxboth);
+
+/** Read the proximity values of all 12 capacitive sensors on the SK7
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param prox pointer to a 12 element int array, into which the proximity values will be placed.
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk7_cap(shake_device* sh, int* prox);
+
+/**	Read capacitive data from one or both blocks on an SK7 external capactive device. 
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param prox pointer to a 12 element int array, into which the proximity values will be placed.
+*	@param blocks the blocks to return data for;	0 for 1st block only (prox array must be >= 12 elements long),
+*													1 for 2nd block only (prox array must be >= 12 elements long),
+*													2 for both blocks (prox array must be >= 24 elements long).
+*	@param prox pointer to an array into which the proximity values will be placed (note length requirements above!)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk7_cap_ext(shake_device* sh, int blocks, int* prox);
+
+/**	Read the current value of the first analog input.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return a value in the range 0-2500 (mV), SHAKE_ERROR on error */
+SHAKE_API int shake_analog0(shake_device* sh);
+
+/**	Read the current value of the second analog input.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return a value in the range 0-2500 (mV), SHAKE_ERROR on error */
+SHAKE_API int shake_analog1(shake_device* sh);
+
+/**	Read the current values of both analog inputs.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param a0a1 pointer to a 2 element int array, into which the two values will be placed, 
+*	in the order analog0, analog1.
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_analog(shake_device* sh, int* a0a1);
+
+/**	Reads the peak acceleration value for the last shaking event detected by the onboard
+*	shake detection algorithm. You should normally call this function from your SHAKE event
+*	callback function, since the values will be updated when a SHAKE_SHAKING_EVENT is received.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return the peak acceleration value in 0.1g units */
+SHAKE_API int shake_shaking_peakaccel(shake_device* sh);
+
+/**	Reads the direction value for the last shaking event detected by the onboard
+*	shake detection algorithm. You should normally call this function from your SHAKE event
+*	callback function, since the values will be updated when a SHAKE_SHAKING_EVENT is received.
+*
+*	Possible return values are 0 (direction detection is disabled), 1 (x-axis), 2 (y-axis) and
+*	3 (z-axis).
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return the direction value, SHAKE_ERROR on error */
+SHAKE_API int shake_shaking_direction(shake_device* sh);
+
+/**	Reads the timestamp value for the last shaking event detected by the onboard
+*	shake detection algorithm. You should normally call this function from your SHAKE event
+*	callback function, since the values will be updated when a SHAKE_SHAKING_EVENT is received.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return the time modulo 1 second in units of 1/1024 second that the event was detected */
+SHAKE_API int shake_shaking_timestamp(shake_device* sh);
+
+/** Reads the current heart rate BPM value from the heart rate monitor (not installed in all SHAKEs!)
+*	You should normally call this function from your SHAKE event callback function, since the value
+*	will be updated when a SHAKE_HEART_RATE_EVENT is received.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return the current heart rate in beats per minute */
+SHAKE_API int shake_heart_rate(shake_device* sh);
+
+/** Reads the last detected RFID TID tag for RFID-enabled SHAKEs. Normally you should call this function
+*	from your SHAKE event callback, since the tag is only updated when a SHAKE_RFID_TID_EVENT is received.
+*
+*	The returned value will be a pointer to a 16 byte ASCII hex string containing the tag. It will be overwritten
+*	by subsequent tags, so applications should store a copy themselves if they wish to keep a history.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return the last detected RFID TID tag */
+SHAKE_API char* shake_rfid_tid(shake_device* sh);
+
+/**	Triggers an RFID scan by writing to the VO_REG_RFID_SCAN register. You can use this to start a
+*	scan when RFID autoscanning is disabled.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_rfid_scan(shake_device* sh);
+
+/**	Retrieves temperatures of gyro (and in binary output mode also accelerometer) sensors.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param temps pointer to a 4 element array. On return this will be populated with the current temperatures of
+*				the gyro sensors in the following order: pitch, roll, yaw. Additionally if the SK7 is in binary
+*				output mode, the 4th element will contain the temperature of the accelerometer sensor (this is not
+*				available in ASCII output mode).
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_gyro_temperatures(shake_device* sh, float* temps);
+
+/**	Each SHAKE data packet contains a sequence number in the range 0-99. This function can be used to retrieve
+*	the sequence number from the last accessed packet for a particular sensor. For example, if the accelerometer
+*	sensor is selected, the value returned will be the sequence number of the current accelerometer packet at
+*	the time of the last call to one of the shake_acc() group of functions.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor the sensor to read the sequence number for
+*	@return the last sequence number for the selected sensor*/
+SHAKE_API int shake_data_timestamp(shake_device* sh, int sensor);
+
+/*	=== Sample queue functions ===
+*	The data access functions above only return the most recent reading from each sensor, so 
+*	an application polling more slowly than the sensor output rate will miss samples. Each of 
+*	the sensors can optionally have a queue which stores every sample received until the 
+*	application reads it. */
+
+/** Number of sensors which can have a sample queue (SHAKE_SENSOR_ACC to SHAKE_SENSOR_ANA1). */
+#define SHAKE_NUM_SAMPLE_QUEUES 8
+
+/** A single queued sensor sample. */
+typedef struct {
+	/** sensor readings. x, y, z for the accelerometer, gyro and magnetometer, single valued 
+	*	sensors (heading, analog inputs, SK6 capacitive sensors) only use values[0] */
+	int values[3];
+	/** device sequence number from the packet containing the sample (0-255 for raw packets, 
+	*	0-99 for ASCII packets), or -1 if the packet had no sequence number */
+	int seq;
+	/** host time the packet was received, in seconds from an arbitrary starting point (a 
+	*	monotonic clock, so it isn't affected by changes to the system time) */
+	double timestamp;
+	/** number of the sample since the sensor started sending data, ie. the sequence number
+	*	with the times it has wrapped around added on. Missing samples leave gaps, duplicated 
+	*	samples repeat an index and samples received out of order have a lower index than 
+	*	the one before */
+	SHAKE_INT64 index;
+	/** host time the sample was taken, on the same clock as \a timestamp. This comes from a 
+	*	model of the device's clock fitted to the receive times of recent samples, so doesn't 
+	*	suffer from the jitter of the Bluetooth link and can be used to line SHAKE data up with
+	*	other sensors. Equal to \a timestamp until enough samples have been received to fit the model */
+	double sample_time;
+} shake_sample;
+
+/** Packet counts for the data from one sensor, returned by shake_get_stream_stats(). Missing, 
+*	duplicated and out of order packets are detected from the sequence numbers, so packets 
+*	without one (see shake_sample) are only counted as received. */
+typedef struct {
+	/** number of packets received */
+	unsigned int received;
+	/** number of packets lost, ie. skipped over by the sequence numbers. A packet that turns 
+	*	up late is taken back off this count and counted as out of order instead */
+	unsigned int missing;
+	/** number of packets received with the same sequence number as the one before */
+	unsigned int duplicated;
+	/** number of packets received after a packet with a later sequence number */
+	unsigned int out_of_order;
+} shake_stream_stats;
+
+/**	Creates a queue for the selected sensor, after which every sample received from that sensor
+*	is stored until read by the application. If the queue fills up, new samples are discarded 
+*	and counted (see shake_sample_queue_overflows()). 
+*
+*	The queue is allocated the first time this is called for a sensor and is kept until the 
+*	device is freed, so \a depth can't be changed once it has been set. Calling the function 
+*	again with the same depth (or 0) re-enables or disables the queue.
+*
+*	The SK7 capacitive sensors (12 values per packet) are not supported.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor the sensor to queue samples from (SHAKE_SENSOR_ACC to SHAKE_SENSOR_ANA1)
+*	@param depth maximum number of samples to store, rounded up to a power of 2. 0 disables the queue.
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_enable_sample_queue(shake_device* sh, int sensor, int depth);
+
+/**	Returns the number of samples discarded because the queue for the selected sensor was full.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor the sensor to check (SHAKE_SENSOR_ACC to SHAKE_SENSOR_ANA1)
+*	@return number of samples discarded, or SHAKE_ERROR */
+SHAKE_API int shake_sample_queue_overflows(shake_device* sh, int sensor);
+
+/** Default depth of a sample queue created by shake_read_samples(). */
+#define SHAKE_DEFAULT_SAMPLE_QUEUE_DEPTH 256
+
+/**	Copies every sample received from the selected sensor since the last call into \a samples
+*	(up to \a max_samples, any remaining samples are left for the next call), oldest first. 
+*	This replaces calling shake_acc() etc in a loop and never misses a sample as long as it is 
+*	called often enough to keep the queue from filling up.
+*
+*	If the sensor doesn't have a queue yet, one is created with SHAKE_DEFAULT_SAMPLE_QUEUE_DEPTH 
+*	entries and 0 is returned (use shake_enable_sample_queue() first to choose a different depth).
+*	Like the other data access functions, this updates the sequence number returned by 
+*	shake_data_timestamp() for the sensor.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor the sensor to read samples for (SHAKE_SENSOR_ACC to SHAKE_SENSOR_ANA1)
+*	@param samples pointer to an array of at least \a max_samples shake_sample structures
+*	@param max_samples maximum number of samples to copy
+*	@return the number of samples copied into \a samples, or SHAKE_ERROR */
+SHAKE_API int shake_read_samples(shake_device* sh, int sensor, shake_sample* samples, int max_samples);
+
+/** Latest sample from each sensor, filled in by shake_snapshot(). */
+typedef struct {
+	/** indexed by sensor (SHAKE_SENSOR_ACC to SHAKE_SENSOR_ANA1). Sensors which haven't sent
+	*	any data yet (including the SK7 capacitive sensors, which aren't covered) are all zeroes. */
+	shake_sample sensors[SHAKE_NUM_SAMPLE_QUEUES];
+} shake_sensor_snapshot;
+
+/**	Reads the latest sample from every sensor in a single call. Each sample is guaranteed to
+*	come from a single packet (the values can't be a mix of old and new readings), and carries 
+*	the sequence number and receive time of that packet. Works whether or not sample queues 
+*	are enabled, and doesn't remove anything from them.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param snapshot pointer to a shake_sensor_snapshot structure to fill in
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_snapshot(shake_device* sh, shake_sensor_snapshot* snapshot);
+
+/**	Blocks until new data arrives from any of the sensors in \a sensor_mask, instead of polling
+*	shake_acc() etc in a loop. The reader thread wakes waiting threads once per chunk of data it 
+*	reads from the port, so a burst of packets only causes a single wakeup. If any of the selected 
+*	sensors have a sample queue with samples still waiting in it, this returns immediately.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor_mask bitmask of sensors to wait for, eg (1 << SHAKE_SENSOR_ACC) | (1 << SHAKE_SENSOR_GYRO)
+*	@param timeout_ms maximum time to wait in milliseconds, or -1 to wait indefinitely
+*	@return bitmask of the selected sensors that have new data, 0 if the timeout expired (or the 
+*	device is being closed), or SHAKE_ERROR */
+SHAKE_API int shake_wait_sample(shake_device* sh, int sensor_mask, int timeout_ms);
+
+/**	Returns the packet counts for the selected sensor since the device was opened (or since 
+*	the last call to shake_reset_stream_stats()). A growing number of missing packets usually 
+*	means the Bluetooth link can't keep up with the sample rates in use.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor the sensor to get the counts for (SHAKE_SENSOR_ACC to SHAKE_SENSOR_ANA1)
+*	@param stats pointer to a shake_stream_stats structure to fill in
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_get_stream_stats(shake_device* sh, int sensor, shake_stream_stats* stats);
+
+/**	Sets the packet counts for the selected sensor back to zero.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor the sensor to reset the counts for (SHAKE_SENSOR_ACC to SHAKE_SENSOR_ANA1)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_reset_stream_stats(shake_device* sh, int sensor);
+
+/** Number of packet types counted in shake_stats (enough for both the SK6 and SK7). */
+#define SHAKE_STATS_PACKET_TYPES 64
+/** Number of bins in each shake_stats latency histogram. */
+#define SHAKE_STATS_LATENCY_BINS 24
+
+/**	Driver performance figures for one device, returned by shake_get_stats(). Everything covers
+*	the time since the device was opened, or since the last call to shake_reset_stats().
+*
+*	The latency histograms have power of 2 bins: bin 0 counts latencies under 1 microsecond, bin
+*	\a i counts latencies from 2^(i-1) up to 2^i microseconds, and the last bin also counts anything
+*	longer. */
+typedef struct {
+	/** seconds covered by these figures */
+	double elapsed;
+	/** average number of bytes received from the device per second */
+	double bytes_per_sec;
+	/** number of bytes received from the device */
+	SHAKE_INT64 bytes_received;
+	/** number of packets received of each type, indexed by the packet type numbers in 
+	*	SK6_packets.h (sk6_packet_types) or SK7_packets.h (sk7_packet_types) */
+	unsigned int packets[SHAKE_STATS_PACKET_TYPES];
+	/** number of times the driver lost track of the packet boundaries and had to search for the next header */
+	unsigned int resyncs;
+	/** number of bytes thrown away while searching for packet headers */
+	unsigned int resync_bytes_discarded;
+	/** number of ASCII packets whose checksum (when enabled, see shake_read_data_format()) didn't match
+	*	the NMEA style XOR the driver assumes. The algorithm hasn't been confirmed against a device, so
+	*	this is only a diagnostic: the packets are still used, whatever the count says */
+	unsigned int checksum_failures;
+	/** time from sending a command to receiving its ACK/NAK packet */
+	unsigned int ack_latency[SHAKE_STATS_LATENCY_BINS];
+	/** time from the packet carrying an event being received to the event callback being called */
+	unsigned int callback_latency[SHAKE_STATS_LATENCY_BINS];
+	/** seconds the reader thread spent waiting for data from the device */
+	double io_wait_time;
+	/** seconds the reader thread spent finding and classifying packet headers (estimated by 
+	*	timing a sample of the packets received, excluding time spent waiting for data) */
+	double framing_time;
+	/** seconds the reader thread spent decoding packets (estimated in the same way) */
+	double decoding_time;
+	/** number of register reads answered from the register shadow, see shake_enable_register_shadow() */
+	unsigned int register_shadow_hits;
+	/** number of reads of non-volatile registers which had to go to the device while the shadow was enabled */
+	unsigned int register_shadow_misses;
+	/** number of events dropped because the event queue was full, see SHAKE_EVENT_QUEUE_SIZE */
+	unsigned int events_dropped;
+} shake_stats;
+
+/**	Returns performance figures for the driver's handling of a device. The figures are kept
+*	up to date by the driver threads all the time, at very little cost, so this can be called
+*	as often as required.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param stats pointer to a shake_stats structure to fill in
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_get_stats(shake_device* sh, shake_stats* stats);
+
+/**	Sets all the figures returned by shake_get_stats() back to zero.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_reset_stats(shake_device* sh);
+
+/* 	=== Data logging functions === 
+*	These functions allow you to control the SHAKE data logging functionality found in firmware 2.00 and later */
+
+/** Initiates playback of recorded data over the serial link.
+*	Playback will start from the current position in memory, call shake_logging_stop() first to read from the start. 
+*	
+*	To detect the end of the playback process, use shake_register_event_callback() to register a callback function, 
+*	and wait for the SHAKE_PLAYBACK_COMPLETE event to be triggered.
+*	
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param output_filename (optional path) and filename to write the log data into.
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_logging_play(shake_device* sh, char* output_filename);
+
+/**	If recording or playback active, pauses the process at the current write/read position in memory.
+*	To resume a paused operation, simply call shake_logging_record() or shake_logging_play() as appropriate.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_logging_pause(shake_device* sh);
+
+/** Stops recording or playback AND resets the write/read position to the start of internal memory.
+*	This command will also close any output logfile currently open. 
+*
+*	You should usually call this function before calling either shake_logging_play() or shake_logging_record(), 
+*	to reset the write/read position. 
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_logging_stop(shake_device* sh);
+
+/**	Starts logging data into internal memory from the current writing position. 
+*	Call shake_logging_stop() first to reset the writing position to the start of internal memory. 
+*
+*	Note that while recording in progress, changes to the SHAKE configuration registers (using the register access functions)
+*	will be disallowed. If you need to change sample rates etc mid-recording, call shake_logging_pause(), change
+*	the registers, then resume logging by calling shake_logging_record() again
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_logging_record(shake_device* sh);
+
+/** Resets the data logging timestamp clock to zero.
+*	Should usually only be sent prior to a shake_logging_record command.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_logging_reset(shake_device* sh);
+
+/** Indicates the current status of data logging on the SHAKE. 
+*	The value returned will be a bitwise combination of these three values:
+*	- SHAKE_LOGGING_RECORDING		(recording is in progress)
+*	- SHAKE_LOGGING_PLAYING		(playback is in progress)
+*	- SHAKE_LOGGING_MEMORYFULL	(memory is almost full, <1% available)
+*
+*	Obviously only 1 of the RECORDING/PLAYING values will be set at any particular time. 
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_logging_status(shake_device* sh);
+
+/** Indicates the proportion of internal memory remaining free for logged data.
+*	The value returned will be between 0 and 255, with 0 meaning no space remaining, and 255
+*	meaning the whole memory is free. 
+*
+*	@warning Currently doesn't work properly, may always report 100% full.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_logging_memory_status(shake_device* sh);
+
+/** Returns the approximate number of packets logged to internal memory. 
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return The number of packets logged (only accurate to nearest 100), or SHAKE_ERROR */
+SHAKE_API int shake_logging_packet_count(shake_device* sh);
+
+/** During playback of logged data, this function can be used to count incoming packets.
+*	Unlike the shake_logging_packet_count() function, which indicates the total number of packets stored in
+*	the SHAKE itself, this function queries a local value which gives the number of packets received from
+*	the SHAKE. This value can then be used to estimate overall progress when taken along with the result 
+*	of the shake_logging_packet_count() function.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_logging_packets_read(shake_device* sh);
+
+/**	The SHAKE SK7 can optionally power down the Bluetooth module while logging is active to increase 
+*	battery life. To power down the Bluetooth module, simply call this function. The module will remain
+*	inactive until the SK7 is reconnected using a USB cable. 
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk7_logging_bt_power_down(shake_device* sh);
+
+/*	=== Register access functions === 
+*	These functions allow you to easily get/set the values of the various configuration registers
+*	on a SHAKE device */
+
+/** Read the SHAKE_NV_REG_POWER1 register, which controls power to the various sensors on the device. 
+*	The value returned will be a combination of the values from the ::shake_power1 enumeration.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_power_state(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_POWER1 register, which controls power to the various sensors on the device. 
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value to write into the register (should be a combination of the values from the ::shake_power1 enumeration)
+*		For example, to power on the accelerometer and magnetometer (disabling everything else), the value should be:
+*		SHAKE_POWER_ACC | SHAKE_POWER_MAG
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_power_state(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_POWER2 register, which enables/disables capacitive switch thresholds and event output.
+*	The value returned will be a combination of the values from the ::shake_power2 enumeration.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_power_state_2(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_POWER2 register, which enables/disables capacitive switch thresholds and event output.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value to write into the register (should be a combination of the values from the ::shake_power2 enumeration)
+*		For example, to enable upper and lower thresholds for cap switch 0, plus event packet output, the value
+*		would be SHAKE_POWER_CS0_INC | SHAKE_POWER_CS0_DEC | SHAKE_POWER_CS_EVENTS
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_power_state_2(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_ACC_CONFIG register, which configures a couple of aspects of the accelerometer.
+*	The first bit in the returned value indicates the accelerometer range:
+*	- if 0, the range is +/- 2g
+*	- if 1, the range is +/- 6g
+*
+*	If set, the 2nd bit indicates the high pass filter is enabled, if unset the filter is disabled.
+*
+*	The remaining bits are not currently used.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_acc_config(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_ACC_CONFIG register, which configures a couple of aspects of the accelerometer.
+*	The first bit of \a value controls the accelerometer range:
+*		- if 0, the range is +/- 2g
+*		- if 1, the range is +/- 6g
+*
+*		If set, the 2nd bit enabless the high pass filter. If unset the filter is disabled.
+*
+*		The remaining bits are not currently used.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register.
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_acc_config(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_DATAFMT register, which configures the output data format from the SHAKE.
+*	If set, the first bit of the returned value indicates that checksums will be attached to ASCII data packets.
+*
+*	If set, the second bit indicates that output will be in raw (binary) mode, if not set, output is ASCII.
+*
+*	The remaining bits are not currently used.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_data_format(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_DATAFMT register, which configures the output data format from the SHAKE.
+*	If set, the first bit of \a value enables checksums for ASCII data packets. If not set, checksums are disabled.
+*
+*	If set, the second bit indicates that output will be in raw (binary) mode. If not set, output is ASCII.
+*
+*	The remaining bits are not currently used.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_data_format(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CALIB_BYPASS register, which can be used to obtain uncalibrated data from selected sensors.
+*	The value returned will be a combination of the values from the ::shake_bypass_sensor_calib enumeration. If 
+*	the bit for a particular sensor is set, it means uncalibrated output is enabled.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_calib_bypass(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CALIB_BYPASS register, which can be used to obtain uncalibrated data from selected sensors.
+*	The value to write should be a combination of the values from the ::shake_bypass_sensor_calib enumeration. If 
+*	the bit for a particular sensor is set, it means uncalibrated output will be enabled.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_calib_bypass(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CX_CALIB_BYPASS register, which can be used to disable the cross axes calibration for
+*	sensors with multiple degrees of freedom (accelerometer, gyro, magnetometer).
+*	The value returned will be a combination of the values from the ::shake_cx_bypass_sensor_calib enumeration. If 
+*	the bit for a particular sensor is set, it means uncalibrated output is enabled.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_cx_bypass(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CX_CALIB_BYPASS register, which can be used to disable the cross axes calibration for
+*	sensors with multiple degrees of freedom (accelerometer, gyro, magnetometer).
+*	The value to write will be a combination of the values from the ::shake_cx_bypass_sensor_calib enumeration. If 
+*	the bit for a particular sensor is set, it means uncalibrated output will be enabled.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_cx_bypass(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_TEMP_COMPENSATION register, which indicates the state of temperature compensation for sensor output.
+*	Currently only gyroscope compensation is possible
+*	@warning This might not be working yet.
+*	The 2nd bit in the register is currently the only one used - if set, gyro temperature compensation is enabled.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_temp_compensation(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_TEMP_COMPENSATION register, which controls the state of temperature compensation for sensor output.
+*	Currently only gyroscope compensation is possible
+*	@warning This might not be working yet.
+*	The 2nd bit in the register is currently the only one used - if set, gyro temperature compensation is enabled.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_temp_compensation(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_STREAM_DISABLE register, which can be used to disable the streaming of data packets for selected sensors.
+*	The value returned will be a combination of the values from the ::shake_stream_disable enumeration. If 
+*	the bit for a particular sensor is set, it means data streaming is DISABLED for that sensor (even if sample rate above 0).
+*
+*	NOTE: this functionality is removed on SK7s with firmware version >= 1.00. Setting the sample rate to 0 has an 
+*	equivalent effect.
+*	
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_packet_streaming(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_STREAM_DISABLE register, which can be used to disable the streaming of data packets for selected sensors.
+*	The value to write should be a combination of the values from the ::shake_stream_disable enumeration. If 
+*	the bit for a particular sensor is set, it means data streaming will be DISABLED for that sensor (even if sample rate above 0).
+*
+*	NOTE: this functionality is removed on SK7s with firmware version >= 1.00. Setting the sample rate to 0 has an 
+*	equivalent effect.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_packet_streaming(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_AUDIO_CONFIG register, which can be used to configure the audio functionality on SHAKEs with
+*	supported hardware. 
+*	The value returned will be a combination of the values from the ::shake_audio_config enumeration.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_audio_config(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_AUDIO_CONFIG register, which can be used to configure the audio functionality on SHAKEs with
+*	supported hardware. 
+*	The value to write should be a combination of the values from the ::shake_audio_config enumeration. 
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_audio_config(shake_device* sh, unsigned char value);
+
+/** Write the VO_REG_MIDI_AMPLITUDE register, which can be used to configure the ampltiude of the SHAKE
+*	MIDI synthesiser. 
+*	The value to write should be SHAKE_MIDI_AMPLITUDE_MUTE if the amplitude should be muted, otherwise
+*	a value between SHAKE_MID_AMPLITUDE_MIN and SHAKE_MIDI_AMPLITUDE_MAX inclusive.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_midi_amplitude(shake_device* sh, unsigned char value);
+
+/** Write the VO_REG_MIDI_NOTE register, which can be used to configure the MIDI note to play from the SHAKE
+*	MIDI synthesiser.
+*	The value to write should be in the range SHAKE_MIDI_NOTE_MIN and SHAKE_MIDI_NOTE_MAX inclusive.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_midi_note(shake_device* sh, unsigned char value);
+
+/** Write the VO_REG_MIDI_WAVEFORM register, which can be used to configure the waveform to use from the SHAKE
+*	MIDI synthesiser. 
+*	The value to write should be a member of the ::shake_midi_waveforms enumeration. 
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_midi_waveform(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CS0_INC register, which contains the increasing threshold value for capacitive switch 0.
+*
+*	SK6 only.
+*	The value returned will be in the range 0-255 (the same range as the normal output from the sensor).
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk6_read_cs0_inc(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CS0_INC register, which contains the increasing threshold value for capacitive switch 0.
+*
+*	SK6 only.
+*	The value for the threshold should be in the range 0-255 (the same range as the normal output from the sensor).
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the threshold value (must be greater than the decreasing threshold!)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR 
+*	@see shake_write_cs0_dec() */
+SHAKE_API int sk6_write_cs0_inc(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CS0_DEC register, which contains the decreasing threshold value for capacitive switch 0.
+*
+*	SK6 only.
+*	The value returned will be in the range 0-255 (the same range as the normal output from the sensor).
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register.
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk6_read_cs0_dec(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CS0_DEC register, which contains the decreasing threshold value for capacitive switch 0.
+*
+*	SK6 only.
+*	The value for the threshold should be in the range 0-255 (the same range as the normal output from the sensor).
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the threshold value (must be less than the increasing threshold!)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR
+*	@see shake_write_cs0_inc() */
+SHAKE_API int sk6_write_cs0_dec(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CS0_INC_PROFILE register, which contains the number of the vibration profile to play when
+*	the increasing threshold on capacitive switch 0 is triggered.
+*
+*	SK6 only.
+*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
+*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR 
+*	@see shake_read_power_state_2()
+*	@see shake_write_power_state_2() */
+SHAKE_API int sk6_read_cs0_inc_profile(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CS0_INC_PROFILE register, which controls the number of the vibration profile to play when
+*	the increasing threshold on capacitive switch 0 is triggered.
+*
+*	SK6 only.
+*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
+*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR 
+*	@see shake_read_power_state_2()
+*	@see shake_write_power_state_2() */
+SHAKE_API int sk6_write_cs0_inc_profile(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CS0_DEC_PROFILE register, which contains the number of the vibration profile to play when
+*	the decreasing threshold on capacitive switch 0 is triggered.
+*
+*	SK6 only.
+*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
+*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR 
+*	@see shake_read_power_state_2()
+*	@see shake_write_power_state_2()*/
+SHAKE_API int sk6_read_cs0_dec_profile(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CS0_DEC_PROFILE register, which controls the number of the vibration profile to play when
+*	the decreasing threshold on capacitive switch 0 is triggered.
+*
+*	SK6 only.
+*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
+*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR 
+*	@see shake_read_power_state_2()
+*	@see shake_write_power_state_2() */
+SHAKE_API int sk6_write_cs0_dec_profile(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CS1_INC register, which contains the increasing threshold value for capacitive switch 1.
+*
+*	SK6 only.
+*	The value returned will be in the range 0-255 (the same range as the normal output from the sensor).
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk6_read_cs1_inc(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CS1_INC register, which contains the decreasing threshold value for capacitive switch 1.
+*
+*	SK6 only.
+*	The value for the threshold should be in the range 0-255 (the same range as the normal output from the sensor).
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the threshold value (must be less than the increasing threshold!)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR
+*	@see shake_write_cs1_dec() */
+SHAKE_API int sk6_write_cs1_inc(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CS1_DEC register, which contains the decreasing threshold value for capacitive switch 1.
+*
+*	SK6 only.
+*	The value returned will be in the range 0-255 (the same range as the normal output from the sensor).
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk6_read_cs1_dec(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CS1_DEC register, which contains the increasing threshold value for capacitive switch 1.
+*
+*	SK6 only.
+*	The value for the threshold should be in the range 0-255 (the same range as the normal output from the sensor).
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the threshold value (must be less than the increasing threshold!)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR
+*	@see shake_write_cs1_inc() */
+SHAKE_API int sk6_write_cs1_dec(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CS1_INC_PROFILE register, which contains the number of the vibration profile to play when
+*	the increasing threshold on capacitive switch 1 is triggered.
+*
+*	SK6 only.
+*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
+*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR 
+*	@see shake_read_power_state_2()
+*	@see shake_write_power_state_2()*/
+SHAKE_API int sk6_read_cs1_inc_profile(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CS1_INC_PROFILE register, which controls the number of the vibration profile to play when
+*	the increasing threshold on capacitive switch 1 is triggered.
+*
+*	SK6 only.
+*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
+*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR 
+*	@see shake_read_power_state_2()
+*	@see shake_write_power_state_2() */
+SHAKE_API int sk6_write_cs1_inc_profile(shake_device* sh, unsigned char value);
+
+/** Read the SHAKE_NV_REG_CS1_DEC_PROFILE register, which contains the number of the vibration profile to play when
+*	the decreasing threshold on capacitive switch 1 is triggered.
+*
+*	SK6 only.
+*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
+*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR 
+*	@see shake_read_power_state_2()
+*	@see shake_write_power_state_2()*/
+SHAKE_API int sk6_read_cs1_dec_profile(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_CS1_DEC_PROFILE register, which controls the number of the vibration profile to play when
+*	the increasing threshold on capacitive switch 1 is triggered.
+*
+*	SK6 only.
+*	The value returned will be in the range 1-255, and indicates the address of the vibration profile uploaded
+*	using shake_upload_vib_sample(). If 0, no sample is currently set to play.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR 
+*	@see shake_read_power_state_2()
+*	@see shake_write_power_state_2() */
+SHAKE_API int sk6_write_cs1_dec_profile(shake_device* sh, unsigned char value);
+
+/**	This function allows you to read all 8 registers related to capacitive switch thresholds in a single operation.
+*
+*	SK6 only.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param values pointer to an 8 element array, which will be populated with the values from each of the 8
+*	registers in the following order:
+*	- SK6_NV_REG_CS0_INC			(cap switch 0, increasing threshold)
+*	- SK6_NV_REG_CS0_DEC			(cap switch 0, decreasing threshold)
+*	- SK6_NV_REG_CS0_INC_PROFILE	(cap switch 0, increasing threshold vib profile)
+*	- SK6_NV_REG_CS0_DEC_PROFILE	(cap switch 0, decreasing threshold vib profile)
+*	- SK6_NV_REG_CS1_INC			(cap switch 1, increasing threshold)
+*	- SK6_NV_REG_CS1_DEC			(cap switch 1, decreasing threshold)
+*	- SK6_NV_REG_CS1_INC_PROFILE	(cap switch 1, increasing threshold vib profile)
+*	- SK6_NV_REG_CS1_DEC_PROFILE	(cap switch 1, decreasing threshold vib profile)
+* 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR
+*/
+SHAKE_API int sk6_read_cap_thresholds(shake_device* sh, unsigned char* values);
+
+/**	This function allows you to write all 8 registers related to capacitive switch thresholds in a single operation.
+*
+*	SK6 only.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param values pointer to an 8 element array, which should be populated with the values for each of the 8
+*	registers in the following order:
+*	- SK6_NV_REG_CS0_INC			(cap switch 0, increasing threshold)
+*	- SK6_NV_REG_CS0_DEC			(cap switch 0, decreasing threshold)
+*	- SK6_NV_REG_CS0_INC_PROFILE	(cap switch 0, increasing threshold vib profile)
+*	- SK6_NV_REG_CS0_DEC_PROFILE	(cap switch 0, decreasing threshold vib profile)
+*	- SK6_NV_REG_CS1_INC			(cap switch 1, increasing threshold)
+*	- SK6_NV_REG_CS1_DEC			(cap switch 1, decreasing threshold)
+*	- SK6_NV_REG_CS1_INC_PROFILE	(cap switch 1, increasing threshold vib profile)
+*	- SK6_NV_REG_CS1_DEC_PROFILE	(cap switch 1, decreasing threshold vib profile)
+*	
+*	@return SHAKE_SUCCESS or SHAKE_ERROR
+*/
+SHAKE_API int sk6_write_cap_thresholds(shake_device* sh, unsigned char* values);
+
+/**	This function allows you to read all 4 registers related to capacitive switch thresholds in a single operation.
+*
+*	SK7 only.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param values pointer to a 4 element array, which will be populated with the values from each of the 4 relevant
+*	registers in the following order:
+*	- SK7_NV_REG_CAP_INC			(increasing threshold)
+*	- SK7_NV_REG_CAP_DEC			(decreasing threshold)
+*	- SK7_NV_REG_CAP_INC_PROFILE	(increasing threshold vib profile)
+*	- SK7_NV_REG_CAP_DEC_PROFILE	(decreasing threshold vib profile)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR
+*/
+SHAKE_API int sk7_read_cap_thresholds(shake_device* sh, unsigned char* values);
+
+/**	This function allows you to write all 4 registers related to capacitive switch thresholds in a single operation.
+*
+*	SK7 only.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param values pointer to a 4 element array, which should be populated with the values for each of the 4
+*	registers in the following order:
+*	- SK7_NV_REG_CAP_INC			(increasing threshold)
+*	- SK7_NV_REG_CAP_DEC			(decreasing threshold)
+*	- SK7_NV_REG_CAP_INC_PROFILE	(increasing threshold vib profile)
+*	- SK7_NV_REG_CAP_DEC_PROFILE	(decreasing threshold vib profile)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR
+*/
+SHAKE_API int sk7_write_cap_thresholds(shake_device* sh, unsigned char* values);
+
+/** Reads the various registers which control the output sample rate for each sensor.
+*	Each sensor has a an output sample rate range between 0 and some maximum, which is given by the
+*	value of the corresponding constant from the ::shake_max_output_rates enumeration. For example,
+*	SHAKE_ACC_MAX_RATE is the maximum accelerometer sample rate. Each sensor also has a dedicated register
+*	containing the current output sample rate.
+*
+*	To get the sample rate for a selected sensor, use the appropriate value from ::shake_sensors as the
+*	\a sensor_id parameter (eg SHAKE_SENSOR_ACC for accelerometer).
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor_id sensor to get sample rate for (from ::shake_sensors)
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_sample_rate(shake_device* sh, int sensor_id, unsigned char* value);
+
+/** Write the various registers which control the output sample rate for each sensor.
+*	Each sensor has a an output sample rate range between 0 and some maximum, which is given by the
+*	value of the corresponding constant from the ::shake_max_output_rates enumeration. For example,
+*	SHAKE_ACC_MAX_RATE is the maximum accelerometer sample rate. Each sensor also has a dedicated register
+*	containing the current output sample rate.
+*
+*	To set the sample rate for a selected sensor, use the appropriate value from ::shake_sensors as the
+*	\a sensor_id parameter (eg SHAKE_SENSOR_ACC for accelerometer).
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor_id sensor to set sample rate for (from ::shake_sensors)
+*	@param value the sample rate to set for the selected sensor
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_sample_rate(shake_device* sh, int sensor_id, unsigned char value);
+
+/** Reads the various registers which control the digital filter settings for each sensor.
+*	The first bit in the returned value indicates filtering is enabled (if set) or disabled (if unset).
+*
+*	The second bit in the returned value indicates the type of filtering - if set, minimum phase, if unset, linear phase.
+*
+*	See the user manual for more details on digital filtering.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor_id sensor to get digital filtering configuration for (from ::shake_sensors)
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_digital_filter(shake_device* sh, int sensor_id, unsigned char* value);
+
+/** Write the various registers which control the digital filter settings for each sensor.
+*	The first bit in \a value controls whether filtering is enabled (if set) or disabled (if unset).
+*
+*	The second bit in \a value controls the type of filtering - if set, minimum phase, if unset, linear phase.
+*
+*	See the user manual for more details on digital filtering.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param sensor_id sensor to set digital filtering configuration for (from ::shake_sensors)
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_digital_filter(shake_device* sh, int sensor_id, unsigned char value);
+
+/** Read the value of the SHAKE_NV_REG_SHAKING_CONFIG register, which controls the state of the
+*	shaking detection algorithm in firmware >= 2.01.
+*
+*	The value returned by the function will be zero, or a combination of values from the ::shake_shaking_configuration enumeration.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_shaking_config(shake_device* sh, unsigned char* value);
+
+/** Write a value into the SHAKE_NV_REG_SHAKING_CONFIG register, which allows you to configure the state of the
+*	shaking detection algorithm in firmware >= 2.01.
+*
+*	Using this register, you can separately enable/disable the shaking detection algorithm, the direction detection 
+*	part of the algorithm, and the use of vibrotactile feedback for shaking events.
+*
+*	The value to write should be zero or a combination of values from the ::shake_shaking_configuration enumeration.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR
+*/
+SHAKE_API int shake_write_shaking_config(shake_device* sh, unsigned char value);
+
+/** Reads the value of the SHAKE_NV_REG_SHAKING_ACCEL_THRESHOLD register.
+*
+*	This register controls the minimum peak acceleration below which shaking events will not be triggered.
+*
+*	The value returned by the function gives the peak acceleration in 0.1g units, so a value of 10 = 1g.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_shaking_accel_threshold(shake_device* sh, unsigned char* value);
+
+/** Writes a value into the SHAKE_NV_REG_SHAKING_ACCEL_THRESHOLD register.
+*
+*	This register controls the minimum peak acceleration below which shaking events will not be triggered.
+*
+*	\a value should be the minimum peak acceleration in units of 0.1g (10 = 1g).
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_shaking_accel_threshold(shake_device* sh, unsigned char value);
+
+/** Reads the value of the SHAKE_NV_REG_SHAKING_HOLDOFF_TIME register.
+*
+*	This register controls the hold-off time that the detection algorithm will wait after an acceleration
+*	peak before beginning to look for the next peak.
+*
+*	The value returned by the function gives the time in units of 7.8ms, so a value of 10 = 78ms.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_shaking_holdoff_time(shake_device* sh, unsigned char* value);
+
+/** Writes a value into the SHAKE_NV_REG_SHAKING_HOLDOFF_TIME register.
+*
+*	This register controls the hold-off time that the detection algorithm will wait after an acceleration
+*	peak before beginning to look for the next peak.
+*
+*	\a value should be the hold-off time in units of 7.8ms (10 = 78ms).
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_shaking_holdoff_time(shake_device* sh, unsigned char value);
+
+/** Reads the value of the SHAKE_NV_REG_SHAKING_VIBRATION_PROFILE register.
+*
+*	This register controls the vibration profile that will be activated when a shaking event is triggered (assuming
+*	the vibration control flag is enabled, see the shake_write_shaking_config() function).
+*
+*	The value returned by the function gives the address of the vibration profile that will be played.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_shaking_vibration_profile(shake_device* sh, unsigned char* value);
+
+/** Writes a value into the SHAKE_NV_REG_SHAKING_VIBRATION_PROFILE register.
+*
+*	This register controls the vibration profile that will be activated when a shaking event is triggered (assuming
+*	the vibration control flag is enabled, see the shake_write_shaking_config() function).
+*
+*	\a value should be the vibration profile address (between SHAKE_VIB_PROFILE_MIN and SHAKE_VIB_PROFILE_MAX inclusive)
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_shaking_vibration_profile(shake_device* sh, unsigned char value);
+
+/** Reads the value of the SHAKE_NV_REG_SHAKING_HPF_CONSTANT register.
+*
+*	This register controls the high pass filter length in the detection algorithm. The higher this value is,
+*	the more sensitive the algorithm will be to very low frequency movements.
+*
+*	The value returned by the function gives the length in units of 7.8ms, so a value of 10 = 78ms.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_shaking_hpf_constant(shake_device* sh, unsigned char* value);
+
+/** Writes a value into the SHAKE_NV_REG_SHAKING_HPF_CONSTANT register.
+*
+*	This register controls the high pass filter length in the detection algorithm. The higher this value is,
+*	the more sensitive the algorithm will be to very low frequency movements.
+*
+*	\a value should be the filter length in units of 7.8ms (10 = 78ms).
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_shaking_hpf_constant(shake_device* sh, unsigned char value);
+
+/** Reads the value of the SHAKE_NV_REG_SHAKING_LPF_CONSTANT register.
+*
+*	This register controls the low pass filter length in the detection algorithm. The higher this value is,
+*	the less susceptible the algorithm will be to higher frequency vibration.
+*
+*	The value returned by the function gives the length in units of 7.8ms, so a value of 10 = 78ms.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_shaking_lpf_constant(shake_device* sh, unsigned char* value);
+
+/** Writes a value into the SHAKE_NV_REG_SHAKING_LPF_CONSTANT register.
+*
+*	This register controls the low pass filter length in the detection algorithm. The higher this value is,
+*	the less susceptible the algorithm will be to higher frequency vibration.
+*
+*	\a value should be the filter length in units of 7.8ms (10 = 78ms).
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_shaking_lpf_constant(shake_device* sh, unsigned char value);
+
+/** Resets the state of the shaking algorithm configuration registers to their recommended values.
+*
+*	Calling this function performs the following operations:
+*		- the minimum peak acceleration threshold is set to 1g
+*		- the hold-off time is set to 47ms
+*		- the vibration profile address is set to zero
+*		- the high pass filter length is set to 250ms
+*		- the low pass filter length is set to 47ms
+*		- shaking detection is enabled
+*		- shaking detection direction detection is enabled
+*		- shaking detection vibration playback is enabled 
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_reset_shaking_detection(shake_device* sh);
+
+/**	Reads the value of the SHAKE_NV_REG_HEART_RATE_CONFIG register.
+*
+*	This register controls the configuration of the heart rate monitor installed in some SHAKEs.
+*
+*	The value returned by the function will be zero or a combination of one or more values from the
+*	::shake_heart_rate_configuration enumeration.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_heart_rate_config(shake_device* sh, unsigned char* value);
+
+/** Writes a value into the SHAKE_NV_REG_HEART_RATE_CONFIG register.
+*
+*	This register controls the configuration of the heart rate monitor installed in some SHAKEs.
+*
+*	\a value should be zero or a combination of one or more values from ::shake_heart_rate_configuration
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_heart_rate_config(shake_device* sh, unsigned char value);
+
+/** Write a value into the VO_REG_PKTREQ register, which allows you to explicitly request that the SHAKE send a particular type or
+*	types of data packet.
+*
+*	This function writes into a volatile register (write-only) that allows you to request
+*	a single set of data from one or more sensors (this is instead of or in addition to the usual
+*	data stream(s) generated by the device). 
+*
+*	The value you write should be a logical OR of one or more of the members of the ::shake_packet_requests enumeration,
+*	indicating which sensor(s) you want to request a data packet from.
+*
+*	The data will arrive in the usual way and so you should use the normal data access functions to read it.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_packet_request(shake_device* sh, unsigned char value);
+
+/** Write a value into the VO_REG_DATAREQ register, which allows you to request that the SHAKE re-output the 
+*	startup splash text (including firmware/hardware version) at any time.
+*
+*	The only valid value for the register at the moment is 1, which will cause the startup text to be output.
+*
+*	Future firmware versions may add extra functionality.
+*	
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the register
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_data_request(shake_device* sh, unsigned char value);
+
+/** Plays a vibration profile on one of the channels supported by the SHAKE (SK6 and SK7)
+*
+*	Note that for typical SHAKEs, the only valid channel is SHAKE_VIB_MAIN - the other channel
+*	values refer to externally connected vibrotactile units or plugin modules that may not be installed.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param channel should be a value from the ::shake_vib_channels enumeration
+*	@param profile should indicate the number of the vibration profile to playback from the SHAKE internal memory. The valid range of this number is SHAKE_VIB_PROFILE_MIN - SHAKE_VIB_PROFILE_MAX inclusive.
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_playvib(shake_device* sh, int channel, unsigned char profile);
+
+/**	Plays a continuous vibration through one of two external channels supported by the SK6 (NOT SK7)
+*
+*	This function can only be used with a SHAKE SK6 that has firmware version >= 2.50, and has one or
+*	more external piezo vibrators attached. For more information see the SHAKE SK6 manual. 
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param channel should be either SHAKE_VIB_LEFT or SHAKE_VIB_RIGHT
+*	@param amplitude amplitude of the vibration signal. Valid values are 0, 33, 66 and 100. 
+*	@param time period of the vibration signal. The range is 0-63, in units of 26ms (1 = 26ms, 63 = 1.66s)
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk6_playvib_continuous(shake_device* sh, int channel, unsigned char amplitude, unsigned char time);
+
+/** This function uploads a vibration sample to the SHAKE SK6, storing it in one of the available locations in internal memory.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param profile should indicate the number of the vibration profile to store the sample in.
+*	The valid range of this number is SHAKE_VIB_PROFILE_MIN - SHAKE_VIB_PROFILE_MAX inclusive.
+*	@param sample should point to an array of integers containing the sample data. The array should
+*	contain pairs of speed/time values (ie speed1,time1,speed2,time2,...). The speed values
+*	should be in the range 0 - SHAKE_VIB_SPEED_MAX inclusive. The time values should be in the
+*	range 0 - SHAKE_VIB_TIME_MAX inclusive, and are in units of 10 MILLISECONDS, so a value of
+*	10 means 100ms. 
+*	@param sample_length should be the the number of PAIRS in the @param sample array (NOT the total number
+*	of values). The maximum number of pairs is given by SHAKE_VIB_SAMPLE_MAX_LENGTH.
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR. Note that if and when the function returns
+*	SHAKE_SUCCESS, it means that the sample has been fully uploaded and is now available
+*	for immediate playback using shake_playvib() */
+SHAKE_API int sk6_upload_vib_sample(shake_device* sh, unsigned char profile, int* sample, int sample_length);
+
+/**	Similar to the above function except that it allows setting extra parameters in the vibration profile.
+*	This function can be used with the following device configurations:
+*		- A SHAKE SK6 with the SK6-V01 module, with continuous vibration support (firmware >= 2.60).
+*		- A SHAKE SK7
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param profile should indicate the number of the vibration profile to store the sample in.
+*	The valid range of this number is SHAKE_VIB_PROFILE_MIN - SHAKE_VIB_PROFILE_MAX inclusive.
+*	@param sample should point to an array of integers containing the sample data. The array should
+*	contain pairs of speed/time values (ie speed1,time1,speed2,time2,...). The speed values
+*	should be in the range 0 - SHAKE_VIB_SPEED_MAX inclusive. The time values should be in the
+*	range 0 - SHAKE_VIB_TIME_MAX inclusive, and are in units of 10 MILLISECONDS, so a value of
+*	10 means 100ms. 
+*	@param sample_length should be the the number of PAIRS in the @param sample array (NOT the total number
+*	of values). The maximum number of pairs is given by SHAKE_VIB_SAMPLE_MAX_LENGTH.
+*
+*	@param mode represents the mode of the drive when the actuation is triggered. For pulse drive must be 0x02 (this is the only
+*				valid option for the SK6!)
+*	@param freq frequency of the pulsed waveform. Actual output frequency is twice this value (eg 250Hz = 0x7D)
+*	@param duty ratio of the pulsed output. Range of values is 1-9, representing 10%-90% respectively.
+*	
+*	@return SHAKE_SUCCESS or SHAKE_ERROR. Note that if and when the function returns
+*	SHAKE_SUCCESS, it means that the sample has been fully uploaded and is now available
+*	for immediate playback using shake_playvib() */
+SHAKE_API int shake_upload_vib_sample_extended(shake_device* sh, unsigned char profile, int* sample, int sample_length, unsigned char mode, unsigned char freq, unsigned char duty);
+
+/** Reads the battery level from the device. 
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the result (range is 0 to SHAKE_BATTERY_MAX)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_battery_level(shake_device* sh, unsigned char* value);
+
+/** Reads the power status of the device.
+*
+*	The value from this register is a combination of 3 different items:
+*		- External power on/off
+*		- Battery charging/not charging
+*		- Battery charged/not fully charged
+*
+*	There are 3 simple macros defined in shake_registers.h to make checking each item 
+*	convenient (x is the value read from the device):
+*		- SHAKE_EXT_POWER_ON(x) (nonzero when ext power connected)
+*		- SHAKE_BATTERY_CHARGING(x) (nonzero if battery charging)
+*		- SHAKE_BATTERY_FULL(x) (nonzero if battery fully charged)
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_power_status(shake_device* sh, unsigned char* value);
+
+/** Reads the temperature sensor on the SHAKE device. 
+*	The value of this sensor is updated every second, but must be retrieved manually using this function 
+*	rather than as part of the normal data stream from the other sensors. 
+*	The measureable range is 0-64 degrees C, mapped onto 255 0.25 degree steps in the
+*	1-byte register. The reading returned by the function will be converted into 
+*	this 0-64C range automatically.
+*	
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@return a value between 0-64 on success, SHAKE_ERROR on error */
+SHAKE_API float shake_read_temperature(shake_device* sh);
+
+/** Read the SHAKE_NV_REG_EXPANSION_CONFIG register, which controls power to the various sensors on the
+*	E01 expansion module.
+*
+*	The value returned will be a combination of the values from the ::shake_expansion_configuration enumeration.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_expansion_config(shake_device* sh, unsigned char* value);
+
+/** Write the SHAKE_NV_REG_EXPANSION_CONFIG register, which controls power to the various sensors 
+*	E01 expansion module.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value to write into the register (should be a combination of the values from the ::shake_expansion_configuration enumeration)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_expansion_config(shake_device* sh, unsigned char value);
+
+/**	Read the SHAKE_NV_REG_RFID_CONFIG register, which controls the RFID expansion module settings.
+*
+*	The value returned will be a combination of the values from the ::shake_rfid_config enumeration.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_rfid_config(shake_device* sh, unsigned char* value);
+
+/**	Write the SHAKE_NV_REG_RFID_CONFIG register, which controls the RFID expansion module settings.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value to write into the register (should be a combination of the values from the ::shake_rfid_config enumeration)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_rfid_config(shake_device* sh, unsigned char value);
+
+/**	Read the SHAKE_NV_REG_RFID_FREQUENCY register, which controls the RFID autoscan frequency
+*
+*	The value returned will be between SHAKE_RFID_AUTOSCAN_MIN_FREQ and SHAKE_RFID_AUTOSCAN_MAX_FREQ
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read_rfid_scan_freq(shake_device* sh, unsigned char* value);
+
+/**	Write the SHAKE_NV_REG_RFID_FREQUENCY register, which controls the RFID autoscan frequency
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value to write into the register (between SHAKE_RFID_AUTOSCAN_MIN_FREQ and SHAKE_RFID_AUTOSCAN_MAX_FREQ)
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write_rfid_scan_freq(shake_device* sh, unsigned char value);
+
+/**	SK7 only. Configures vibration feedback which is activated when the compass heading enters a defined range. Note that
+*	vibration feedback must be enabled using sk7_configure_heading_feedback, and the vibrator power must be turned on.
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param lower_threshold lower threshold for the heading value, in tenths of a degree
+*	@param upper_threshold upper threshold for the heading value, in tenths of a degree
+*	@param hysteresis the amount by which the heading must change above/below a threshold before the vibration
+*			feedback will be triggered again. Allowed values are 0-255, in tenths of a degree.
+*	@param vib_profile the address of the vibration profile to play when a threshold is crossed.
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk7_configure_heading_feedback(shake_device* sh, int lower_threshold, int upper_threshold, int hysteresis, int vib_profile);
+
+/**	SK7 only. Enable/disable heading vibration feedback partially or completely 
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param enabled set to 0 to disable ALL heading feedback, any other value to enable it
+*	@param vib_looping set to 0 to disable vibration looping, any other value to enable it
+*	@param led_feedback set to 0 to disable LED feedback when a threshold is crossed, any other value to enable it
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk7_control_heading_feedback(shake_device* sh, int enabled, int vib_looping, int led_feedback);
+
+/**	SK7 only. Configure output of roll-pitch-heading packet in firmware >= v1.00
+*
+*	The value parameter should be set as follows (21/6/09):
+*		0:	disable RPH output, use old heading only packet instead
+*		1:	output RPH packets using accelerometer and magnetometer to calculate the data
+*	More options may be available in future firmware releases.
+*	
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param value the value to write into the roll-pitch-heading configuration register
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int sk7_configure_roll_pitch_heading(shake_device* sh, int value);
+
+/* 	=== Basic register access functions === 
+*	These functions allow you direct access to the various registers on the device.
+*	Usually it's easier to use one of the functions above, which don't involve
+*	searching for the correct register address or checking if a register is
+*	read/write etc. */
+
+/** Reads one of the SHAKE device configuration registers and returns its contents.
+*
+*	This function can be used to read the contents of any valid register (as an alternative to using
+*	the other register specific functions).
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param addr the register address (use one of the SHAKE_NV_REG/VO_REG constants from shake_registers.h)
+*	@param value pointer to an unsigned char variable which will receive the contents of the register 
+*	
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_read(shake_device* sh, int addr, unsigned char* value);
+
+/** Writes a value into one of the SHAKE device configuration registers.
+*
+*	This function can be used to write a value into any valid register (as an alternative to using
+*	the other register specific functions).
+*
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param addr the register address (use one of the SHAKE_NV_REG/VO_REG constants from shake_registers.h)
+*	@param value the value that will be placed into the register (note that the range
+*		of values is dependent on the selected register, see user manual for details)
+* 
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_write(shake_device* sh, int addr, unsigned char value);
+
+/* 	=== Asynchronous register access functions === 
+*	These functions send a register read or write and return straight away, without waiting for the 
+*	SHAKE to reply. Each reply is matched to the command it belongs to by the register address it 
+*	carries, so any number of threads can have commands outstanding at once, and by raising the 
+*	command window with shake_set_command_window() several reads can be kept in flight to hide the
+*	Bluetooth round trip time. shake_read() and shake_write() are built on the same mechanism.
+*
+*	The result of each command is delivered through a shake_future, a callback, or both. A 
+*	command always completes, at the latest when it times out (after SHAKE_COMMAND_TIMEOUT_MS) 
+*	or the device is closed. */
+
+/**	Holds the result of a command sent with shake_read_async() or shake_write_async(). The
+*	structure belongs to the application, and must stay valid until <status> has changed from
+*	SHAKE_COMMAND_PENDING. The driver changes <status> last, so once it has changed the other 
+*	fields are valid too. */
+typedef struct {
+	/** one of the values from shake_command_status */
+	volatile int status;
+	/** register address of the command */
+	int address;
+	/** value of the register returned by the SHAKE (read commands only) */
+	unsigned char value;
+} shake_future;
+
+/**	Called when a command sent with shake_read_async() or shake_write_async() completes. It is 
+*	normally called from the driver's internal thread that reads data from the SHAKE, so it should 
+*	return quickly, and must not call shake_read(), shake_write() or shake_future_wait() since the
+*	reply they wait for can't arrive until the callback returns. A command that times out is 
+*	completed by whichever thread notices first: the driver's callback thread checks every 
+*	60ms or so while commands are in flight, but a thread waiting for a reply may get there first.
+*	@param sh the device the command was sent to
+*	@param address register address of the command
+*	@param status one of SHAKE_COMMAND_ACK, SHAKE_COMMAND_NAK or SHAKE_COMMAND_TIMEOUT
+*	@param value value of the register (read commands only)
+*	@param user the <user> pointer passed when the command was sent */
+typedef void (SHAKE_CALLBACK *shake_command_callback)(shake_device* sh, int address, int status, unsigned char value, void* user);
+
+/** how long (ms) the driver waits for the reply to a command before giving up */
+#define SHAKE_COMMAND_TIMEOUT_MS 250
+
+/** the largest number of commands that can be waiting for a reply at once */
+#define SHAKE_COMMAND_MAX_WINDOW 16
+
+/**	Sends a register read command to the SHAKE without waiting for the reply. If the command window
+*	is full, this waits for an earlier command to complete first.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param addr the register address (use one of the SHAKE_NV_REG/VO_REG constants from shake_registers.h)
+*	@param future optional pointer to a shake_future which receives the result
+*	@param callback optional function called with the result
+*	@param user passed to <callback>
+*
+*	@return SHAKE_SUCCESS if the command was sent, SHAKE_ERROR if not (the future and callback 
+*	are not used in that case) */
+SHAKE_API int shake_read_async(shake_device* sh, int addr, shake_future* future, shake_command_callback callback, void* user);
+
+/**	Sends a register write command to the SHAKE without waiting for the reply, in the same way as
+*	shake_read_async(). The reply is always waited for, whatever shake_wait_for_acks() was set to.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param addr the register address (use one of the SHAKE_NV_REG/VO_REG constants from shake_registers.h)
+*	@param value the value that will be placed into the register
+*	@param future optional pointer to a shake_future which receives the result
+*	@param callback optional function called with the result
+*	@param user passed to <callback>
+*
+*	@return SHAKE_SUCCESS if the command was sent, SHAKE_ERROR if not */
+SHAKE_API int shake_write_async(shake_device* sh, int addr, unsigned char value, shake_future* future, shake_command_callback callback, void* user);
+
+/**	Waits for a command sent with shake_read_async() or shake_write_async() to complete.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param future the shake_future passed when the command was sent
+*	@param timeout_ms longest time to wait in milliseconds, or -1 to wait until the command completes
+*
+*	@return the status of the command, which is still SHAKE_COMMAND_PENDING if the wait timed out */
+SHAKE_API int shake_future_wait(shake_device* sh, shake_future* future, int timeout_ms);
+
+/**	Sets how many commands can be waiting for a reply from the SHAKE at once. The default is 1, 
+*	which sends each command only once the reply to the previous one has arrived. 
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param window number of commands, from 1 to SHAKE_COMMAND_MAX_WINDOW
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_set_command_window(shake_device* sh, int window);
+
+/* 	=== Batch register access functions ===
+*	These functions read or write a list of registers in one call. The commands are streamed to the
+*	SHAKE without waiting for each reply before sending the next, so configuring a device costs
+*	roughly one Bluetooth round trip instead of one per register. The result of every register is
+*	reported separately. */
+
+/**	One register in a batch read or write. */
+typedef struct {
+	/** register address (use one of the SHAKE_NV_REG/VO_REG constants from shake_registers.h) */
+	int address;
+	/** value to write, or the value read back */
+	unsigned char value;
+	/**	one of the values from shake_command_status. Entries which were never sent (because the
+	*	connection failed part way through a batch) are left as SHAKE_COMMAND_PENDING */
+	int status;
+} shake_register_entry;
+
+/**	the number of commands a batch keeps waiting for a reply at once, unless the command window
+*	set with shake_set_command_window() is larger */
+#define SHAKE_BATCH_WINDOW 8
+
+/** enough entries to hold a snapshot of the non-volatile registers of either device type */
+#define SHAKE_NV_SNAPSHOT_MAX 64
+
+/**	Writes a list of registers, in order. Each write is acknowledged individually whatever
+*	shake_wait_for_acks() was set to, and the <status> field of each entry is filled in.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param entries the registers to write, with the <address> and <value> fields filled in
+*	@param count number of entries
+*
+*	@return SHAKE_SUCCESS if every write was acknowledged, SHAKE_ERROR otherwise */
+SHAKE_API int shake_write_batch(shake_device* sh, shake_register_entry* entries, int count);
+
+/**	Reads a list of registers, in order, filling in the <value> and <status> fields of each entry.
+*	<value> is only valid for entries whose status is SHAKE_COMMAND_ACK.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param entries the registers to read, with the <address> field filled in
+*	@param count number of entries
+*
+*	@return SHAKE_SUCCESS if every read was acknowledged, SHAKE_ERROR otherwise */
+SHAKE_API int shake_read_batch(shake_device* sh, shake_register_entry* entries, int count);
+
+/**	Reads every non-volatile register of the device (the set depends on whether it is an SK6 or SK7)
+*	so the configuration can be put back later with shake_nv_restore().
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param entries receives one entry per register. SHAKE_NV_SNAPSHOT_MAX entries are always enough.
+*	@param max_entries number of entries available
+*	@param count receives the number of entries filled in
+*
+*	@return SHAKE_SUCCESS if every register was read, SHAKE_ERROR otherwise (including when
+*	<max_entries> is too small, in which case nothing is read) */
+SHAKE_API int shake_nv_snapshot(shake_device* sh, shake_register_entry* entries, int max_entries, int* count);
+
+/**	Writes back registers saved by shake_nv_snapshot(). Entries which weren't read successfully
+*	are skipped and left unchanged, the <status> of the others is replaced with the result of the write.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param entries the snapshot
+*	@param count number of entries in the snapshot
+*
+*	@return SHAKE_SUCCESS if every register that was written was acknowledged, SHAKE_ERROR otherwise */
+SHAKE_API int shake_nv_restore(shake_device* sh, shake_register_entry* entries, int count);
+
+/* 	=== Register shadow functions ===
+*	Almost all the non-volatile (SHAKE_NV_REG_*) registers only change when the host writes them, so the
+*	driver can keep a copy of their values and answer reads itself instead of waiting for a 
+*	round trip to the SHAKE. The copy of each register is filled in when a read of it (including
+*	a batch read or shake_nv_snapshot()) or a write to it is acknowledged. Reads of registers it
+*	doesn't hold yet, of the volatile (SHAKE_VO_REG_*) registers, and of the logging packet count
+*	(SHAKE_NV_REG_LOGGING_PKT_LSB/MSB, which the device updates itself) always go to the device. 
+*	shake_get_stats() reports how many reads the shadow answered. 
+*
+*	The shadow is off by default. If the registers may have been changed some other way (eg by
+*	another program while the device was disconnected) call shake_invalidate_register_shadow(). */
+
+/** address passed to shake_invalidate_register_shadow() to forget every register */
+#define SHAKE_SHADOW_ALL -1
+
+/**	Turns the register shadow on or off. Either way, any register values it already holds are forgotten.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param enabled 1 to answer reads of non-volatile registers from the shadow, 0 to always read the device
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_enable_register_shadow(shake_device* sh, int enabled);
+
+/**	Makes the register shadow forget the value of a register, so the next read goes to the device.
+*	@param sh pointer to a shake_device structure as returned by shake_init_device()
+*	@param addr the register address, or SHAKE_SHADOW_ALL for every register
+*
+*	@return SHAKE_SUCCESS or SHAKE_ERROR */
+SHAKE_API int shake_invalidate_register_shadow(shake_device* sh, int addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SHAKE_HEADER_ */
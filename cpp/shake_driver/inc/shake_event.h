@@ -0,0 +1,66 @@
+#ifndef _SHAKE_EVENT_H_
+#define _SHAKE_EVENT_H_
+
+
+
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	Passing events (nav switch, capacitive switches, shaking, RFID etc) from the packet parsing code 
+*	to the application's callbacks. Each device has a bounded queue of events which any thread 
+*	can add to without a lock. The events are taken off by whichever thread the device's dispatch
+*	mode chooses: its callback thread (or its reactor's), a pool shared between devices, or the
+*	thread that posted the event. */
+
+/* sets up the event queue of a new device, delivering events from its callback thread */
+void shake_event_init(shake_device_private* devpriv);
+
+/*	takes the device out of the pool (if it's using it) and frees the queue. Only called once
+*	nothing can post any more events, and the callback threads have stopped. Returns FALSE if
+*	this is being called from a callback run by a pool thread delivering the device's events, in
+*	which case nothing is freed yet: the last pool thread holding the device calls 
+*	shake_release_device() once it lets go */
+BOOL shake_event_free(shake_device_private* devpriv);
+
+/* frees the memory of a device after shake_event_free() (in shake_driver.cpp) */
+void shake_release_device(shake_device_private* devpriv);
+
+/* TRUE if the application has registered a callback, so events are worth posting */
+BOOL shake_event_wanted(shake_device_private* devpriv);
+
+/*	adds an event of type <type> to the queue, timestamped with the arrival time of the current 
+*	packet, and arranges for it to be delivered. If the queue is full the event is dropped */
+void shake_event_post(shake_device_private* devpriv, int type);
+
+/*	gets the queued events (and any microphone audio waiting for the mic callback) delivered in
+*	the way the device's dispatch mode says */
+void shake_event_notify(shake_device_private* devpriv);
+
+/*	passes every queued event to the callbacks, then any complete blocks of microphone audio.
+*	Called by whichever thread is delivering events for the device; if another thread is already
+*	doing so this waits for it to finish first */
+void shake_event_dispatch(shake_device_private* devpriv);
+
+/* switches the device to dispatch mode <mode>. Returns SHAKE_SUCCESS or SHAKE_ERROR */
+int shake_event_set_mode(shake_device_private* devpriv, int mode);
+
+#endif /* _SHAKE_EVENT_H_ */
@@ -1,36 +1,143 @@
-#ifndef _SHAKE_PACKETS_
-#define _SHAKE_PACKETS_
-
-/*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#include "shake_platform.h"
-#include "shake_thread.h"
-
-#define SHAKE_BAD_PACKET (-1)
-
-int dec_ascii_to_int(char* ascii_buf, int buflen, int digits);
-int hex_ascii_to_int(char* ascii_buf, int buflen, int digits);
-
-/* used to assign a different numeric ID to each SK6 device on the local machine */
-static int shake_handle_count = 0;
-
-#include "SK6_packets.h"
-#include "SK7_packets.h"
-
+#ifndef _SHAKE_PACKETS_
+#define _SHAKE_PACKETS_
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_platform.h"
+#include "shake_thread.h"
+#include <string.h>
+
+#define SHAKE_BAD_PACKET (-1)
+
+/* general purpose ASCII field decoders, handle fields of any width */
+int dec_ascii_to_int(char* ascii_buf, int buflen, int digits);
+int hex_ascii_to_int(char* ascii_buf, int buflen, int digits);
+
+/*	Fixed format decimal decoder for ASCII fields carrying fractional values ([+-]ddd.ddddd), 
+*	used instead of sscanf/atof so parsing is independent of the C locale and doesn't have to 
+*	terminate the field first. Returns the number of characters consumed (0 if there was no 
+*	number at the start of the buffer) and places the value in *value. */
+int dec_ascii_to_float(char* ascii_buf, int buflen, float* value);
+/*	Decodes up to count comma separated decimal fields (e.g. the SK7 quaternion data), returning
+*	the number of values successfully decoded. */
+int dec_ascii_to_floats(char* ascii_buf, int buflen, float* values, int count);
+
+/*	Checks the checksum on an ASCII packet of <packet_size> bytes, which ends with a separator, 
+*	2 hex digits and the \r\n terminator. The checksum is taken to be the XOR of every character 
+*	between the leading $ and the separator, as in NMEA sentences. The SHAKE documentation doesn't
+*	give the algorithm and this hasn't been confirmed against a device yet, so a FALSE result must 
+*	only be counted (stats.checksum_failures), never used to drop a packet. Returns TRUE if it matches. */
+BOOL ascii_checksum_ok(char* packet, int packet_size);
+
+/*	Fixed width decoders for the field formats used in ASCII data packets. These run once per field
+*	on every packet, so on little endian machines they decode all the digits of a field at once using 
+*	plain integer arithmetic (SWAR, "SIMD within a register") instead of looping over each digit.
+*	Define SHAKE_NO_SWAR to use the simple per-digit versions instead. */
+#if !defined(SHAKE_NO_SWAR) && !(defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define SHAKE_SWAR_DECODE 1
+#endif
+
+// dddd: 4 decimal digits
+static inline int dec_ascii4_to_int(char* ascii_buf) {
+#ifdef SHAKE_SWAR_DECODE
+	unsigned int x;
+	memcpy(&x, ascii_buf, 4);
+	x &= 0x0F0F0F0F;								// one digit value per byte, first digit lowest
+	x = (x * 10 + (x >> 8)) & 0x00FF00FF;			// pairs of digits, 0-99 in each 16 bit half
+	return (x * 100 + (x >> 16)) & 0xFFFF;
+#else
+	return (ascii_buf[0] - '0') * 1000 + (ascii_buf[1] - '0') * 100 + (ascii_buf[2] - '0') * 10 + (ascii_buf[3] - '0');
+#endif
+}
+
+// sdddd: sign character (- for negative values, anything else for positive) followed by 4 decimal digits
+static inline int dec_ascii4s_to_int(char* ascii_buf) {
+	int neg = (ascii_buf[0] == '-');
+	return (dec_ascii4_to_int(ascii_buf + 1) ^ -neg) + neg;
+}
+
+// dd: 2 decimal digits, used for packet sequence numbers
+static inline int dec_ascii2_to_int(char* ascii_buf) {
+#ifdef SHAKE_SWAR_DECODE
+	unsigned short x;
+	memcpy(&x, ascii_buf, 2);
+	x &= 0x0F0F;
+	return (x * 10 + (x >> 8)) & 0xFF;
+#else
+	return (ascii_buf[0] - '0') * 10 + (ascii_buf[1] - '0');
+#endif
+}
+
+// XX: 2 hex digits (0-9, A-F or a-f)
+static inline int hex_ascii2_to_int(char* ascii_buf) {
+#ifdef SHAKE_SWAR_DECODE
+	unsigned int x = 0;
+	memcpy(&x, ascii_buf, 2);
+	x = (x & 0x0F0F) + 9 * ((x >> 6) & 0x0101);	// letters have bit 6 set, their low nibble is 1-6
+	return ((x & 0xFF) << 4) | (x >> 8);
+#else
+	int hi = ascii_buf[0], lo = ascii_buf[1];
+	return (((hi & 0xF) + 9 * ((hi >> 6) & 1)) << 4) | ((lo & 0xF) + 9 * ((lo >> 6) & 1));
+#endif
+}
+
+// XXXX: 4 hex digits (0-9, A-F or a-f)
+static inline int hex_ascii4_to_int(char* ascii_buf) {
+	return (hex_ascii2_to_int(ascii_buf) << 8) | hex_ascii2_to_int(ascii_buf + 2);
+}
+
+/* number of slots in the ASCII header hash table, must be a power of 2 and comfortably
+*	larger than the number of ASCII packet types */
+#define SHAKE_HEADER_LOOKUP_SIZE	128
+
+/*	lookup tables used to classify packet headers in constant time. These are built once from
+*	the packet header tables in SK6_packets.h/SK7_packets.h, so they can never get out of step
+*	with the packet definitions. ASCII headers are treated as a 4 byte integer key into a 
+*	small open addressing hash table, while raw headers are a direct index on the type byte. */
+typedef struct {
+	unsigned int ascii_keys[SHAKE_HEADER_LOOKUP_SIZE];
+	signed char ascii_types[SHAKE_HEADER_LOOKUP_SIZE];	// SHAKE_BAD_PACKET for empty slots
+	signed char raw_types[256];							// SHAKE_BAD_PACKET for unused type bytes
+	volatile int state;									// SHAKE_LOOKUP_EMPTY/BUILDING/BUILT, see below
+} shake_header_lookup;
+
+#define SHAKE_LOOKUP_EMPTY		0
+#define SHAKE_LOOKUP_BUILDING	1
+#define SHAKE_LOOKUP_BUILT		2
+
+/*	fills in <lookup> from a table of <num_ascii> 4 character ASCII headers (types 0 to num_ascii-1) and 
+*	a table of <num_raw> raw header type bytes (types first_raw_type to first_raw_type+num_raw-1).
+*	Called from every device's constructor on a zero initialised static <lookup>, and only builds it
+*	the first time: devices may be created on several threads at once, so the first caller claims 
+*	the table with shake_atomic_cas() and any others wait until it is marked SHAKE_LOOKUP_BUILT. */
+void shake_build_header_lookup(shake_header_lookup* lookup, char** ascii_headers, int num_ascii, char* raw_headers, int num_raw, int first_raw_type);
+
+/* returns the packet type for a 4 byte ASCII header, or SHAKE_BAD_PACKET if not recognised */
+int shake_lookup_ascii_header(shake_header_lookup* lookup, char* header);
+
+/* returns the packet type for a 3 byte raw header (0x7F 0x7F <type>), or SHAKE_BAD_PACKET if not recognised */
+#define shake_lookup_raw_header(lookup, header) ((lookup)->raw_types[(unsigned char)(header)[2]])
+
+/* used to assign a different numeric ID to each SK6 device on the local machine */
+static int shake_handle_count = 0;
+
+#include "SK6_packets.h"
+#include "SK7_packets.h"
+
 #endif
\ No newline at end of file
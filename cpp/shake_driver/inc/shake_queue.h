@@ -0,0 +1,103 @@
+#ifndef _SHAKE_QUEUE_H_
+#define _SHAKE_QUEUE_H_
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+#include "shake_clock.h"
+
+/*	Per-sensor sample queues and latest sample blocks. Samples are added by the reader thread 
+*	as packets are parsed and read by the application, see shake_sample_queue and 
+*	shake_sensor_block in shake_structs.h. */
+
+// allocates the queue for <sensor> (if required) and enables/disables it
+int shake_queue_enable(shake_device_private* devpriv, int sensor, int depth);
+
+// frees all the queues for a device, only safe once the reader thread has stopped
+void shake_queue_free(shake_device_private* devpriv);
+
+// copies up to <max> queued samples into <samples> and removes them from the queue
+int shake_queue_pop(shake_sample_queue* q, shake_sample* samples, int max);
+
+// returns the number of samples waiting in a queue
+int shake_queue_count(shake_sample_queue* q);
+
+// copies a consistent copy of the latest sample from <sensor> into <sample>, and its packet counts into <stats> if not NULL
+void shake_read_sensor(shake_device_private* devpriv, int sensor, shake_sample* sample, shake_stream_stats* stats);
+
+/*	wakes any threads waiting in shake_wait_sample() for samples published since the last call. 
+*	The reader thread calls this before it goes back to the port for more data rather than 
+*	for every packet, so bursts of packets only cost one wakeup */
+void shake_wake_sample_waiters(shake_device_private* devpriv);
+
+/*	adds a sample to the queue for <sensor>. Called by the reader thread for every sensor packet,
+*	so it's inline and returns straight away if the queue isn't enabled */
+static inline void shake_queue_push(shake_device_private* devpriv, int sensor, const shake_sample* sample) {
+	shake_sample_queue* q = &(devpriv->queues[sensor]);
+	unsigned int tail;
+
+	if(!shake_atomic_load_acquire(&(q->enabled)))
+		return;
+
+	// only look at the application's side of the queue when it appears to be full
+	tail = q->tail;
+	if(tail - q->head_cache > q->mask) {
+		q->head_cache = shake_atomic_load_acquire(&(q->head));
+		if(tail - q->head_cache > q->mask) {
+			q->overflows++;
+			return;
+		}
+	}
+
+	q->samples[tail & q->mask] = *sample;
+
+	// make the sample visible to the application before the new tail
+	shake_atomic_store_release(&(q->tail), tail + 1);
+}
+
+/*	publishes a new sample from <sensor>. Called by the reader thread after the sensor data 
+*	in the packet has been decoded. <seq_range> is SHAKE_ASCII_SEQ_RANGE or SHAKE_RAW_SEQ_RANGE 
+*	depending on the type of packet the sample came from */
+static inline void shake_update_sensor(shake_device_private* devpriv, int sensor, int v0, int v1, int v2, int seq, int seq_range) {
+	shake_sensor_block* b = &(devpriv->sensors[sensor]);
+	unsigned int version = b->version;
+	shake_sample s;
+
+	s.values[0] = v0;
+	s.values[1] = v1;
+	s.values[2] = v2;
+	s.seq = seq;
+	s.timestamp = devpriv->packet_time;
+	shake_clock_update(&(devpriv->clocks[sensor]), seq_range, &s);
+
+	// odd version tells the application the block is being updated
+	b->version = version + 1;
+	shake_atomic_fence_release();
+
+	b->sample = s;
+	b->stats = devpriv->clocks[sensor].stats;
+
+	shake_atomic_store_release(&(b->version), version + 2);
+	devpriv->samples_pending = TRUE;
+
+	shake_queue_push(devpriv, sensor, &s);
+}
+
+#endif /* _SHAKE_QUEUE_H_ */
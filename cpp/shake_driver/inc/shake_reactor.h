@@ -0,0 +1,51 @@
+#ifndef _SHAKE_REACTOR_H_
+#define _SHAKE_REACTOR_H_
+
+
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	Reactor threads, see shake_reactor_start(). Each reactor thread waits on an epoll set 
+*	holding the ports of all of its devices, and whenever one becomes readable it parses every
+*	complete packet that has arrived, using the same parsing code as the per-device reader 
+*	threads. Devices on a reactor thread share one callback thread for their events. */
+
+/*	hands the device over to the least busy reactor thread. Returns SHAKE_SUCCESS, or SHAKE_ERROR
+*	if reactor mode is off or the connection type can't be waited on with epoll, in which case the 
+*	device needs its own threads as usual. On success the device's thread objects have been set up 
+*	but no threads have been started for it */
+int shake_reactor_attach(shake_device_private* devpriv);
+
+/*	takes a device away from its reactor thread, returning once neither the reactor thread nor 
+*	its callback thread will touch the device again. Returns SHAKE_ERROR without doing anything 
+*	if called from either of those threads (ie from a callback), since that would never return */
+int shake_reactor_detach(shake_device_private* devpriv);
+
+/*	wakes the reactor thread of the device, so that it starts checking the device's commands for 
+*	timeouts (see shake_command_tick()) */
+void shake_reactor_wake(shake_device_private* devpriv);
+
+/*	queues the device for the callback thread of its reactor, which delivers its waiting events 
+*	with shake_event_dispatch(). Only used for devices in SHAKE_DISPATCH_THREAD mode */
+void shake_reactor_signal_event(shake_device_private* devpriv);
+
+#endif
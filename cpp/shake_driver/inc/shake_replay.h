@@ -0,0 +1,68 @@
+#ifndef _SHAKE_REPLAY_H_
+#define _SHAKE_REPLAY_H_
+
+
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	Replaying recorded data in place of a live connection. A recording is either a plain copy of
+*	the bytes sent by a device, or a capture file in the format below, which also records when 
+*	each chunk of data arrived from the device. Both are mapped into memory in one go and handed
+*	to the input buffer from there. */
+
+/*	A capture file starts with a shake_capture_header. It is followed by any number of chunks, 
+*	each of which is a shake_capture_chunk followed by <length> bytes of data. All values are 
+*	little-endian. Capture files are written by shake_capture_start(), see shake_capture.h.
+*	Chunks of commands sent to the device are skipped when the file is replayed */
+#define SHAKE_CAPTURE_MAGIC "SHAKECAP"
+#define SHAKE_CAPTURE_VERSION 1
+
+typedef struct {
+	char magic[8];				// SHAKE_CAPTURE_MAGIC, not null terminated
+	unsigned int version;		// SHAKE_CAPTURE_VERSION
+	unsigned int device_type;	// SHAKE_SK6 or SHAKE_SK7
+} shake_capture_header;
+
+typedef struct {
+	SHAKE_INT64 time_us;		// arrival time of the data in microseconds, from any starting point
+	unsigned int length;		// number of bytes of data following this header
+	unsigned int flags;			// SHAKE_CAPTURE_SENT or 0
+} shake_capture_chunk;
+
+// chunk flag for data sent to the device rather than received from it
+#define SHAKE_CAPTURE_SENT 1
+
+/*	opens <filename> for replay in the given <mode> (one of shake_replay_modes), at <speed> times 
+*	real time for SHAKE_REPLAY_SPEED. Returns the <replay> pointer on success, NULL on failure. */
+shake_replay* shake_open_replay(shake_replay* replay, char* filename, int device_type, int mode, float speed);
+
+/*	reads up to <bytes_to_read> bytes of the recording into <buf>, waiting until they are due in 
+*	the paced modes. Returns number of bytes read, or 0 once the end of the recording has been reached. */
+int read_replay_bytes(shake_device_private* devpriv, char* buf, int bytes_to_read);
+
+/*	stops a reader thread waiting in read_replay_bytes(), so it notices it has to exit. Always returns 1. */
+int shake_wake_replay(shake_device_private* devpriv);
+
+/*	unmaps the recording. Always returns 1. */
+int shake_close_replay(shake_replay* replay);
+
+#endif /* _SHAKE_REPLAY_H_ */
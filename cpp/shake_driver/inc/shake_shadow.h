@@ -0,0 +1,63 @@
+#ifndef _SHAKE_SHADOW_H_
+#define _SHAKE_SHADOW_H_
+
+
+
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	The register shadow, an optional host copy of a device's non-volatile registers. These only 
+*	change when the host writes them, so once a value is known (from a read, or an acknowledged
+*	write) later reads can be answered without asking the device. The volatile registers 
+*	(SHAKE_VO_REG_*, at SHAKE_SHADOW_REGISTERS and above) are never shadowed, and neither are the 
+*	few non-volatile registers the device updates itself, such as the logging packet count.
+*
+*	Every command that might change a register takes a token from shake_shadow_begin() before it 
+*	is sent, and only stores the value from its reply if nothing else has written or invalidated
+*	the register since. */
+
+/* sets up the shadow of a new device, initially disabled */
+void shake_shadow_init(shake_device_private* devpriv);
+
+/* frees the shadow when the device is freed */
+void shake_shadow_free(shake_device_private* devpriv);
+
+/* turns the shadow on or off. Either way any values already held are forgotten */
+void shake_shadow_enable(shake_device_private* devpriv, BOOL enabled);
+
+/*	looks up register <addr>, counting a hit or miss if it's a register the shadow covers. Returns 
+*	TRUE and fills in <value> if the shadow holds its value */
+BOOL shake_shadow_lookup(shake_device_private* devpriv, int addr, unsigned char* value);
+
+/*	called before a read (<write> FALSE) or write of register <addr> is sent. A write forgets 
+*	any value held for the register, since the device may or may not end up with the new one. 
+*	Returns the token to pass to shake_shadow_store() */
+unsigned int shake_shadow_begin(shake_device_private* devpriv, int addr, BOOL write);
+
+/*	records that register <addr> holds <value>, once the command which began with <token> has
+*	been ACKed. Ignored if the register has been written or invalidated since */
+void shake_shadow_store(shake_device_private* devpriv, int addr, unsigned int token, unsigned char value);
+
+/* forgets the value held for register <addr>, or for every register if <addr> is SHAKE_SHADOW_ALL */
+void shake_shadow_invalidate(shake_device_private* devpriv, int addr);
+
+#endif /* _SHAKE_SHADOW_H_ */
@@ -0,0 +1,69 @@
+#ifndef _SHAKE_STATS_H_
+#define _SHAKE_STATS_H_
+
+
+
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	Driver performance counters, see shake_get_stats(). The hooks below are called from the 
+*	driver threads for every byte read and packet parsed, so they are kept inline and cheap. */
+
+// the reader thread times one packet in this many (a power of 2) to split framing from decoding
+#define SHAKE_STATS_TIMING_INTERVAL 64
+
+/* adds <v> to a counter with a single writer, so no locked instruction is needed */
+#define shake_stats_add(p, v) shake_atomic_store_relaxed((p), shake_atomic_load_relaxed(p) + (v))
+
+/* converts an interval in seconds into nanoseconds */
+#define shake_stats_ns(seconds) ((SHAKE_INT64)((seconds) * 1e9))
+
+/*	records a latency of <seconds> in a histogram with SHAKE_STATS_LATENCY_BINS power of 2 
+*	bins, the first covering everything under 1 microsecond */
+static inline void shake_stats_latency(volatile unsigned int* hist, double seconds) {
+	double us = seconds * 1e6;
+	int bin = 0;
+
+	while(us >= 1.0 && bin < SHAKE_STATS_LATENCY_BINS - 1) {
+		us *= 0.5;
+		bin++;
+	}
+	shake_stats_add(&(hist[bin]), 1);
+}
+
+static inline void shake_stats_packet(shake_device_private* devpriv, int packet_type) {
+	if(packet_type >= 0 && packet_type < SHAKE_STATS_PACKET_TYPES)
+		shake_stats_add(&(devpriv->stats.packets[packet_type]), 1);
+}
+
+static inline void shake_stats_resync(shake_device_private* devpriv, int bytes_discarded) {
+	shake_stats_add(&(devpriv->stats.resyncs), 1);
+	shake_stats_add(&(devpriv->stats.resync_bytes), bytes_discarded);
+}
+
+/* copies the current counters into <counters>, one field at a time */
+void shake_stats_snapshot(shake_device_private* devpriv, shake_stats_counters* counters);
+
+/*	fills in <stats> with the counters accumulated since the last reset (or since the device was
+*	opened), scaling the sampled framing and decoding times up to cover all packets */
+void shake_stats_get(shake_device_private* devpriv, shake_stats* stats);
+
+#endif
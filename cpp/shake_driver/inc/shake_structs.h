@@ -1,148 +1,418 @@
-#ifndef _SHAKE_STRUCTS_H_
-#define _SHAKE_STRUCTS_H_
-
-/*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-
-#include "shake_platform.h"
-#include "shake_thread.h"
-#include "shake_registers.h"
-
-/* holds pointer to and data about BT serial port being used */
-typedef struct {
-#ifdef _WIN32
-	HANDLE port;
-	DCB dcb;
-	COMMTIMEOUTS cto;
-#endif
-} shake_serial_port_win32;
-
-typedef struct {
-#ifndef _WIN32
-	int port;
-#endif
-} shake_serial_port_usb;
-
-#include "shake_btdefs.h"
-
-#ifdef SHAKE_RFCOMM_SUPPORTED
-	#ifdef _WIN32
-		typedef struct {
-			SOCKET sock;
-			SOCKADDR_BTH addr;
-		} shake_rfcomm_socket;
-	#else
-	typedef struct {
-		int sock;
-	} shake_rfcomm_socket;
-	#endif
-#endif
-
-typedef struct {
-	int comms_type;
-	#ifdef _WIN32
-	shake_serial_port_win32 serial_win32;
-	#endif
-	#ifndef _WIN32
-	shake_serial_port_usb serial_usb;
-	#endif
-	#ifdef SHAKE_RFCOMM_SUPPORTED
-		shake_rfcomm_socket rfcomm;
-	#endif
-	FILE* dbg_read;
-	FILE* dbg_write;
-} shake_port;
-
-enum shake_connection_types {
-	SHAKE_CONN_VIRTUAL_SERIAL_WIN32 = 0,
-	SHAKE_CONN_RFCOMM_I64,
-	SHAKE_CONN_RFCOMM_STR,
-	SHAKE_CONN_DEBUGFILE,
-	SHAKE_CONN_S60_RFCOMM, 
-	SHAKE_CONN_USB_SERIAL,
-};
-
-typedef struct {
-	int type;
-	int com_port;
-	SHAKE_INT64 btaddr;
-	char btaddr_str[20];
-	char readfile[256];
-	char writefile[256];
-	int devtype;
-	char usbdev[128];
-} shake_conn_data;
-
-class SHAKE;
-
-/* private data about a shake device, hidden from user */
-typedef struct {
-	int device_type;
-	SHAKE* shake;
-
-	shake_port port;			// structure containing port details
-	shake_thread thread;		// structure containing threading objects
-	BOOL rthread_done;			// indicates when the reader thread should exit
-	BOOL cthread_done;
-	BOOL rthread_exit;			
-
-	BOOL waiting_for_ack;		// TRUE if currently expecting an ACK/NAK, FALSE otherwise
-	BOOL waiting_for_ack_signal; 	// TRUE if app is waiting for an ack to arrive, FALSE otherwise
-	//BOOL synced;				// TRUE if packet reading code is synced properly
-	char serial[20];			// Serial number
-	float fwrev;				// Firmware revision
-	float hwrev;				// Hardware revision
-	char lastrfid[SHAKE_RFID_TAG_LENGTH];			// Last RFID tag ID found
-	//int module1;				// expansion module in slot 1
-	//int module2;				// expansion module in slot 2
-	int modules[4];				// expansion module IDs. SK6 has 2, SK7 has 4
-	float bluetoothfwrev;		// Bluetooth firmware revision (SK7 only)
-
-	BOOL checksum;				// TRUE if device has checksums enabled
-	//BOOL ascii_mode;			// TRUE if device in ASCII output mode, FALSE if not
-	void (SHAKE_CALLBACK *navcb)(void*, int);	// callback func for events
-	long long data_recv;		// total data received
-	int wait_for_acks;			// set to 1 if the driver should wait for an ACK after sending a command
-	BOOL lastack;				// TRUE if last ack was positive, FALSE if negative
-	int lastaddr, lastval;		// Address and value from last ack received
-
-#ifdef _WIN32
-	void (SHAKE_STDCALL_CALLBACK *navcb_STDCALL)(void*, int);	// callback func for events
-#else
-	void *navcb_STDCALL;
-#endif
-
-	void (SHAKE_CALLBACK *audio_cb)(void*, short*, int, short*, int);
-
-#ifdef _WIN32
-	void (SHAKE_STDCALL_CALLBACK *audio_cb_STDCALL)(void*, short*, int, short*, int);
-#else
-	void *audio_cb_STDCALL;
-#endif
-	short audiobuf[SHAKE_AUDIO_DATA_LEN];
-	short playbackbuf[SHAKE_AUDIO_DATA_LEN];
-	char playback_packet[5+SHAKE_AUDIO_DATA_LEN];
-	int lastevent;				// last nav/cap switch event received
-	FILE* log;					// output file pointer for writing logged data into
-	unsigned long packets_read;	// gives number of logged packets received when playing back data from SHAKE
-	BOOL peek_flag;
-	char peek;
-} shake_device_private;
-
-#endif
+#ifndef _SHAKE_STRUCTS_H_
+#define _SHAKE_STRUCTS_H_
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "shake_platform.h"
+#include "shake_thread.h"
+#include "shake_registers.h"
+#include "shake_driver.h"
+
+/* holds pointer to and data about BT serial port being used */
+typedef struct {
+#ifdef _WIN32
+	HANDLE port;
+	DCB dcb;
+	COMMTIMEOUTS cto;
+#endif
+} shake_serial_port_win32;
+
+typedef struct {
+#ifndef _WIN32
+	int port;
+	int wakefd[2];		// pipe written to by shake_wake_serial_usb() to interrupt a blocked read
+#endif
+} shake_serial_port_usb;
+
+#include "shake_btdefs.h"
+
+#ifdef SHAKE_RFCOMM_SUPPORTED
+	#ifdef _WIN32
+		typedef struct {
+			SOCKET sock;
+			SOCKADDR_BTH addr;
+		} shake_rfcomm_socket;
+	#else
+	typedef struct {
+		int sock;
+		int wakefd[2];		// pipe written to by shake_wake_rfcomm() to interrupt a blocked read
+	} shake_rfcomm_socket;
+	#endif
+#endif
+
+/* a recording being replayed in place of a live connection, see shake_replay.h */
+typedef struct {
+	char* data;					// the whole file, mapped into memory
+	SHAKE_INT64 size;
+	SHAKE_INT64 pos;			// offset of the next byte to read from <data>
+	int mode;					// one of shake_replay_modes
+	double speed;				// playback speed multiplier (1.0 = real time)
+	double byte_rate;			// rate a plain recording is replayed at (bytes/s at the device's baud rate)
+	BOOL timestamped;			// TRUE for a capture file, made of timestamped chunks of data
+	SHAKE_INT64 first_time_us;	// timestamp of the first chunk in a capture file
+	SHAKE_INT64 chunk_left;		// bytes left in the current chunk of a capture file
+	double chunk_due;			// host time the current chunk is due to be returned
+	double start;				// host time replay started
+	SHAKE_INT64 delivered;		// data bytes returned so far
+	BOOL eof;					// TRUE once the end of the file has been reached
+	unsigned int eof_head;		// input buffer read position when the end of the file was last reported
+	volatile unsigned int stop;	// set by shake_wake_replay() to stop the reader thread waiting
+	volatile BOOL complete;		// set once everything in the file has been parsed
+	#ifdef _WIN32
+	HANDLE file, mapping;
+	#endif
+} shake_replay;
+
+typedef struct {
+	int comms_type;
+	#ifdef _WIN32
+	shake_serial_port_win32 serial_win32;
+	#endif
+	#ifndef _WIN32
+	shake_serial_port_usb serial_usb;
+	#endif
+	#ifdef SHAKE_RFCOMM_SUPPORTED
+		shake_rfcomm_socket rfcomm;
+	#endif
+	shake_replay replay;
+	FILE* dbg_write;
+} shake_port;
+
+enum shake_connection_types {
+	SHAKE_CONN_VIRTUAL_SERIAL_WIN32 = 0,
+	SHAKE_CONN_RFCOMM_I64,
+	SHAKE_CONN_RFCOMM_STR,
+	SHAKE_CONN_DEBUGFILE,
+	SHAKE_CONN_S60_RFCOMM, 
+	SHAKE_CONN_USB_SERIAL,
+	SHAKE_CONN_SOCKET,			// already connected stream socket, handled like RFCOMM
+};
+
+typedef struct {
+	int type;
+	int com_port;
+	SHAKE_INT64 btaddr;
+	char btaddr_str[20];
+	char readfile[256];
+	char writefile[256];
+	int devtype;
+	char usbdev[128];
+	int sock;
+	int replay_mode;
+	float replay_speed;
+} shake_conn_data;
+
+/* size of the per-device input buffer, must be a power of 2 */
+#define SHAKE_INPUT_BUFFER_SIZE 4096
+#define SHAKE_INPUT_BUFFER_MASK (SHAKE_INPUT_BUFFER_SIZE - 1)
+/* largest packet that can be parsed directly from the input buffer */
+#define SHAKE_INPUT_BUFFER_SLACK 256
+
+/*	ring buffer sitting between read_bytes() and the connection backends. It is only
+*	ever touched by the reader thread, so no locking is required. <head> and <tail> are
+*	free-running counters, the number of buffered bytes is always (tail - head).
+*	
+*	The extra SHAKE_INPUT_BUFFER_SLACK bytes at the end are used to mirror the start of
+*	the buffer when a packet wraps around, so that every packet can be handed to the 
+*	parsing code as a single contiguous block (see frame_bytes()) 
+*
+*	Devices run by a reactor thread (see shake_reactor.h) never wait for data. Instead <mark> is 
+*	set to the start of each packet and <starved> is set if the port runs dry before the packet 
+*	is complete, so the reactor can rewind to <mark> and parse the packet again once the rest 
+*	has arrived. Data from <mark> onwards is never overwritten. */
+typedef struct {
+	char data[SHAKE_INPUT_BUFFER_SIZE + SHAKE_INPUT_BUFFER_SLACK];
+	unsigned int head;			// position of the next byte to be consumed
+	unsigned int tail;			// position the next byte read from the port will be stored at
+	unsigned int mark;			// start of the packet being parsed (reactor only)
+	BOOL starved;				// TRUE if a read found no data since <mark> was set (reactor only)
+} shake_input_buffer;
+
+/* size of a CPU cache line, used to keep data written by different threads apart */
+#define SHAKE_CACHE_LINE_SIZE 64
+
+/*	single producer/single consumer queue of samples from one sensor. The reader thread 
+*	only ever writes <tail> and the application only ever writes <head>, so no locking is 
+*	needed. Both are free-running counters, the number of queued samples is (tail - head) */
+typedef struct {
+	shake_sample* samples;		// allocated by shake_enable_sample_queue(), never freed while the device is open
+	unsigned int mask;			// queue depth - 1
+	volatile unsigned int enabled;
+	volatile unsigned int overflows;	// number of samples dropped because the queue was full
+	volatile unsigned int tail;		// position the next sample will be written to, written by the reader thread
+	unsigned int head_cache;		// last value of <head> seen by the reader thread
+	char pad[SHAKE_CACHE_LINE_SIZE];
+	volatile unsigned int head;		// position of the next sample to be read, written by the application
+} shake_sample_queue;
+
+/*	model of the sample clock of one sensor, maintained by the reader thread (see shake_clock.h).
+*	Sequence numbers are unwrapped into a sample index, and a line fitted through the 
+*	(index, receive time) pairs gives the period of the device clock as measured by the host
+*	clock, so every sample can be given a time without the jitter of the Bluetooth link. 
+*	The fit is a running exponentially weighted least squares one, centred on the weighted 
+*	means to keep it accurate however large the index gets. */
+typedef struct {
+	int count;					// number of samples fitted so far
+	SHAKE_INT64 last_index;		// index of the newest sample
+	int last_pos;				// position of the newest sample in the sequence number cycle (last_index % seq_range)
+	int seq_range;				// range of the sequence numbers of the newest sample
+	double last_time;			// receive time of the newest sample
+	double base_time;			// receive time of the first sample, all fitted times are relative to it
+	double mean_index;			// weighted mean of the sample indices
+	double mean_time;			// weighted mean of the receive times
+	double var_index;			// weighted variance of the sample indices
+	double cov;					// weighted covariance of the indices and receive times
+	double period;				// fitted seconds per sample, 0 until enough samples have been seen
+	double offset;				// lower envelope of the receive times around the fitted line
+	shake_stream_stats stats;	// packet counts, copied into the sensor block with each sample
+} shake_sensor_clock;
+
+/*	microphone audio waiting for the application, see shake_audio.h. Like shake_sample_queue,
+*	the reader thread only ever writes <tail> and the thread reading the audio (the application,
+*	or the one calling the mic callback) only ever writes <head> */
+typedef struct {
+	short* samples;				// allocated by shake_enable_mic_buffer(), never freed while the device is open
+	unsigned int mask;			// buffer size - 1
+	volatile unsigned int enabled;
+	volatile int concealment;	// one of shake_mic_concealment
+	volatile int jitter_ms;		// see shake_enable_mic_buffer()
+	shake_mic_callback cb;		// see shake_register_mic_callback()
+	void* cb_user;
+	volatile int block;			// number of samples passed to each call of <cb>
+	volatile unsigned int received;		// counts behind shake_get_mic_stats(), written by the reader thread
+	volatile unsigned int lost;
+	volatile unsigned int concealed;
+	volatile unsigned int overflows;
+	// the rest is only used by the reader thread
+	unsigned int head_cache;	// last value of <head> seen
+	unsigned int notified;		// value of <tail> when the callback's thread was last told about new audio
+	shake_sensor_clock clock;	// arrival times of the packets, used to spot lost ones
+	double delay;				// average time packets arrive after the clock's lower envelope
+	int faded;					// number of packets concealed in a row
+	short last[SHAKE_AUDIO_DATA_LEN];	// audio from the newest packet
+	volatile unsigned int tail;	// position the next sample will be written to
+	char pad[SHAKE_CACHE_LINE_SIZE];
+	volatile unsigned int head;	// position of the next sample to be read
+} shake_mic_buffer;
+
+/*	audio waiting to be played on the SHAKE, see shake_audio.h. The other way round from
+*	shake_mic_buffer: the application only ever writes <tail> and the reader thread only ever
+*	writes <head>. The audio is stored already compressed, one byte per sample */
+typedef struct {
+	unsigned char* data;		// allocated by shake_enable_playback_buffer(), never freed while the device is open
+	unsigned int mask;			// buffer size - 1
+	volatile unsigned int enabled;
+	volatile int prefill;		// see shake_enable_playback_buffer()
+	volatile int fill;			// one of shake_playback_fill
+	volatile unsigned int sent;		// counts behind shake_get_playback_stats(), written by the reader thread
+	volatile unsigned int underruns;
+	volatile unsigned int filled;
+	BOOL playing;				// FALSE while waiting for the buffer to reach <prefill>, only used by the reader thread
+	volatile unsigned int head;	// position of the next sample to be sent
+	char pad[SHAKE_CACHE_LINE_SIZE];
+	volatile unsigned int tail;	// position the next sample will be written to
+} shake_playback_buffer;
+
+/*	latest sample from one sensor, protected by a sequence lock. The reader thread is the 
+*	only writer: it makes <version> odd, updates <sample> and then makes <version> even again,
+*	so the application can tell if it read the block while it was being updated and retry. 
+*	Each block fills a whole cache line so updating one sensor never disturbs another. */
+typedef struct {
+	shake_sample sample;
+	shake_stream_stats stats;
+	volatile unsigned int version;	// incremented twice for every sample received
+	char pad[SHAKE_CACHE_LINE_SIZE - sizeof(shake_sample) - sizeof(shake_stream_stats) - sizeof(unsigned int)];
+} shake_sensor_block;
+
+/*	running totals behind shake_get_stats(). Apart from the register shadow and dropped event 
+*	counters, which are updated atomically, every counter has a single writer (the callback
+*	latencies are written by whichever thread holds the event queue's dispatch lock, everything 
+*	else by the reader thread), so they
+*	are updated with plain relaxed loads and stores and read by the application the same way. 
+*	The times are in nanoseconds. */
+typedef struct {
+	volatile SHAKE_INT64 bytes;
+	volatile SHAKE_INT64 io_wait_ns;
+	volatile SHAKE_INT64 framing_ns;	// only packets timed by the reader thread, see SHAKE_STATS_TIMING_INTERVAL
+	volatile SHAKE_INT64 decoding_ns;
+	volatile unsigned int packets[SHAKE_STATS_PACKET_TYPES];
+	volatile unsigned int resyncs;
+	volatile unsigned int resync_bytes;
+	volatile unsigned int checksum_failures;
+	volatile unsigned int ack_latency[SHAKE_STATS_LATENCY_BINS];
+	volatile unsigned int callback_latency[SHAKE_STATS_LATENCY_BINS];
+	volatile unsigned int shadow_hits;
+	volatile unsigned int shadow_misses;
+	volatile unsigned int events_dropped;
+} shake_stats_counters;
+
+/* a command waiting for its reply from the device, see shake_command.h */
+typedef struct {
+	BOOL active;
+	int addr;					// register address the reply must carry, or SHAKE_COMMAND_ANY_ADDR
+	unsigned int seq;			// order the commands were sent in, replies go to the oldest match first
+	double sent_time;			// host time the command was sent, for timing the reply
+	double deadline;			// host time the command times out at
+	shake_future* future;		// filled in when the command completes, may be NULL
+	shake_command_callback callback;	// called when the command completes, may be NULL
+	void* user;
+} shake_pending_command;
+
+/*	commands waiting for replies from one device. Replies arrive on the reader thread, commands 
+*	are sent from any number of application threads. */
+typedef struct {
+	shake_mutex lock;			// protects <pending>, <window>, <inflight> and <next_seq>
+	shake_mutex send_lock;		// held while a command is written, so commands from different threads don't interleave
+	shake_pending_command pending[SHAKE_COMMAND_MAX_WINDOW];
+	int window;					// number of commands allowed to wait for a reply at once
+	int inflight;				// number of <pending> entries in use
+	unsigned int next_seq;
+	volatile unsigned int done_gen;	// changed whenever a command completes, to wake threads waiting for one
+	volatile unsigned int waiters;	// number of threads waiting for <done_gen> to change
+} shake_command_engine;
+
+/*	sample uploads to one device, see shake_upload.h. The thread running an upload is the only 
+*	one that changes <stats> while it runs, but any thread can read them */
+typedef struct {
+	shake_mutex lock;			// protects everything below apart from <running> and <cancel>
+	int window;					// options set by shake_set_upload_options()
+	int retries;
+	int timeout_ms;
+	int chunk_size;
+	int delay_ms;
+	shake_upload_stats stats;	// progress of the current or last upload
+	double start_time;			// host time the current or last upload started
+	volatile unsigned int running;	// TRUE while an upload is in progress
+	volatile unsigned int cancel;	// set by shake_cancel_upload()
+} shake_upload_state;
+
+/* number of register addresses covered by the register shadow, which is every address below the first volatile register */
+#define SHAKE_SHADOW_REGISTERS 0x100
+
+/* host copy of the non-volatile registers of one device, see shake_shadow.h */
+typedef struct {
+	volatile BOOL enabled;
+	shake_mutex lock;			// protects the arrays below
+	unsigned char values[SHAKE_SHADOW_REGISTERS];
+	BOOL valid[SHAKE_SHADOW_REGISTERS];
+	unsigned int version[SHAKE_SHADOW_REGISTERS];	// changed by every write and invalidation, so a late reply can't replace a newer value
+} shake_register_shadow;
+
+/* one place in a shake_event_queue. <seq> says whether the slot is free or holds an event, see shake_event.cpp */
+typedef struct {
+	volatile unsigned int seq;
+	shake_event event;
+} shake_event_slot;
+
+/*	events waiting to be passed to the application's callbacks. Any thread can add events, and 
+*	whichever thread is delivering them (see shake_event_dispatch_modes) takes them off in order */
+typedef struct {
+	shake_event_slot slots[SHAKE_EVENT_QUEUE_SIZE];
+	volatile unsigned int tail;	// next slot to be filled
+	unsigned int head;			// next slot to be delivered, only used with <dispatch_lock> held
+	shake_mutex dispatch_lock;	// held while events are being delivered, so only one thread delivers them at a time
+	volatile int mode;			// one of shake_event_dispatch_modes
+	shake_event_batch_callback batch_cb;	// see shake_register_event_batch_callback()
+	void* batch_user;
+	BOOL pool_queued;			// TRUE while the device is on the pool's list, only used with the pool lock held
+	int pool_busy;				// number of pool threads holding the device, only used with the pool lock held
+	void* pool_next;			// next device on the pool's list
+	BOOL pool_release;			// set when the device was freed from one of its own pool callbacks, see shake_event_free()
+} shake_event_queue;
+
+class SHAKE;
+struct shake_reactor_thread;
+struct shake_capture;
+
+/* private data about a shake device, hidden from user */
+typedef struct {
+	int device_type;
+	SHAKE* shake;
+
+	shake_port port;			// structure containing port details
+	shake_thread thread;		// structure containing threading objects
+	// these flags are shared between the application and the driver threads, so are only accessed
+	// with shake_atomic_load_acquire() and shake_atomic_store_release()
+	volatile BOOL rthread_done;			// indicates when the reader thread should exit
+	volatile BOOL cthread_done;
+	volatile BOOL rthread_exit;			
+
+	//BOOL synced;				// TRUE if packet reading code is synced properly
+	char serial[20];			// Serial number
+	float fwrev;				// Firmware revision
+	float hwrev;				// Hardware revision
+	char lastrfid[SHAKE_RFID_TAG_LENGTH];			// Last RFID tag ID found
+	//int module1;				// expansion module in slot 1
+	//int module2;				// expansion module in slot 2
+	int modules[4];				// expansion module IDs. SK6 has 2, SK7 has 4
+	float bluetoothfwrev;		// Bluetooth firmware revision (SK7 only)
+
+	BOOL checksum;				// TRUE if device has checksums enabled
+	//BOOL ascii_mode;			// TRUE if device in ASCII output mode, FALSE if not
+	void (SHAKE_CALLBACK *navcb)(void*, int);	// callback func for events
+	long long data_recv;		// total data received
+	int wait_for_acks;			// set to 1 if the driver should wait for an ACK after sending a command
+	shake_command_engine commands;	// commands waiting for an ACK/NAK
+	shake_register_shadow shadow;	// cached register values, see shake_enable_register_shadow()
+	shake_upload_state upload;	// sample uploads, see shake_upload_audio()
+
+#ifdef _WIN32
+	void (SHAKE_STDCALL_CALLBACK *navcb_STDCALL)(void*, int);	// callback func for events
+#else
+	void *navcb_STDCALL;
+#endif
+
+	void (SHAKE_CALLBACK *audio_cb)(void*, short*, int, short*, int);
+
+#ifdef _WIN32
+	void (SHAKE_STDCALL_CALLBACK *audio_cb_STDCALL)(void*, short*, int, short*, int);
+#else
+	void *audio_cb_STDCALL;
+#endif
+	short audiobuf[SHAKE_AUDIO_DATA_LEN];
+	short playbackbuf[SHAKE_AUDIO_DATA_LEN];
+	char playback_packet[5+SHAKE_AUDIO_DATA_LEN];
+	shake_mic_buffer mic;		// microphone audio waiting for the application, see shake_enable_mic_buffer()
+	shake_playback_buffer playback;	// audio waiting to be played, see shake_enable_playback_buffer()
+	shake_event_queue events;	// events waiting for the callbacks
+	FILE* log;					// output file pointer for writing logged data into
+	unsigned long packets_read;	// gives number of logged packets received when playing back data from SHAKE
+	shake_input_buffer input;	// buffered data read from the port but not yet parsed
+	double packet_time;			// host time the data for the current packet was received
+	shake_sample_queue queues[SHAKE_NUM_SAMPLE_QUEUES];	// optional per-sensor sample queues
+	shake_sensor_block* sensors;	// latest sample from each sensor, SHAKE_NUM_SAMPLE_QUEUES cache aligned blocks
+	shake_sensor_clock clocks[SHAKE_NUM_SAMPLE_QUEUES];	// sample clock model for each sensor, only used by the reader thread
+	shake_stream_stats stats_base[SHAKE_NUM_SAMPLE_QUEUES];	// packet counts at the last shake_reset_stream_stats(), only used by the application
+	BOOL samples_pending;		// reader thread has published samples since it last checked for waiting threads
+	volatile unsigned int sample_gen;		// changed by the reader thread to wake threads in shake_wait_sample()
+	volatile unsigned int sample_waiters;	// number of threads in shake_wait_sample()
+	shake_stats_counters stats;	// driver performance counters, see shake_stats.h
+	shake_stats_counters stats_at_reset;	// counters at the last shake_reset_stats(), only used by the application
+	double stats_reset_time;	// host time of the last shake_reset_stats()
+	unsigned int stats_tick;	// packet counter used by the reader thread to pick packets to time
+	struct shake_reactor_thread* reactor;	// reactor thread running the device, or NULL if it has its own threads
+	volatile BOOL reactor_detach;	// set by shake_free_device() to ask the reactor to drop the device
+	volatile BOOL reactor_detached;	// set by the reactor once it will no longer touch the device
+	BOOL event_queued;			// TRUE while the device is waiting for the reactor to call its event callback
+	struct shake_capture* capture;	// buffers and writer thread for shake_capture_start(), NULL until first used
+	volatile BOOL capturing;	// TRUE while the connection is being recorded
+} shake_device_private;
+
+#endif
@@ -1,81 +1,124 @@
-#ifndef _SHAKE_THREAD_H_
-#define _SHAKE_THREAD_H_
-
-/*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-
-#ifdef _WIN32
-
-/*	Windows threading stuff. Handles to the thread itself, and to the object
-*	used for signalling ack packets have arrived */
-typedef struct {
-	HANDLE rthread;		// handle to thread used to read from serial port
-	HANDLE cmd_event;	// handle to an event object used to signal arrival of ACK/NAK packets
-	HANDLE cthread;		// handle to thread used to call callback function
-	HANDLE callback_event;	// handle to an event object used to signal callback activation
-	HANDLE audiothread;
-	HANDLE audio_event;
-} shake_thread;
-
-#define SHAKE_THREAD_FUNC LPTHREAD_START_ROUTINE
-
-#else
-
-/*	Linux threading stuff. Variables for the thread itself, a condition object for 
-*	signalling, and a mutex used to prevent race conditions when locking the condition
-*	object */
-typedef struct {
-	pthread_t rthread;		// handle to thread used to read from serial port
-	pthread_cond_t cmd_event;	// object used to to signal arrival of ACK/NAK packets
-	pthread_mutex_t cmd_mutex;	// pthread mutex (used with pthread condition object)
-	pthread_t cthread;
-	pthread_cond_t callback_event;
-	pthread_mutex_t callback_mutex;
-} shake_thread;
-
-typedef void* (*SHAKE_THREAD_FUNC)(void*);
-
-#endif	/* _WIN32 */
-
-#ifndef CMD_THREAD
-	#define CMD_THREAD 1
-#endif
-
-#ifndef CALLBACK_THREAD
-	#define CALLBACK_THREAD 2
-#endif
-
-#ifndef AUDIO_THREAD
-	#define AUDIO_THREAD 3
-#endif
-
-// initialisation
-shake_thread* shake_thread_init(shake_thread* st, SHAKE_THREAD_FUNC cmdfunc, void* cmdparam, TCHAR* cmdeventname, 
-													SHAKE_THREAD_FUNC cbfunc, void* cbparam, TCHAR* cbeventname,
-													SHAKE_THREAD_FUNC audiofunc, void* audioparam, TCHAR* audioeventname);
-// waiting for event
-BOOL shake_thread_wait(shake_thread* st, int secs, int ms, int thread);
-// signalling event
-BOOL shake_thread_signal(shake_thread* st, int thread);
-// freeing up resources
-BOOL shake_thread_free(shake_thread* st);
-// exit thread
-void shake_thread_exit(int value);
-
-#endif 
+#ifndef _SHAKE_THREAD_H_
+#define _SHAKE_THREAD_H_
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifdef _WIN32
+
+/* number of different words the threads of one device can wait on with shake_thread_wait_word() */
+#define SHAKE_WAIT_SLOTS 4
+
+/*	used by shake_thread_wait_word() on versions of Windows without WaitOnAddress(), which
+*	give each word that is waited on a semaphore of its own */
+typedef struct {
+	volatile unsigned int* word;	// the word this slot is for, NULL if the slot is unused
+	HANDLE sem;					// released once for each waiting thread to wake
+	volatile LONG waiters;		// number of threads waiting (or about to wait) on <word>
+} shake_wait_slot;
+
+/*	Windows threading stuff. Handles to the thread itself, and to the object
+*	used for signalling ack packets have arrived */
+typedef struct {
+	HANDLE rthread;		// handle to thread used to read from serial port
+	HANDLE cmd_event;	// handle to an event object used to signal arrival of ACK/NAK packets
+	HANDLE cthread;		// handle to thread used to call callback function
+	HANDLE callback_event;	// handle to an event object used to signal callback activation
+	HANDLE audiothread;
+	HANDLE audio_event;
+	DWORD rthread_id;	// ids of the threads above, as GetThreadId() is only available from Vista
+	DWORD cthread_id;
+	DWORD audiothread_id;
+	CRITICAL_SECTION wait_lock;	// protects the <word> of each wait slot
+	shake_wait_slot wait_slots[SHAKE_WAIT_SLOTS];
+} shake_thread;
+
+#define SHAKE_THREAD_FUNC LPTHREAD_START_ROUTINE
+
+#else
+
+/*	Linux threading stuff. Variables for the thread itself, a condition object for 
+*	signalling, and a mutex used to prevent race conditions when locking the condition
+*	object */
+typedef struct {
+	pthread_t rthread;		// handle to thread used to read from serial port
+	pthread_cond_t cmd_event;	// object used to to signal arrival of ACK/NAK packets
+	pthread_mutex_t cmd_mutex;	// pthread mutex (used with pthread condition object)
+	pthread_t cthread;
+	pthread_cond_t callback_event;
+	pthread_mutex_t callback_mutex;
+#ifdef __APPLE__
+	pthread_cond_t sample_event;	// used to wake threads waiting for new samples (Linux uses a futex instead)
+	pthread_mutex_t sample_mutex;
+#endif
+	BOOL cmd_pending;		// set by shake_thread_signal() until the matching wait sees it, like an auto-reset event
+	BOOL callback_pending;
+} shake_thread;
+
+typedef void* (*SHAKE_THREAD_FUNC)(void*);
+
+#endif	/* _WIN32 */
+
+/*	mutex for short critical sections shared between the driver threads and the application */
+#ifdef _WIN32
+typedef CRITICAL_SECTION shake_mutex;
+#else
+typedef pthread_mutex_t shake_mutex;
+#endif
+
+#ifndef CMD_THREAD
+	#define CMD_THREAD 1
+#endif
+
+#ifndef CALLBACK_THREAD
+	#define CALLBACK_THREAD 2
+#endif
+
+#ifndef AUDIO_THREAD
+	#define AUDIO_THREAD 3
+#endif
+
+// initialisation. The reader (cmd) and callback threads are only started if their functions are given
+shake_thread* shake_thread_init(shake_thread* st, SHAKE_THREAD_FUNC cmdfunc, void* cmdparam, TCHAR* cmdeventname, 
+													SHAKE_THREAD_FUNC cbfunc, void* cbparam, TCHAR* cbeventname,
+													SHAKE_THREAD_FUNC audiofunc, void* audioparam, TCHAR* audioeventname);
+// waiting for event
+BOOL shake_thread_wait(shake_thread* st, int secs, int ms, int thread);
+// signalling event
+BOOL shake_thread_signal(shake_thread* st, int thread);
+// freeing up resources
+BOOL shake_thread_free(shake_thread* st);
+// exit thread
+void shake_thread_exit(int value);
+// TRUE if the caller is running on the given thread (CMD_THREAD or CALLBACK_THREAD)
+BOOL shake_thread_is_current(shake_thread* st, int thread);
+// current time in seconds from a monotonic clock, used to timestamp incoming packets
+double shake_time_now();
+/*	waits for up to <ms> milliseconds (or forever if <ms> is negative) while <*word> == <value>.
+*	May return early, so callers must check whatever they were waiting for and call it again */
+void shake_thread_wait_word(shake_thread* st, volatile unsigned int* word, unsigned int value, int ms);
+// wakes <waiters> threads blocked in shake_thread_wait_word() on <word>, after <*word> has been changed
+void shake_thread_wake_word(shake_thread* st, volatile unsigned int* word, int waiters);
+// shake_mutex functions
+void shake_mutex_init(shake_mutex* m);
+void shake_mutex_lock(shake_mutex* m);
+void shake_mutex_unlock(shake_mutex* m);
+void shake_mutex_free(shake_mutex* m);
+
+#endif 
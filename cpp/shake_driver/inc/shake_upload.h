@@ -0,0 +1,50 @@
+#ifndef _SHAKE_UPLOAD_H_
+#define _SHAKE_UPLOAD_H_
+
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_structs.h"
+
+/*	Uploads of audio and vibration samples into the SHAKE's sample memory. Each page of the
+*	sample is converted as it is sent, as a command through the command engine (see 
+*	shake_command.h), with up to the upload window of pages waiting for replies at once. The SHAKE replies to pages in the order it receives them, and the replies 
+*	don't say which page they belong to, so when a page fails the upload goes back to it and 
+*	sends every page after it again as well. */
+
+/* sets up the upload state of a new device, with the default options */
+void shake_upload_init(shake_device_private* devpriv);
+
+/* frees the upload state when the device is freed */
+void shake_upload_free(shake_device_private* devpriv);
+
+/* see shake_set_upload_options() */
+int shake_upload_set_options(shake_device_private* devpriv, int window, int retries, int timeout_ms, int chunk_size, int delay_ms);
+
+/*	uploads <len> samples to the pages starting at <address>. The samples are either 16 bit audio
+*	in <samples>, which is compressed before it is sent, or 8 bit data in <bytes> which is sent as
+*	it is. Returns SHAKE_SUCCESS if every page was acknowledged, SHAKE_ERROR otherwise */
+int shake_upload_run(shake_device_private* devpriv, int address, const short* samples, const char* bytes, int len, shake_upload_callback callback, void* user);
+
+// asks the upload in progress to stop, returns SHAKE_ERROR if there isn't one
+int shake_upload_cancel(shake_device_private* devpriv);
+
+// copies the progress of the current or last upload into <stats>
+void shake_upload_get_stats(shake_device_private* devpriv, shake_upload_stats* stats);
+
+#endif /* _SHAKE_UPLOAD_H_ */
@@ -0,0 +1,354 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+
+#include "shake_audio.h"
+#include "shake_clock.h"
+#include "shake_event.h"
+#include "shake_io.h"
+#include "shake_parsing.h"
+#include "SHAKE.h"
+#include <string.h>
+
+/*	Microphone packets have no sequence numbers, so the driver numbers them itself as they arrive
+*	(adding in any it thinks were lost) to keep the clock model in step. The range just has to be
+*	large enough that the clock never has to unwrap the numbers itself */
+#define SHAKE_MIC_SEQ_RANGE 65536
+// silence after which the microphone is taken to have been switched off, rather than packets lost
+#define SHAKE_MIC_RESTART_TIME 1.0
+// weight of each packet in the running average of the delay on the link
+#define SHAKE_MIC_DELAY_WEIGHT (1.0 / 64)
+// number of packets concealed in a row after which SHAKE_MIC_CONCEAL_REPEAT has faded out to nothing
+#define SHAKE_MIC_FADE_PACKETS 15
+// shake_mulaw_compress() of a silent sample
+#define SHAKE_MULAW_SILENCE 0xFF
+
+int shake_mic_enable(shake_device_private* devpriv, int size, int jitter_ms, int concealment) {
+	shake_mic_buffer* m = &(devpriv->mic);
+	unsigned int n = SHAKE_AUDIO_DATA_LEN * 2;
+
+	if(size < 0 || jitter_ms <= 0 || concealment < SHAKE_MIC_CONCEAL_NONE || concealment > SHAKE_MIC_CONCEAL_REPEAT)
+		return SHAKE_ERROR;
+
+	if(size == 0) {
+		m->enabled = FALSE;
+		return SHAKE_SUCCESS;
+	}
+
+	while(n < (unsigned int)size)
+		n <<= 1;
+
+	if(m->samples == NULL) {
+		m->samples = (short*)malloc(sizeof(short) * n);
+		if(m->samples == NULL)
+			return SHAKE_ERROR;
+		m->mask = n - 1;
+	} else if(m->mask != n - 1) {
+		// the reader thread may be using the buffer, so it can't be resized
+		return SHAKE_ERROR;
+	}
+
+	m->jitter_ms = jitter_ms;
+	m->concealment = concealment;
+
+	// the buffer has to be set up before the reader thread sees it enabled
+	shake_atomic_store_release(&(m->enabled), TRUE);
+	return SHAKE_SUCCESS;
+}
+
+void shake_mic_free(shake_device_private* devpriv) {
+	devpriv->mic.enabled = FALSE;
+	free(devpriv->mic.samples);
+	devpriv->mic.samples = NULL;
+}
+
+// adds a packet's worth of samples to the buffer, returning FALSE if there isn't room
+static BOOL shake_mic_write(shake_mic_buffer* m, const short* samples) {
+	unsigned int tail = m->tail, first;
+
+	// only look at the reading side of the buffer when it appears to be full
+	if(tail + SHAKE_AUDIO_DATA_LEN - m->head_cache > m->mask + 1) {
+		m->head_cache = shake_atomic_load_acquire(&(m->head));
+		if(tail + SHAKE_AUDIO_DATA_LEN - m->head_cache > m->mask + 1) {
+			m->overflows += SHAKE_AUDIO_DATA_LEN;
+			return FALSE;
+		}
+	}
+
+	first = (m->mask + 1) - (tail & m->mask);
+	if(first > SHAKE_AUDIO_DATA_LEN)
+		first = SHAKE_AUDIO_DATA_LEN;
+	memcpy(&(m->samples[tail & m->mask]), samples, first * sizeof(short));
+	memcpy(m->samples, samples + first, (SHAKE_AUDIO_DATA_LEN - first) * sizeof(short));
+
+	// make the samples visible to the reading thread before the new tail
+	shake_atomic_store_release(&(m->tail), tail + SHAKE_AUDIO_DATA_LEN);
+	return TRUE;
+}
+
+/*	estimates how many packets were lost before one arriving at <time>. The clock's lower envelope
+*	gives the earliest the next packet could have arrived, and packets normally turn up a little 
+*	after that. One which is later than the jitter allowance must have been preceded by others
+*	that never arrived, as many as it takes to account for the lateness */
+static int shake_mic_lost(shake_mic_buffer* m, double time) {
+	shake_sensor_clock* clk = &(m->clock);
+	double due, late;
+	int lost;
+
+	// nothing can be said until the packet rate has been measured
+	if(clk->period <= 0.0)
+		return 0;
+
+	due = clk->base_time + clk->mean_time + clk->period * ((double)(clk->last_index + 1) - clk->mean_index) + clk->offset;
+	late = time - due;
+	if(late <= m->jitter_ms / 1000.0) {
+		m->delay += (late - m->delay) * SHAKE_MIC_DELAY_WEIGHT;
+		return 0;
+	}
+
+	lost = (int)((late - m->delay) / clk->period + 0.5);
+	return lost > 0 ? lost : 0;
+}
+
+// fills in for <lost> packets in the way the application asked for
+static void shake_mic_conceal(shake_mic_buffer* m, int lost) {
+	short fill[SHAKE_AUDIO_DATA_LEN];
+	int i, j;
+
+	// there's no point making up more audio than the buffer can hold
+	if(lost > (int)((m->mask + 1) / SHAKE_AUDIO_DATA_LEN))
+		lost = (m->mask + 1) / SHAKE_AUDIO_DATA_LEN;
+
+	for(i=0;i<lost;i++) {
+		if(m->concealment == SHAKE_MIC_CONCEAL_REPEAT && m->faded < SHAKE_MIC_FADE_PACKETS) {
+			m->faded++;
+			for(j=0;j<SHAKE_AUDIO_DATA_LEN;j++)
+				fill[j] = (short)(m->last[j] / (1 << m->faded));
+		} else {
+			memset(fill, 0, sizeof(fill));
+		}
+
+		if(!shake_mic_write(m, fill))
+			break;
+		m->concealed++;
+	}
+}
+
+void shake_mic_push(shake_device_private* devpriv, const unsigned char* data) {
+	shake_mic_buffer* m = &(devpriv->mic);
+	double time = devpriv->packet_time;
+	shake_sample s;
+	int lost = 0;
+
+	if(m->clock.count > 0 && time - m->clock.last_time > SHAKE_MIC_RESTART_TIME) {
+		// start measuring the packet rate afresh, it may not line up with what went before
+		memset(&(m->clock), 0, sizeof(shake_sensor_clock));
+		m->delay = 0.0;
+	} else {
+		lost = shake_mic_lost(m, time);
+	}
+
+	if(lost > 0) {
+		m->lost += lost;
+		if(m->concealment != SHAKE_MIC_CONCEAL_NONE)
+			shake_mic_conceal(m, lost);
+	}
+
+	s.seq = m->clock.count == 0 ? 0 : (int)((m->clock.last_index + 1 + lost) % SHAKE_MIC_SEQ_RANGE);
+	s.timestamp = time;
+	shake_clock_update(&(m->clock), SHAKE_MIC_SEQ_RANGE, &s);
+
+	// the concealment above used the previous packet, so this one can now replace it
+	shake_mulaw_lookup(m->last, data, SHAKE_AUDIO_DATA_LEN);
+	m->faded = 0;
+	m->received++;
+	shake_mic_write(m, m->last);
+
+	// wake shake_read_mic(), and the callback's thread once there's a block's worth of new audio
+	devpriv->samples_pending = TRUE;
+	if(m->cb && m->tail - m->notified >= (unsigned int)m->block) {
+		m->notified = m->tail;
+		shake_event_notify(devpriv);
+	}
+}
+
+int shake_mic_count(shake_device_private* devpriv) {
+	shake_mic_buffer* m = &(devpriv->mic);
+
+	if(m->samples == NULL)
+		return 0;
+
+	return shake_atomic_load_acquire(&(m->tail)) - m->head;
+}
+
+int shake_mic_pop(shake_device_private* devpriv, short* samples, int max) {
+	shake_mic_buffer* m = &(devpriv->mic);
+	unsigned int head, tail, count, first;
+
+	if(m->samples == NULL || max <= 0)
+		return 0;
+
+	head = m->head;
+	tail = shake_atomic_load_acquire(&(m->tail));
+	count = tail - head;
+	if(count > (unsigned int)max)
+		count = max;
+
+	// copy in at most two blocks, the second if the samples wrap around the end of the buffer
+	first = (m->mask + 1) - (head & m->mask);
+	if(first > count)
+		first = count;
+	memcpy(samples, &(m->samples[head & m->mask]), first * sizeof(short));
+	memcpy(samples + first, m->samples, (count - first) * sizeof(short));
+
+	// only give the space back to the reader thread once the samples have been copied
+	shake_atomic_store_release(&(m->head), head + count);
+	return count;
+}
+
+void shake_mic_deliver(shake_device_private* devpriv) {
+	shake_mic_buffer* m = &(devpriv->mic);
+	short block[SHAKE_MIC_BLOCK_MAX];
+	shake_mic_callback cb;
+	int size;
+
+	while(1) {
+		cb = m->cb;
+		size = m->block;
+		if(cb == NULL || shake_mic_count(devpriv) < size)
+			break;
+
+		shake_mic_pop(devpriv, block, size);
+		cb(devpriv->shake->dev, block, size, m->cb_user);
+	}
+}
+
+int shake_playback_enable(shake_device_private* devpriv, int size, int prefill, int fill) {
+	shake_playback_buffer* p = &(devpriv->playback);
+	unsigned int n = SHAKE_AUDIO_DATA_LEN * 2;
+
+	if(size < 0 || prefill < 0 || prefill > size || fill < SHAKE_PLAYBACK_FILL_SILENCE || fill > SHAKE_PLAYBACK_FILL_NONE)
+		return SHAKE_ERROR;
+
+	if(size == 0) {
+		p->enabled = FALSE;
+		return SHAKE_SUCCESS;
+	}
+
+	while(n < (unsigned int)size)
+		n <<= 1;
+
+	if(p->data == NULL) {
+		p->data = (unsigned char*)malloc(n);
+		if(p->data == NULL)
+			return SHAKE_ERROR;
+		p->mask = n - 1;
+	} else if(p->mask != n - 1) {
+		// the reader thread may be using the buffer, so it can't be resized
+		return SHAKE_ERROR;
+	}
+
+	p->prefill = prefill;
+	p->fill = fill;
+
+	// the buffer has to be set up before the reader thread sees it enabled
+	shake_atomic_store_release(&(p->enabled), TRUE);
+	return SHAKE_SUCCESS;
+}
+
+void shake_playback_free(shake_device_private* devpriv) {
+	devpriv->playback.enabled = FALSE;
+	free(devpriv->playback.data);
+	devpriv->playback.data = NULL;
+}
+
+void shake_playback_send(shake_device_private* devpriv) {
+	shake_playback_buffer* p = &(devpriv->playback);
+	unsigned char* out = (unsigned char*)devpriv->playback_packet + 5;
+	unsigned int head = p->head, count, first;
+
+	count = shake_atomic_load_acquire(&(p->tail)) - head;
+
+	// hold off until there's enough to ride out a late write by the application
+	if(!p->playing && count > 0 && count >= (unsigned int)p->prefill)
+		p->playing = TRUE;
+
+	if(!p->playing) {
+		count = 0;
+	} else if(count < SHAKE_AUDIO_DATA_LEN) {
+		p->underruns++;
+		p->playing = FALSE;
+	} else {
+		count = SHAKE_AUDIO_DATA_LEN;
+	}
+
+	if(count == 0) {
+		if(p->fill == SHAKE_PLAYBACK_FILL_NONE)
+			return;
+		p->filled++;
+	} else {
+		p->sent++;
+	}
+
+	// copy in at most two blocks, the second if the audio wraps around the end of the buffer
+	first = (p->mask + 1) - (head & p->mask);
+	if(first > count)
+		first = count;
+	memcpy(out, &(p->data[head & p->mask]), first);
+	memcpy(out + first, p->data, count - first);
+	memset(out + count, SHAKE_MULAW_SILENCE, SHAKE_AUDIO_DATA_LEN - count);
+
+	// the space can be reused as soon as it's been copied into the packet
+	shake_atomic_store_release(&(p->head), head + count);
+	devpriv->samples_pending = TRUE;
+
+	write_bytes(devpriv, devpriv->playback_packet, SHAKE_AUDIO_DATA_LEN + 5);
+}
+
+int shake_playback_free_space(shake_device_private* devpriv) {
+	shake_playback_buffer* p = &(devpriv->playback);
+
+	if(p->data == NULL)
+		return 0;
+
+	return (p->mask + 1) - (p->tail - shake_atomic_load_acquire(&(p->head)));
+}
+
+int shake_playback_push(shake_device_private* devpriv, const short* samples, int max) {
+	shake_playback_buffer* p = &(devpriv->playback);
+	unsigned int tail = p->tail, count, first;
+
+	count = shake_playback_free_space(devpriv);
+	if(count > (unsigned int)max)
+		count = max;
+
+	// compressing here rather than in the reader thread leaves it nothing to do but send the packets
+	first = (p->mask + 1) - (tail & p->mask);
+	if(first > count)
+		first = count;
+	shake_mulaw_compress(samples, first, &(p->data[tail & p->mask]));
+	shake_mulaw_compress(samples + first, count - first, p->data);
+
+	// make the audio visible to the reader thread before the new tail
+	shake_atomic_store_release(&(p->tail), tail + count);
+	return count;
+}
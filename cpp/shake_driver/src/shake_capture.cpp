@@ -0,0 +1,279 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+
+#include "shake_capture.h"
+#include "shake_replay.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+
+/* the writer thread is woken early once a buffer is this full */
+#define SHAKE_CAPTURE_FLUSH_SIZE (SHAKE_CAPTURE_BUFFER_SIZE / 2)
+
+/*	a recording in progress. The driver threads append chunks to buffers[active] while holding
+*	<lock>, and the writer thread swaps the buffers over and writes out the full one without
+*	holding it, so a slow disk only ever holds up the writer thread. Allocated by the first
+*	shake_capture_open() and kept until the device is freed. */
+struct shake_capture {
+	FILE* file;
+	char* buffers[2];
+	int active;				// index of the buffer being filled
+	int fill;				// bytes used in the buffer being filled
+	BOOL recording;			// chunks are only added while this is TRUE
+	BOOL closing;			// set to tell the writer thread to write out what's left and exit
+	unsigned int dropped;	// chunks dropped because the buffer was full
+	shake_mutex lock;
+#ifdef _WIN32
+	HANDLE wake;			// auto-reset event used to wake the writer thread
+	HANDLE thread;
+#else
+	pthread_cond_t wake;
+	pthread_t thread;
+#endif
+};
+
+static void shake_capture_signal(shake_capture* cap) {
+#ifdef _WIN32
+	SetEvent(cap->wake);
+#else
+	pthread_cond_signal(&(cap->wake));
+#endif
+}
+
+/* waits for up to <ms> milliseconds to be signalled. Must be called with the lock held, which is released while waiting */
+static void shake_capture_wait(shake_capture* cap, int ms) {
+#ifdef _WIN32
+	shake_mutex_unlock(&(cap->lock));
+	WaitForSingleObject(cap->wake, ms);
+	shake_mutex_lock(&(cap->lock));
+#else
+	struct timeval now;
+	struct timespec until;
+
+	gettimeofday(&now, NULL);
+	until.tv_sec = now.tv_sec + ms / 1000;
+	until.tv_nsec = (now.tv_usec + (ms % 1000) * 1000) * 1000;
+	if(until.tv_nsec >= 1000000000) {
+		until.tv_sec++;
+		until.tv_nsec -= 1000000000;
+	}
+	pthread_cond_timedwait(&(cap->wake), &(cap->lock), &until);
+#endif
+}
+
+/*	empties the buffers into the file until the recording is closed. Buffered data is written 
+*	once a buffer is half full, or after SHAKE_CAPTURE_FLUSH_INTERVAL if there's less than that */
+#ifdef _WIN32
+static DWORD WINAPI shake_capture_writer(LPVOID param) {
+#else
+static void* shake_capture_writer(void* param) {
+#endif
+	shake_capture* cap = (shake_capture*)param;
+	char* buf;
+	int len;
+	BOOL closing;
+
+	shake_mutex_lock(&(cap->lock));
+	for(;;) {
+		if(cap->fill < SHAKE_CAPTURE_FLUSH_SIZE && !cap->closing)
+			shake_capture_wait(cap, SHAKE_CAPTURE_FLUSH_INTERVAL);
+
+		// nothing more is added once <closing> is set, so this is the last of the data
+		closing = cap->closing;
+		buf = cap->buffers[cap->active];
+		len = cap->fill;
+		cap->active ^= 1;
+		cap->fill = 0;
+		shake_mutex_unlock(&(cap->lock));
+
+		if(len > 0)
+			fwrite(buf, 1, len, cap->file);
+		if(closing)
+			break;
+		fflush(cap->file);
+
+		shake_mutex_lock(&(cap->lock));
+	}
+	return 0;
+}
+
+int shake_capture_open(shake_device_private* devpriv, char* filename) {
+	shake_capture* cap;
+	shake_capture_header hdr;
+	FILE* file;
+
+	file = fopen(filename, "wb");
+	if(file == NULL)
+		return SHAKE_ERROR;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, SHAKE_CAPTURE_MAGIC, sizeof(hdr.magic));
+	hdr.version = SHAKE_CAPTURE_VERSION;
+	hdr.device_type = devpriv->device_type;
+	if(fwrite(&hdr, sizeof(hdr), 1, file) != 1) {
+		fclose(file);
+		return SHAKE_ERROR;
+	}
+
+	// only one recording at a time
+	shake_capture_close(devpriv);
+
+	if(devpriv->capture == NULL) {
+		cap = (shake_capture*)calloc(1, sizeof(shake_capture));
+		if(cap == NULL) {
+			fclose(file);
+			return SHAKE_ERROR;
+		}
+		cap->buffers[0] = (char*)malloc(SHAKE_CAPTURE_BUFFER_SIZE);
+		cap->buffers[1] = (char*)malloc(SHAKE_CAPTURE_BUFFER_SIZE);
+		if(cap->buffers[0] == NULL || cap->buffers[1] == NULL) {
+			free(cap->buffers[0]);
+			free(cap->buffers[1]);
+			free(cap);
+			fclose(file);
+			return SHAKE_ERROR;
+		}
+		shake_mutex_init(&(cap->lock));
+		#ifdef _WIN32
+		cap->wake = CreateEvent(NULL, FALSE, FALSE, NULL);
+		#else
+		pthread_cond_init(&(cap->wake), NULL);
+		#endif
+		devpriv->capture = cap;
+	}
+
+	cap = devpriv->capture;
+	cap->file = file;
+	cap->active = 0;
+	cap->fill = 0;
+	cap->dropped = 0;
+	cap->closing = FALSE;
+
+	#ifdef _WIN32
+	cap->thread = CreateThread(NULL, 0, shake_capture_writer, cap, 0, NULL);
+	if(cap->thread == NULL) {
+	#else
+	if(pthread_create(&(cap->thread), NULL, shake_capture_writer, cap) != 0) {
+	#endif
+		fclose(file);
+		cap->file = NULL;
+		return SHAKE_ERROR;
+	}
+
+	shake_mutex_lock(&(cap->lock));
+	cap->recording = TRUE;
+	shake_mutex_unlock(&(cap->lock));
+	devpriv->capturing = TRUE;
+	return SHAKE_SUCCESS;
+}
+
+int shake_capture_close(shake_device_private* devpriv) {
+	shake_capture* cap = devpriv->capture;
+
+	if(cap == NULL || cap->file == NULL)
+		return SHAKE_ERROR;
+
+	devpriv->capturing = FALSE;
+	shake_mutex_lock(&(cap->lock));
+	cap->recording = FALSE;
+	cap->closing = TRUE;
+	shake_capture_signal(cap);
+	shake_mutex_unlock(&(cap->lock));
+
+	#ifdef _WIN32
+	WaitForSingleObject(cap->thread, INFINITE);
+	CloseHandle(cap->thread);
+	#else
+	pthread_join(cap->thread, NULL);
+	#endif
+
+	fclose(cap->file);
+	cap->file = NULL;
+	return SHAKE_SUCCESS;
+}
+
+void shake_capture_record(shake_device_private* devpriv, double time, unsigned int flags, char* data, int length) {
+	shake_capture* cap = devpriv->capture;
+	shake_capture_chunk chunk;
+	char* dest;
+	int size = sizeof(shake_capture_chunk) + length;
+
+	chunk.time_us = (SHAKE_INT64)(time * 1000000.0);
+	chunk.length = length;
+	chunk.flags = flags;
+
+	shake_mutex_lock(&(cap->lock));
+	if(!cap->recording) {
+		shake_mutex_unlock(&(cap->lock));
+		return;
+	}
+	if(cap->fill + size > SHAKE_CAPTURE_BUFFER_SIZE) {
+		cap->dropped++;
+		shake_mutex_unlock(&(cap->lock));
+		return;
+	}
+
+	dest = cap->buffers[cap->active] + cap->fill;
+	memcpy(dest, &chunk, sizeof(shake_capture_chunk));
+	memcpy(dest + sizeof(shake_capture_chunk), data, length);
+	cap->fill += size;
+	// only wake the writer thread once per buffer
+	if(cap->fill >= SHAKE_CAPTURE_FLUSH_SIZE && cap->fill - size < SHAKE_CAPTURE_FLUSH_SIZE)
+		shake_capture_signal(cap);
+	shake_mutex_unlock(&(cap->lock));
+}
+
+unsigned int shake_capture_dropped(shake_device_private* devpriv) {
+	shake_capture* cap = devpriv->capture;
+	unsigned int dropped;
+
+	if(cap == NULL)
+		return 0;
+
+	shake_mutex_lock(&(cap->lock));
+	dropped = cap->dropped;
+	shake_mutex_unlock(&(cap->lock));
+	return dropped;
+}
+
+void shake_capture_free(shake_device_private* devpriv) {
+	shake_capture* cap = devpriv->capture;
+
+	if(cap == NULL)
+		return;
+
+	shake_capture_close(devpriv);
+	shake_mutex_free(&(cap->lock));
+	#ifdef _WIN32
+	CloseHandle(cap->wake);
+	#else
+	pthread_cond_destroy(&(cap->wake));
+	#endif
+	free(cap->buffers[0]);
+	free(cap->buffers[1]);
+	free(cap);
+	devpriv->capture = NULL;
+}
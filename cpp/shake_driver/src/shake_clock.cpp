@@ -0,0 +1,144 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+
+#include "shake_clock.h"
+
+// number of samples needed before the fitted period is trusted
+#define SHAKE_CLOCK_MIN_SAMPLES 16
+// seconds of data covered by the fit once it has settled, whatever the sample rate
+#define SHAKE_CLOCK_FIT_TIME 60.0
+// seconds taken for the lower envelope to rise back towards the fitted line
+#define SHAKE_CLOCK_ENVELOPE_TIME 10.0
+// silence after which samples are assumed to have been lost rather than held up on the way
+#define SHAKE_CLOCK_GAP_TIME 1.0
+
+/*	finds the index of a sample with sequence number <seq> received at <time>, and sets <pos> 
+*	to its position in the sequence number cycle. Normally this is the index closest to the one 
+*	after the newest sample, so a sequence number which is one behind gives the index of the 
+*	newest sample again (a duplicate), and others which are a little behind give earlier indices 
+*	(received out of order). After a silence long enough for the sequence numbers to wrap round,
+*	the number of missing samples is estimated from the time elapsed instead. Packets can be held
+*	up in the link for a while and then arrive in a burst, so short silences never count as a 
+*	gap, but the device can't buffer a whole second's worth of data */
+static SHAKE_INT64 shake_clock_unwrap(shake_sensor_clock* clk, int seq, int seq_range, double time, int* pos) {
+	SHAKE_INT64 expected;
+	int delta;
+
+	if(clk->count == 0) {
+		*pos = seq < 0 ? 0 : seq;
+		return *pos;
+	}
+
+	expected = clk->last_index + 1;
+	*pos = clk->last_pos + 1;
+	if(clk->period > 0.0 && time - clk->last_time > SHAKE_CLOCK_GAP_TIME && time - clk->last_time > clk->period * seq_range) {
+		expected = clk->last_index + (SHAKE_INT64)((time - clk->last_time) / clk->period + 0.5);
+		*pos = (int)(expected % seq_range);
+	} else if(seq_range != clk->seq_range) {
+		*pos = (int)(expected % seq_range);
+	} else if(*pos == seq_range) {
+		*pos = 0;
+	}
+
+	// without a sequence number, the best guess is that nothing was lost
+	if(seq < 0)
+		return expected;
+
+	delta = seq - *pos;
+	if(delta > seq_range / 2)
+		delta -= seq_range;
+	else if(delta <= -seq_range / 2)
+		delta += seq_range;
+
+	*pos = seq;
+	return expected + delta;
+}
+
+void shake_clock_update(shake_sensor_clock* clk, int seq_range, shake_sample* sample) {
+	SHAKE_INT64 index;
+	double w, dx, dy, x, y, r;
+	int pos;
+
+	index = shake_clock_unwrap(clk, sample->seq, seq_range, sample->timestamp, &pos);
+	sample->index = index;
+
+	if(clk->count == 0) {
+		clk->base_time = sample->timestamp;
+		clk->mean_index = (double)index;
+	}
+
+	clk->stats.received++;
+	if(sample->seq >= 0 && clk->count > 0) {
+		if(index > clk->last_index + 1)
+			clk->stats.missing += (unsigned int)(index - clk->last_index - 1);
+		else if(index == clk->last_index)
+			clk->stats.duplicated++;
+		else if(index < clk->last_index) {
+			// this was counted as missing when the gap it left was seen
+			clk->stats.out_of_order++;
+			if(clk->stats.missing > 0)
+				clk->stats.missing--;
+		}
+	}
+
+	// duplicates and late samples don't move the fit, but still get a time from it
+	if(clk->count == 0 || index > clk->last_index) {
+		x = (double)index;
+		y = sample->timestamp - clk->base_time;
+
+		// equal weights to start with, then an exponential window once there's enough data
+		clk->count++;
+		w = clk->period * (1.0 / SHAKE_CLOCK_FIT_TIME);
+		if(clk->count * w < 1.0)
+			w = 1.0 / clk->count;
+
+		dx = x - clk->mean_index;
+		dy = y - clk->mean_time;
+		clk->mean_index += w * dx;
+		clk->mean_time += w * dy;
+		clk->var_index = (1.0 - w) * (clk->var_index + w * dx * dx);
+		clk->cov = (1.0 - w) * (clk->cov + w * dx * dy);
+
+		if(clk->count >= SHAKE_CLOCK_MIN_SAMPLES && clk->var_index > 0.0) {
+			clk->period = clk->cov / clk->var_index;
+
+			/* the link only ever delays samples, so the earliest receive times are the closest
+			*	to when the samples were really taken. Follow drops straight away and rises slowly */
+			r = y - (clk->mean_time + clk->period * (x - clk->mean_index));
+			if(clk->count == SHAKE_CLOCK_MIN_SAMPLES || r < clk->offset)
+				clk->offset = r;
+			else
+				clk->offset += (r - clk->offset) * clk->period * (1.0 / SHAKE_CLOCK_ENVELOPE_TIME);
+		}
+
+		clk->last_index = index;
+		clk->last_pos = pos;
+		clk->seq_range = seq_range;
+		clk->last_time = sample->timestamp;
+	}
+
+	if(clk->period > 0.0)
+		sample->sample_time = clk->base_time + clk->mean_time + clk->period * ((double)index - clk->mean_index) + clk->offset;
+	else
+		sample->sample_time = sample->timestamp;
+}
@@ -0,0 +1,343 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+
+#include "shake_command.h"
+#include "shake_io.h"
+#include "shake_reactor.h"
+#include "shake_stats.h"
+#include "SHAKE.h"
+
+/* deadline given to a command until it has been completely sent, so it can't time out while an upload is still going */
+#define SHAKE_COMMAND_SENDING 1e30
+
+/* a completed command whose callback is still to be called, once the engine lock has been released */
+typedef struct {
+	shake_command_callback callback;
+	void* user;
+	int addr;
+	int status;
+	unsigned char value;
+} shake_command_completion;
+
+void shake_command_init(shake_device_private* devpriv) {
+	shake_command_engine* eng = &(devpriv->commands);
+
+	shake_mutex_init(&(eng->lock));
+	shake_mutex_init(&(eng->send_lock));
+	eng->window = 1;
+}
+
+/* wakes any threads waiting for a command to complete, or for a free place in the window */
+static void shake_command_wake(shake_device_private* devpriv) {
+	shake_command_engine* eng = &(devpriv->commands);
+	unsigned int waiters;
+
+	shake_atomic_add(&(eng->done_gen), 1);
+
+	// pairs with the increment of <waiters> in the waiting thread, see shake_wake_sample_waiters()
+	shake_atomic_fence();
+	waiters = shake_atomic_load_acquire(&(eng->waiters));
+	if(waiters > 0)
+		shake_thread_wake_word(&(devpriv->thread), &(eng->done_gen), waiters);
+}
+
+/*	removes command <i> from the engine and fills in its future. Must be called with the lock held. 
+*	The callback is copied into <done> so it can be called once the lock has been released */
+static void shake_command_complete(shake_command_engine* eng, int i, int status, int value, shake_command_completion* done) {
+	shake_pending_command* cmd = &(eng->pending[i]);
+
+	if(cmd->future) {
+		cmd->future->value = (unsigned char)value;
+		shake_atomic_store_release(&(cmd->future->status), status);
+	}
+	done->callback = cmd->callback;
+	done->user = cmd->user;
+	done->addr = cmd->addr;
+	done->status = status;
+	done->value = (unsigned char)value;
+
+	cmd->active = FALSE;
+	eng->inflight--;
+}
+
+static void shake_command_callbacks(shake_device_private* devpriv, shake_command_completion* done, int count) {
+	int i;
+
+	for(i=0;i<count;i++) {
+		if(done[i].callback)
+			done[i].callback(devpriv->shake->dev, done[i].addr, done[i].status, done[i].value, done[i].user);
+	}
+}
+
+/*	completes every command which has passed its deadline (or every command, if <all> is TRUE) with
+*	SHAKE_COMMAND_TIMEOUT. Returns the time the next command will time out, so threads waiting for 
+*	replies know when to check again */
+static double shake_command_expire(shake_device_private* devpriv, BOOL all) {
+	shake_command_engine* eng = &(devpriv->commands);
+	shake_command_completion done[SHAKE_COMMAND_MAX_WINDOW];
+	double now = shake_time_now(), next = SHAKE_COMMAND_SENDING;
+	int i, count = 0;
+
+	shake_mutex_lock(&(eng->lock));
+	for(i=0;i<SHAKE_COMMAND_MAX_WINDOW;i++) {
+		if(!eng->pending[i].active)
+			continue;
+		if(all || now >= eng->pending[i].deadline)
+			shake_command_complete(eng, i, SHAKE_COMMAND_TIMEOUT, 0, &(done[count++]));
+		else if(eng->pending[i].deadline < next)
+			next = eng->pending[i].deadline;
+	}
+	shake_mutex_unlock(&(eng->lock));
+
+	if(count > 0) {
+		shake_command_wake(devpriv);
+		shake_command_callbacks(devpriv, done, count);
+	}
+	return next;
+}
+
+void shake_command_free(shake_device_private* devpriv) {
+	shake_command_engine* eng = &(devpriv->commands);
+
+	shake_command_expire(devpriv, TRUE);
+
+	// let any threads still waiting notice their commands have completed before the engine goes away
+	while(shake_atomic_load_acquire(&(eng->waiters)) > 0) {
+		shake_command_wake(devpriv);
+		shake_sleep(1);
+	}
+
+	shake_mutex_free(&(eng->lock));
+	shake_mutex_free(&(eng->send_lock));
+}
+
+/*	milliseconds left until the earlier of <deadline> and <next_timeout>, at least 1. While a command
+*	is still being sent there's no timeout to wait for, so waits are limited to SHAKE_COMMAND_TIMEOUT_MS */
+static int shake_command_remaining(double deadline, double next_timeout) {
+	double now = shake_time_now();
+	int ms;
+
+	if(next_timeout == SHAKE_COMMAND_SENDING)
+		next_timeout = now + (SHAKE_COMMAND_TIMEOUT_MS / 1000.0);
+	if(next_timeout < deadline)
+		deadline = next_timeout;
+	ms = (int)((deadline - now) * 1000.0 + 0.5);
+	return ms > 0 ? ms : 1;
+}
+
+int shake_command_send(shake_device_private* devpriv, char* buf, int len, int chunk_size, int delay_ms, int addr, int timeout_ms, int window, shake_future* future, shake_command_callback callback, void* user) {
+	shake_command_engine* eng = &(devpriv->commands);
+	shake_pending_command* cmd;
+	double now = shake_time_now(), next_timeout;
+	unsigned int gen, seq;
+	int i, written;
+	BOOL sent = TRUE, idle;
+
+	shake_atomic_add(&(eng->waiters), 1);
+	shake_mutex_lock(&(eng->lock));
+	while(eng->inflight >= (window > 0 ? window : eng->window)) {
+		gen = shake_atomic_load_acquire(&(eng->done_gen));
+		shake_mutex_unlock(&(eng->lock));
+
+		if(shake_atomic_load_acquire(&(devpriv->rthread_done))) {
+			shake_atomic_add(&(eng->waiters), -1);
+			return SHAKE_ERROR;
+		}
+		// every command completes by its deadline, so this can't wait forever. The commands 
+		// filling the window may have timed out without anyone noticing though
+		next_timeout = shake_command_expire(devpriv, FALSE);
+		shake_thread_wait_word(&(devpriv->thread), &(eng->done_gen), gen, shake_command_remaining(SHAKE_COMMAND_SENDING, next_timeout));
+
+		shake_mutex_lock(&(eng->lock));
+	}
+	shake_atomic_add(&(eng->waiters), -1);
+
+	for(i=0;eng->pending[i].active;i++)
+		;
+	cmd = &(eng->pending[i]);
+	cmd->active = TRUE;
+	cmd->addr = addr;
+	cmd->seq = seq = eng->next_seq++;
+	cmd->sent_time = now;
+	cmd->deadline = SHAKE_COMMAND_SENDING;
+	cmd->future = future;
+	cmd->callback = callback;
+	cmd->user = user;
+	if(future) {
+		future->address = addr;
+		future->value = 0;
+		future->status = SHAKE_COMMAND_PENDING;
+	}
+	idle = (eng->inflight++ == 0);
+	shake_mutex_unlock(&(eng->lock));
+
+	// the thread calling shake_command_tick() stops once nothing is in flight, so has to be told
+	if(idle) {
+		if(devpriv->reactor)
+			shake_reactor_wake(devpriv);
+		else
+			shake_thread_signal(&(devpriv->thread), CALLBACK_THREAD);
+	}
+
+	/* the command is registered before it is sent, so the reply can't arrive before anything is waiting for it */
+	shake_mutex_lock(&(eng->send_lock));
+	if(chunk_size > 0)
+		written = write_bytes_delayed(devpriv, buf, len, chunk_size, delay_ms);
+	else
+		written = write_bytes(devpriv, buf, len);
+	shake_mutex_unlock(&(eng->send_lock));
+
+	now = shake_time_now();
+	shake_mutex_lock(&(eng->lock));
+	// if the reply has already arrived the entry may belong to another command by now
+	if(cmd->active && cmd->seq == seq) {
+		if(written == len) {
+			cmd->deadline = now + (timeout_ms / 1000.0);
+		} else {
+			// nothing more will happen to this command, so drop it without completing it
+			cmd->active = FALSE;
+			eng->inflight--;
+			sent = FALSE;
+		}
+	}
+	shake_mutex_unlock(&(eng->lock));
+
+	if(!sent) {
+		shake_command_wake(devpriv);
+		return SHAKE_ERROR;
+	}
+	return SHAKE_SUCCESS;
+}
+
+int shake_command_wait(shake_device_private* devpriv, shake_future* future, int timeout_ms) {
+	shake_command_engine* eng = &(devpriv->commands);
+	double deadline = shake_time_now() + (timeout_ms / 1000.0), next_timeout;
+	unsigned int gen;
+	int status;
+
+	shake_atomic_add(&(eng->waiters), 1);
+	while(1) {
+		// read the generation before the status, so a completion after the check stops the wait below from sleeping
+		gen = shake_atomic_load_acquire(&(eng->done_gen));
+		status = shake_atomic_load_acquire(&(future->status));
+		if(status != SHAKE_COMMAND_PENDING)
+			break;
+		if(timeout_ms >= 0 && shake_time_now() >= deadline)
+			break;
+
+		next_timeout = shake_command_expire(devpriv, FALSE);
+		shake_thread_wait_word(&(devpriv->thread), &(eng->done_gen), gen, shake_command_remaining(timeout_ms >= 0 ? deadline : SHAKE_COMMAND_SENDING, next_timeout));
+	}
+	shake_atomic_add(&(eng->waiters), -1);
+	return status;
+}
+
+int shake_command_run(shake_device_private* devpriv, char* buf, int len, int chunk_size, int delay_ms, int addr, int timeout_ms, BOOL wait, unsigned char* value) {
+	shake_command_engine* eng = &(devpriv->commands);
+	shake_future future;
+	int written;
+
+	if(!wait) {
+		// nothing will wait for the reply, so there's no need to register the command
+		shake_mutex_lock(&(eng->send_lock));
+		if(chunk_size > 0)
+			written = write_bytes_delayed(devpriv, buf, len, chunk_size, delay_ms);
+		else
+			written = write_bytes(devpriv, buf, len);
+		shake_mutex_unlock(&(eng->send_lock));
+		return written == len ? SHAKE_SUCCESS : SHAKE_ERROR;
+	}
+
+	if(shake_command_send(devpriv, buf, len, chunk_size, delay_ms, addr, timeout_ms, 0, &future, NULL, NULL) != SHAKE_SUCCESS)
+		return SHAKE_ERROR;
+
+	if(shake_command_wait(devpriv, &future, -1) != SHAKE_COMMAND_ACK)
+		return SHAKE_ERROR;
+
+	if(value)
+		*value = future.value;
+	return SHAKE_SUCCESS;
+}
+
+BOOL shake_command_reply(shake_device_private* devpriv, BOOL ack, int addr, int value) {
+	shake_command_engine* eng = &(devpriv->commands);
+	shake_pending_command* cmd;
+	shake_command_completion done;
+	int i, match = -1, any = -1;
+
+	shake_mutex_lock(&(eng->lock));
+	// the oldest command for the same register gets the reply, or failing that the oldest one that takes any reply
+	for(i=0;i<SHAKE_COMMAND_MAX_WINDOW;i++) {
+		cmd = &(eng->pending[i]);
+		if(!cmd->active)
+			continue;
+		if(cmd->addr == addr) {
+			if(match == -1 || (int)(cmd->seq - eng->pending[match].seq) < 0)
+				match = i;
+		} else if(cmd->addr == SHAKE_COMMAND_ANY_ADDR) {
+			if(any == -1 || (int)(cmd->seq - eng->pending[any].seq) < 0)
+				any = i;
+		}
+	}
+	if(match == -1)
+		match = any;
+	if(match == -1) {
+		shake_mutex_unlock(&(eng->lock));
+		return FALSE;
+	}
+
+	shake_stats_latency(devpriv->stats.ack_latency, devpriv->packet_time - eng->pending[match].sent_time);
+	shake_command_complete(eng, match, ack ? SHAKE_COMMAND_ACK : SHAKE_COMMAND_NAK, value, &done);
+	shake_mutex_unlock(&(eng->lock));
+
+	shake_command_wake(devpriv);
+	shake_command_callbacks(devpriv, &done, 1);
+	return TRUE;
+}
+
+BOOL shake_command_tick(shake_device_private* devpriv) {
+	shake_command_engine* eng = &(devpriv->commands);
+	BOOL busy;
+
+	shake_command_expire(devpriv, FALSE);
+
+	shake_mutex_lock(&(eng->lock));
+	busy = eng->inflight > 0;
+	shake_mutex_unlock(&(eng->lock));
+	return busy;
+}
+
+int shake_command_set_window(shake_device_private* devpriv, int window) {
+	shake_command_engine* eng = &(devpriv->commands);
+
+	if(window < 1 || window > SHAKE_COMMAND_MAX_WINDOW)
+		return SHAKE_ERROR;
+
+	shake_mutex_lock(&(eng->lock));
+	eng->window = window;
+	shake_mutex_unlock(&(eng->lock));
+
+	// a larger window may let waiting commands go
+	shake_command_wake(devpriv);
+	return SHAKE_SUCCESS;
+}
@@ -0,0 +1,456 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+
+#include "shake_event.h"
+#include "shake_audio.h"
+#include "shake_reactor.h"
+#include "shake_stats.h"
+#include "SHAKE.h"
+
+/*	The event queue is a bounded multi-producer queue with a sequence number in each slot. A slot
+*	whose <seq> equals the position about to be filled is free: a producer claims that position by
+*	advancing <tail>, fills the slot in and then sets <seq> to position + 1 to publish it. The 
+*	dispatcher takes the event and sets <seq> to position + SHAKE_EVENT_QUEUE_SIZE, freeing the 
+*	slot for the next time round. */
+#define SHAKE_EVENT_QUEUE_MASK (SHAKE_EVENT_QUEUE_SIZE - 1)
+
+/* the threads started by shake_event_pool_start(), and the devices with events waiting for them */
+typedef struct {
+	int num_threads;
+	BOOL done;
+	int num_devices;					// devices in SHAKE_DISPATCH_POOL mode
+	shake_device_private* head;			// devices waiting for a pool thread, linked through events.pool_next
+	shake_device_private* tail;
+	shake_device_private** holding;		// device each thread is delivering events for, or NULL
+#ifdef _WIN32
+	HANDLE* threads;
+	DWORD* thread_ids;
+	HANDLE sem;							// released once for each device added to the list
+#else
+	pthread_t* threads;
+	pthread_cond_t cond;				// signalled when a device is added to the list
+#endif
+} shake_event_pool;
+
+// protects <pool> and everything in it, along with the pool fields of every device's queue
+#ifdef _WIN32
+static shake_mutex pool_lock;
+static volatile LONG pool_lock_ready = 0;
+#else
+static shake_mutex pool_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static shake_event_pool* pool = NULL;
+
+static void shake_event_pool_lock() {
+	#ifdef _WIN32
+	// a critical section can't be initialised statically, so the first caller does it
+	if(shake_atomic_load_acquire(&pool_lock_ready) != 2) {
+		if(shake_atomic_cas(&pool_lock_ready, 0, 1)) {
+			shake_mutex_init(&pool_lock);
+			shake_atomic_store_release(&pool_lock_ready, 2);
+		} else {
+			while(shake_atomic_load_acquire(&pool_lock_ready) != 2)
+				shake_sleep(1);
+		}
+	}
+	#endif
+	shake_mutex_lock(&pool_lock);
+}
+
+static void shake_event_pool_unlock() {
+	shake_mutex_unlock(&pool_lock);
+}
+
+void shake_event_init(shake_device_private* devpriv) {
+	shake_event_queue* q = &(devpriv->events);
+	int i;
+
+	for(i=0;i<SHAKE_EVENT_QUEUE_SIZE;i++)
+		q->slots[i].seq = i;
+	q->tail = q->head = 0;
+	q->mode = SHAKE_DISPATCH_THREAD;
+	shake_mutex_init(&(q->dispatch_lock));
+}
+
+BOOL shake_event_wanted(shake_device_private* devpriv) {
+	return devpriv->navcb || devpriv->navcb_STDCALL || devpriv->events.batch_cb;
+}
+
+// adds an event to the queue, returning FALSE if it's full
+static BOOL shake_event_push(shake_event_queue* q, int type, double timestamp) {
+	shake_event_slot* slot;
+	unsigned int pos, seq;
+
+	pos = shake_atomic_load_relaxed(&(q->tail));
+	while(1) {
+		slot = &(q->slots[pos & SHAKE_EVENT_QUEUE_MASK]);
+		seq = shake_atomic_load_acquire(&(slot->seq));
+		if(seq == pos) {
+			if(shake_atomic_cas(&(q->tail), pos, pos + 1))
+				break;
+		} else if((int)(seq - pos) < 0) {
+			// the slot still holds the event from the last time round
+			return FALSE;
+		}
+		// another thread got there first
+		pos = shake_atomic_load_relaxed(&(q->tail));
+	}
+
+	slot->event.type = type;
+	slot->event.timestamp = timestamp;
+	shake_atomic_store_release(&(slot->seq), pos + 1);
+	return TRUE;
+}
+
+// takes up to <max> events off the queue, must be called with <dispatch_lock> held
+static int shake_event_pop(shake_event_queue* q, shake_event* events, int max) {
+	shake_event_slot* slot;
+	int count = 0;
+
+	while(count < max) {
+		slot = &(q->slots[q->head & SHAKE_EVENT_QUEUE_MASK]);
+		if(shake_atomic_load_acquire(&(slot->seq)) != q->head + 1)
+			break;
+		events[count++] = slot->event;
+		shake_atomic_store_release(&(slot->seq), q->head + SHAKE_EVENT_QUEUE_SIZE);
+		q->head++;
+	}
+	return count;
+}
+
+// puts the device on the pool's list, unless it's already there
+static void shake_event_pool_queue(shake_device_private* devpriv) {
+	shake_event_queue* q = &(devpriv->events);
+
+	shake_event_pool_lock();
+	if(pool != NULL && !pool->done && !q->pool_queued) {
+		q->pool_queued = TRUE;
+		q->pool_next = NULL;
+		if(pool->tail)
+			pool->tail->events.pool_next = devpriv;
+		else
+			pool->head = devpriv;
+		pool->tail = devpriv;
+		#ifdef _WIN32
+		ReleaseSemaphore(pool->sem, 1, NULL);
+		#else
+		pthread_cond_signal(&(pool->cond));
+		#endif
+	}
+	shake_event_pool_unlock();
+}
+
+/* TRUE if the caller is a pool thread delivering the events of the device. Called with the pool lock held */
+static BOOL shake_event_pool_holding(shake_device_private* devpriv) {
+	int i;
+
+	if(pool == NULL)
+		return FALSE;
+	for(i=0;i<pool->num_threads;i++) {
+		#ifdef _WIN32
+		if(pool->thread_ids[i] == GetCurrentThreadId())
+		#else
+		if(pthread_equal(pool->threads[i], pthread_self()))
+		#endif
+			return pool->holding[i] == devpriv;
+	}
+	return FALSE;
+}
+
+/*	takes the device off the pool's list and waits for any pool thread delivering its events to 
+*	finish. <leaving> is TRUE if the device was in SHAKE_DISPATCH_POOL mode. Returns FALSE without
+*	waiting if the caller is itself one of those threads (ie this is a pool callback), as it can't 
+*	finish until this returns. <release> is then set on the device under the lock */
+static BOOL shake_event_pool_remove(shake_device_private* devpriv, BOOL leaving, BOOL release) {
+	shake_event_queue* q = &(devpriv->events);
+	shake_device_private *prev, *cur;
+
+	shake_event_pool_lock();
+	if(pool != NULL) {
+		if(leaving)
+			pool->num_devices--;
+		if(q->pool_queued) {
+			for(prev=NULL, cur=pool->head;cur!=devpriv;prev=cur, cur=(shake_device_private*)cur->events.pool_next)
+				;
+			if(prev)
+				prev->events.pool_next = q->pool_next;
+			else
+				pool->head = (shake_device_private*)q->pool_next;
+			if(pool->tail == devpriv)
+				pool->tail = prev;
+			q->pool_queued = FALSE;
+		}
+	}
+	if(shake_event_pool_holding(devpriv)) {
+		q->pool_release = release;
+		shake_event_pool_unlock();
+		return FALSE;
+	}
+	while(q->pool_busy > 0) {
+		shake_event_pool_unlock();
+		shake_sleep(1);
+		shake_event_pool_lock();
+	}
+	shake_event_pool_unlock();
+	return TRUE;
+}
+
+void shake_event_notify(shake_device_private* devpriv) {
+	switch(devpriv->events.mode) {
+		case SHAKE_DISPATCH_INLINE:
+			shake_event_dispatch(devpriv);
+			break;
+		case SHAKE_DISPATCH_POOL:
+			shake_event_pool_queue(devpriv);
+			break;
+		default:
+			if(devpriv->reactor)
+				shake_reactor_signal_event(devpriv);
+			else
+				shake_thread_signal(&(devpriv->thread), CALLBACK_THREAD);
+			break;
+	}
+}
+
+void shake_event_post(shake_device_private* devpriv, int type) {
+	if(!shake_event_push(&(devpriv->events), type, devpriv->packet_time))
+		shake_atomic_add(&(devpriv->stats.events_dropped), 1);
+	shake_event_notify(devpriv);
+}
+
+void shake_event_dispatch(shake_device_private* devpriv) {
+	shake_event_queue* q = &(devpriv->events);
+	shake_event batch[SHAKE_EVENT_BATCH_MAX];
+	shake_event_batch_callback batch_cb;
+	shake_device* dev = devpriv->shake->dev;
+	double now;
+	int i, count;
+
+	shake_mutex_lock(&(q->dispatch_lock));
+	// once a pool callback has freed the device nothing more is delivered
+	while(!q->pool_release && (count = shake_event_pop(q, batch, SHAKE_EVENT_BATCH_MAX)) > 0) {
+		now = shake_time_now();
+		for(i=0;i<count;i++)
+			shake_stats_latency(devpriv->stats.callback_latency, now - batch[i].timestamp);
+
+		batch_cb = q->batch_cb;
+		if(batch_cb) {
+			batch_cb(dev, batch, count, q->batch_user);
+			continue;
+		}
+		for(i=0;i<count;i++) {
+			if(devpriv->navcb)
+				devpriv->navcb(dev, batch[i].type);
+			#ifdef _WIN32
+			else if(devpriv->navcb_STDCALL)
+				devpriv->navcb_STDCALL(dev, batch[i].type);
+			#endif
+		}
+	}
+	if(!q->pool_release)
+		shake_mic_deliver(devpriv);
+	shake_mutex_unlock(&(q->dispatch_lock));
+}
+
+int shake_event_set_mode(shake_device_private* devpriv, int mode) {
+	shake_event_queue* q = &(devpriv->events);
+	int old = q->mode;
+
+	if(mode < SHAKE_DISPATCH_THREAD || mode > SHAKE_DISPATCH_INLINE)
+		return SHAKE_ERROR;
+
+	if(mode == SHAKE_DISPATCH_POOL && old != SHAKE_DISPATCH_POOL) {
+		shake_event_pool_lock();
+		if(pool == NULL || pool->done) {
+			shake_event_pool_unlock();
+			return SHAKE_ERROR;
+		}
+		pool->num_devices++;
+		shake_event_pool_unlock();
+	}
+
+	q->mode = mode;
+	if(old == SHAKE_DISPATCH_POOL && mode != SHAKE_DISPATCH_POOL)
+		shake_event_pool_remove(devpriv, TRUE, FALSE);
+
+	// anything already queued goes the new way
+	shake_event_notify(devpriv);
+	return SHAKE_SUCCESS;
+}
+
+BOOL shake_event_free(shake_device_private* devpriv) {
+	if(!shake_event_pool_remove(devpriv, devpriv->events.mode == SHAKE_DISPATCH_POOL, TRUE))
+		return FALSE;
+	shake_mutex_free(&(devpriv->events.dispatch_lock));
+	return TRUE;
+}
+
+#ifdef _WIN32
+static unsigned long __stdcall shake_event_pool_thread(void* param) {
+#else
+static void* shake_event_pool_thread(void* param) {
+#endif
+	int index = (int)(size_t)param;
+	shake_device_private* devpriv;
+
+	shake_event_pool_lock();
+	while(1) {
+		while(pool->head == NULL && !pool->done) {
+			#ifdef _WIN32
+			shake_event_pool_unlock();
+			WaitForSingleObject(pool->sem, INFINITE);
+			shake_event_pool_lock();
+			#else
+			pthread_cond_wait(&(pool->cond), &pool_lock);
+			#endif
+		}
+		if(pool->done)
+			break;
+
+		devpriv = pool->head;
+		pool->head = (shake_device_private*)devpriv->events.pool_next;
+		if(pool->head == NULL)
+			pool->tail = NULL;
+		devpriv->events.pool_queued = FALSE;
+		devpriv->events.pool_busy++;
+		pool->holding[index] = devpriv;
+		shake_event_pool_unlock();
+
+		shake_event_dispatch(devpriv);
+
+		shake_event_pool_lock();
+		pool->holding[index] = NULL;
+		// if one of the callbacks freed the device, the last thread to let go of it finishes the job
+		if(--devpriv->events.pool_busy == 0 && devpriv->events.pool_release) {
+			shake_event_pool_unlock();
+			shake_mutex_free(&(devpriv->events.dispatch_lock));
+			shake_release_device(devpriv);
+			shake_event_pool_lock();
+		}
+	}
+	shake_event_pool_unlock();
+	return 0;
+}
+
+/*	stops the first <started> threads of the pool and frees it. Called with the pool lock held,
+*	which is released */
+static void shake_event_pool_destroy(shake_event_pool* p, int started) {
+	int i;
+
+	p->done = TRUE;
+	#ifdef _WIN32
+	if(p->sem != NULL)
+		ReleaseSemaphore(p->sem, started, NULL);
+	#else
+	pthread_cond_broadcast(&(p->cond));
+	#endif
+	shake_event_pool_unlock();
+
+	for(i=0;i<started;i++) {
+		#ifdef _WIN32
+		WaitForSingleObject(p->threads[i], INFINITE);
+		CloseHandle(p->threads[i]);
+		#else
+		pthread_join(p->threads[i], NULL);
+		#endif
+	}
+
+	shake_event_pool_lock();
+	if(pool == p)
+		pool = NULL;
+	shake_event_pool_unlock();
+
+	#ifdef _WIN32
+	if(p->sem != NULL)
+		CloseHandle(p->sem);
+	free(p->thread_ids);
+	#else
+	pthread_cond_destroy(&(p->cond));
+	#endif
+	free(p->threads);
+	free(p->holding);
+	free(p);
+}
+
+SHAKE_API int shake_event_pool_start(int num_threads) {
+	shake_event_pool* p;
+	int i;
+
+	if(num_threads < 1)
+		return SHAKE_ERROR;
+
+	shake_event_pool_lock();
+	if(pool != NULL) {
+		shake_event_pool_unlock();
+		return SHAKE_ERROR;
+	}
+
+	p = (shake_event_pool*)calloc(1, sizeof(shake_event_pool));
+	if(p == NULL) {
+		shake_event_pool_unlock();
+		return SHAKE_ERROR;
+	}
+	p->num_threads = num_threads;
+	p->holding = (shake_device_private**)calloc(num_threads, sizeof(shake_device_private*));
+	#ifdef _WIN32
+	p->threads = (HANDLE*)calloc(num_threads, sizeof(HANDLE));
+	p->thread_ids = (DWORD*)calloc(num_threads, sizeof(DWORD));
+	p->sem = CreateSemaphore(NULL, 0, 0x7FFFFFFF, NULL);
+	if(p->holding == NULL || p->threads == NULL || p->thread_ids == NULL || p->sem == NULL) {
+	#else
+	p->threads = (pthread_t*)calloc(num_threads, sizeof(pthread_t));
+	pthread_cond_init(&(p->cond), NULL);
+	if(p->holding == NULL || p->threads == NULL) {
+	#endif
+		shake_event_pool_destroy(p, 0);
+		return SHAKE_ERROR;
+	}
+	pool = p;
+
+	// the threads wait for the lock, so can't look at <pool> until it's been filled in
+	for(i=0;i<num_threads;i++) {
+		#ifdef _WIN32
+		p->threads[i] = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)shake_event_pool_thread, (void*)(size_t)i, 0, &(p->thread_ids[i]));
+		if(p->threads[i] == NULL) {
+		#else
+		if(pthread_create(&(p->threads[i]), NULL, shake_event_pool_thread, (void*)(size_t)i) != 0) {
+		#endif
+			// the threads already started see <done> and exit
+			p->num_threads = i;
+			shake_event_pool_destroy(p, i);
+			return SHAKE_ERROR;
+		}
+	}
+	shake_event_pool_unlock();
+	return SHAKE_SUCCESS;
+}
+
+SHAKE_API int shake_event_pool_stop() {
+	shake_event_pool_lock();
+	if(pool == NULL || pool->num_devices > 0) {
+		shake_event_pool_unlock();
+		return SHAKE_ERROR;
+	}
+	shake_event_pool_destroy(pool, pool->num_threads);
+	return SHAKE_SUCCESS;
+}
@@ -1,210 +1,335 @@
-/*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-
-#include "shake_packets.h"
-#include "shake_io.h"
-#include "shake_serial_win32.h"
-#include "shake_serial_usb.h"
-#include "shake_rfcomm.h"
-#ifdef SHAKE_S60
-#include "shake_s60_rfcomm.h"
-#endif
-
-int read_debug_bytes(shake_device_private* devpriv, char* buf, int bytes_to_read) {
-	DWORD bytes_read;
-	int sleepcounter = 0;
-	int attempts = 0;
-	int remaining_bytes = bytes_to_read;
-
-	shake_sleep(10);
-
-	while(1) {
-		SHAKE_DBG("Reading %d bytes from position %d\n", remaining_bytes, ftell(devpriv->port.dbg_read));
-		if(devpriv->rthread_done) {
-			shake_thread_exit(102);
-		}
-		bytes_read = fread(buf + (bytes_to_read - remaining_bytes), 1, remaining_bytes, devpriv->port.dbg_read);
-
-		/* subtract the bytes we just read from the total amount we want */
-		remaining_bytes -= bytes_read;
-
-		/* if we didn't get them all.. */
-		if(remaining_bytes != 0) {
-			/* check if the thread is exiting, and if so break out of the loop and return */
-			if(devpriv->rthread_done) {
-				shake_thread_exit(103);	
-			}
-
-			if(feof(devpriv->port.dbg_read)) {
-				// seek back to start
-				fseek(devpriv->port.dbg_read, 0, SEEK_SET);
-				SHAKE_DBG("******************************** \n\n RETURNING TO START OF INPUT FILE \n ********************************* \n\n\n");
-			}
-
-			/* otherwise just loop back round and read the port again */
-			++sleepcounter;
-			if(sleepcounter > 15) {
-				shake_sleep(1);
-				attempts++;
-				sleepcounter = 0;
-
-				if(attempts > 30)
-					break;
-			}
-			continue;
-		} else
-			/* if all bytes have been read, break out of loop and return */
-			break;
-	}
-	devpriv->data_recv += (bytes_to_read - remaining_bytes);
-	return bytes_to_read - remaining_bytes;
-}
-
-/*	The driver supports several possible methods of creating a connection. 
-*	It can be given a virtual serial port number (currently Windows only), a Bluetooth address
-*	in string or 64-bit integer formats (opens an RFCOMM socket), or a filename. In the latter case data read
-*	from the file is treated exactly the same way as data coming from a Bluetooth connection
-*	making it very useful for debugging.
-*
-*	This requires different methods of opening the connection, so this function
-*	acts as a standard "read" interface for the rest of the code */
-int read_bytes(shake_device_private* dev, char* buf, int bytes_to_read) {
-	if(dev == NULL)
-		return 0;
-
-	if(dev->rthread_done)
-		shake_thread_exit(101);
-
-	int returned_bytes = 0;
-		
-	// if we've "peeked" a byte, put it back before reading any more real bytes
-	if(dev->peek_flag) {
-		buf[0] = dev->peek;
-		bytes_to_read--;
-		dev->peek_flag	= FALSE;
-		SHAKE_DBG("Peek flag reset, added byte %d/%02X\n", dev->peek, dev->peek);
-		returned_bytes = 1;
-
-		// can maybe just return here
-		if(bytes_to_read == 0) {
-			return 1;
-		}
-
-		// increase buf ptr
-		buf++;
-	}
-
-	switch(dev->port.comms_type) {
-		/* virtual serial port */
-		#ifdef _WIN32
-		case SHAKE_CONN_VIRTUAL_SERIAL_WIN32: {
-			returned_bytes += read_serial_bytes_win32(dev, buf, bytes_to_read);
-			return returned_bytes;
-		}
-		#endif
-		/* RFCOMM socket */
-		#ifdef SHAKE_RFCOMM_SUPPORTED
-		case SHAKE_CONN_RFCOMM_I64:
-		case SHAKE_CONN_RFCOMM_STR: {
-			returned_bytes += read_rfcomm_bytes(dev, buf, bytes_to_read);
-			return returned_bytes;
-		}
-		#endif
-		/* File */
-		case SHAKE_CONN_DEBUGFILE: {
-			returned_bytes += read_debug_bytes(dev, buf, bytes_to_read);
-			return returned_bytes;
-		}	
-		/* S60 Bluetooth */
-		#ifdef SHAKE_S60
-		case SHAKE_CONN_S60_RFCOMM: {
-			returned_bytes += read_s60_rfcomm_bytes(dev, buf, bytes_to_read);
-			return returned_bytes;
-		}
-		#endif
-		#ifndef _WIN32
-		case SHAKE_CONN_USB_SERIAL: {
-			returned_bytes += read_serial_bytes_usb(dev, buf, bytes_to_read);
-			return returned_bytes;
-		}
-		#endif
-		default:
-			break;
-	}
-	return 0;
-}
-
-int write_bytes(shake_device_private* dev, char* buf, int bytes_to_write) {
-	switch(dev->port.comms_type) {
-		#ifdef _WIN32
-		case SHAKE_CONN_VIRTUAL_SERIAL_WIN32:
-			return write_serial_bytes_win32(dev, buf, bytes_to_write);
-		#endif
-		#ifdef SHAKE_RFCOMM_SUPPORTED
-		case SHAKE_CONN_RFCOMM_I64:
-		case SHAKE_CONN_RFCOMM_STR:
-			return write_rfcomm_bytes(dev, buf, bytes_to_write);
-		#endif
-		case SHAKE_CONN_DEBUGFILE:
-			return fwrite(buf, 1, bytes_to_write, dev->port.dbg_write);
-		#ifdef SHAKE_S60
-		case SHAKE_CONN_S60_RFCOMM: 
-			return write_s60_rfcomm_bytes(dev, buf, bytes_to_write);
-		#endif	
-		#ifndef _WIN32
-		case SHAKE_CONN_USB_SERIAL:
-			return write_serial_bytes_usb(dev, buf, bytes_to_write);
-		#endif
-		default:
-			break;
-	}
-	return 0;
-}
-
-/* the SHAKE often has problems dealing with large incoming data packets. this typically occurs with audio
-*	or vibration uploads which can total 1063 bytes per packet. To avoid overflowing the receive buffer on the
-*	SHAKE, this function is used to upload packets in chunks of <chunk_size> bytes, with a gap of <delay_ms>
-*	between successive chunks */
-int write_bytes_delayed(shake_device_private* dev, char* buf, int bytes_to_write, int chunk_size, int delay_ms) {
-	switch(dev->port.comms_type) {
-		#ifdef _WIN32
-		case SHAKE_CONN_VIRTUAL_SERIAL_WIN32:
-			return write_serial_bytes_delayed_win32(dev, buf, bytes_to_write, chunk_size, delay_ms);
-		#endif
-		#ifdef SHAKE_RFCOMM_SUPPORTED
-		case SHAKE_CONN_RFCOMM_I64:
-		case SHAKE_CONN_RFCOMM_STR:
-			return write_rfcomm_bytes_delayed(dev, buf, bytes_to_write, chunk_size, delay_ms);
-		#endif
-		// no need to delay here
-		case SHAKE_CONN_DEBUGFILE:
-			return fwrite(buf, 1, bytes_to_write, dev->port.dbg_write);
-		#ifdef SHAKE_S60
-		case SHAKE_CONN_S60_RFCOMM:
-			return write_s60_rfcomm_bytes_delayed(dev, buf, bytes_to_write, chunk_size, delay_ms);
-		#endif
-		#ifndef _WIN32
-		case SHAKE_CONN_USB_SERIAL:
-			return write_serial_bytes_usb(dev, buf, bytes_to_write);
-		#endif
-		default:
-			break;
-	}
-	return 0;
-}
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "shake_packets.h"
+#include "shake_io.h"
+#include "shake_queue.h"
+#include "shake_stats.h"
+#include "shake_serial_win32.h"
+#include "shake_serial_usb.h"
+#include "shake_rfcomm.h"
+#include "shake_replay.h"
+#include "shake_capture.h"
+#ifdef SHAKE_S60
+#include "shake_s60_rfcomm.h"
+#endif
+
+/*	pulls more data from the port into the input buffer. The USB serial, RFCOMM and replay 
+*	backends return as soon as any data is available, so they are asked for as much as will fit 
+*	into the buffer in one go. The other backends block until the full amount requested has
+*	arrived, so they are only asked for the <wanted> bytes the caller is actually waiting for.
+*	Devices run by a reactor thread never block here, see shake_input_buffer.
+*	Returns number of bytes added to the buffer. */
+static int fill_input_buffer(shake_device_private* dev, int wanted) {
+	shake_input_buffer* in = &(dev->input);
+	unsigned int tailpos = in->tail & SHAKE_INPUT_BUFFER_MASK;
+	unsigned int keep = dev->reactor ? in->mark : in->head;	// oldest byte that may still be needed
+	int space = SHAKE_INPUT_BUFFER_SIZE - (in->tail - keep);
+	int contig = SHAKE_INPUT_BUFFER_SIZE - tailpos;
+	int bytes_read = 0;
+	double start;
+
+	/* the packets already in the buffer have been parsed, so wake anyone waiting for them 
+	*	before possibly blocking on the port */
+	if(dev->samples_pending)
+		shake_wake_sample_waiters(dev);
+
+	if(contig > space)
+		contig = space;
+	if(contig <= 0)
+		return 0;
+	if(wanted > contig)
+		wanted = contig;
+
+	start = shake_time_now();
+	switch(dev->port.comms_type) {
+		/* virtual serial port */
+		#ifdef _WIN32
+		case SHAKE_CONN_VIRTUAL_SERIAL_WIN32:
+			bytes_read = read_serial_bytes_win32(dev, in->data + tailpos, wanted);
+			break;
+		#endif
+		/* RFCOMM socket */
+		#ifdef SHAKE_RFCOMM_SUPPORTED
+		case SHAKE_CONN_RFCOMM_I64:
+		case SHAKE_CONN_RFCOMM_STR:
+		case SHAKE_CONN_SOCKET:
+			bytes_read = read_rfcomm_bytes(dev, in->data + tailpos, contig);
+			break;
+		#endif
+		/* File */
+		case SHAKE_CONN_DEBUGFILE:
+			bytes_read = read_replay_bytes(dev, in->data + tailpos, contig);
+			break;
+		/* S60 Bluetooth */
+		#ifdef SHAKE_S60
+		case SHAKE_CONN_S60_RFCOMM:
+			bytes_read = read_s60_rfcomm_bytes(dev, in->data + tailpos, wanted);
+			break;
+		#endif
+		#ifndef _WIN32
+		case SHAKE_CONN_USB_SERIAL:
+			bytes_read = read_serial_bytes_usb(dev, in->data + tailpos, contig);
+			break;
+		#endif
+		default:
+			break;
+	}
+
+	if(bytes_read <= 0) {
+		shake_stats_add(&(dev->stats.io_wait_ns), shake_stats_ns(shake_time_now() - start));
+		if(dev->reactor)
+			in->starved = TRUE;
+		return 0;
+	}
+
+	/* any packet parsed before the next read was completed by this data */
+	dev->packet_time = shake_time_now();
+	shake_stats_add(&(dev->stats.io_wait_ns), shake_stats_ns(dev->packet_time - start));
+	shake_stats_add(&(dev->stats.bytes), bytes_read);
+	if(dev->capturing)
+		shake_capture_record(dev, dev->packet_time, 0, in->data + tailpos, bytes_read);
+	in->tail += bytes_read;
+	return bytes_read;
+}
+
+/* copies <len> buffered bytes, starting <offset> bytes after the current read position, into <buf> */
+static void copy_input_buffer(shake_input_buffer* in, unsigned int offset, char* buf, int len) {
+	unsigned int startpos = (in->head + offset) & SHAKE_INPUT_BUFFER_MASK;
+	int first = SHAKE_INPUT_BUFFER_SIZE - startpos;
+
+	if(first > len)
+		first = len;
+	memcpy(buf, in->data + startpos, first);
+	if(len > first)
+		memcpy(buf + first, in->data, len - first);
+}
+
+/*	The driver supports several possible methods of creating a connection. 
+*	It can be given a virtual serial port number (currently Windows only), a Bluetooth address
+*	in string or 64-bit integer formats (opens an RFCOMM socket), or a filename. In the latter case data read
+*	from the file is treated exactly the same way as data coming from a Bluetooth connection
+*	making it very useful for debugging.
+*
+*	This requires different methods of opening the connection, so this function
+*	acts as a standard "read" interface for the rest of the code. Data is served from the
+*	per-device input buffer, which is refilled from the port whenever it runs dry. */
+int read_bytes(shake_device_private* dev, char* buf, int bytes_to_read) {
+	if(dev == NULL)
+		return 0;
+
+	if(shake_atomic_load_acquire(&(dev->rthread_done)))
+		shake_thread_exit(101);
+
+	shake_input_buffer* in = &(dev->input);
+	int returned_bytes = 0;
+
+	while(returned_bytes < bytes_to_read) {
+		int available = in->tail - in->head;
+
+		if(available == 0) {
+			/* nothing buffered, so wait for more data from the port. if none arrives
+			*	before the backend gives up, return what we have so far */
+			if(fill_input_buffer(dev, bytes_to_read - returned_bytes) == 0)
+				break;
+			continue;
+		}
+
+		if(available > bytes_to_read - returned_bytes)
+			available = bytes_to_read - returned_bytes;
+
+		copy_input_buffer(in, 0, buf + returned_bytes, available);
+		in->head += available;
+		returned_bytes += available;
+	}
+
+	return returned_bytes;
+}
+
+/*	Returns a pointer to the next <bytes> bytes of data in the input buffer without consuming
+*	them, waiting for more data to arrive from the port if necessary. The bytes are always 
+*	contiguous, so packets can be parsed where they are instead of being copied out first.
+*	The pointer remains valid until consume_bytes() or read_bytes() is called, and calling this
+*	again with a larger size returns the same pointer. 
+*	Returns NULL if the data didn't arrive before the port timed out. */
+char* frame_bytes(shake_device_private* dev, int bytes) {
+	if(dev == NULL || bytes > SHAKE_INPUT_BUFFER_SLACK)
+		return NULL;
+
+	if(shake_atomic_load_acquire(&(dev->rthread_done)))
+		shake_thread_exit(101);
+
+	shake_input_buffer* in = &(dev->input);
+	int available;
+
+	/* top up the buffer until it holds enough data or the port times out */
+	while((available = in->tail - in->head) < bytes) {
+		if(fill_input_buffer(dev, bytes - available) == 0)
+			return NULL;
+	}
+
+	/* if the data wraps around the end of the buffer, mirror the wrapped part into the slack space */
+	unsigned int headpos = in->head & SHAKE_INPUT_BUFFER_MASK;
+	if(headpos + bytes > SHAKE_INPUT_BUFFER_SIZE)
+		memcpy(in->data + SHAKE_INPUT_BUFFER_SIZE, in->data, headpos + bytes - SHAKE_INPUT_BUFFER_SIZE);
+
+	return in->data + headpos;
+}
+
+/* discards <bytes> bytes from the input buffer, normally once a packet from frame_bytes() has been parsed */
+void consume_bytes(shake_device_private* dev, int bytes) {
+	shake_input_buffer* in = &(dev->input);
+	int available = in->tail - in->head;
+
+	if(bytes > available)
+		bytes = available;
+	in->head += bytes;
+}
+
+/*	Used to resync with the data stream after a bad packet. Discards data from the input buffer
+*	until the next byte is a possible packet header ($ or 0x7F), reading at most <max_bytes> bytes.
+*	Returns the number of bytes discarded. */
+int skip_to_header(shake_device_private* dev, int max_bytes) {
+	shake_input_buffer* in = &(dev->input);
+	int discarded = 0;
+
+	while(discarded < max_bytes) {
+		int available = in->tail - in->head;
+
+		if(available == 0) {
+			if(fill_input_buffer(dev, 1) == 0)
+				break;
+			continue;
+		}
+
+		/* search the contiguous part of the buffered data for either header character */
+		unsigned int headpos = in->head & SHAKE_INPUT_BUFFER_MASK;
+		int len = SHAKE_INPUT_BUFFER_SIZE - headpos;
+		if(len > available)
+			len = available;
+		if(len > max_bytes - discarded)
+			len = max_bytes - discarded;
+
+		char* start = in->data + headpos;
+		char* found = (char*)memchr(start, 0x7F, len);
+		char* found_ascii = (char*)memchr(start, '$', found ? (found - start) : len);
+		if(found_ascii)
+			found = found_ascii;
+
+		if(found) {
+			in->head += (found - start);
+			discarded += (found - start);
+			break;
+		}
+
+		in->head += len;
+		discarded += len;
+	}
+
+	return discarded;
+}
+
+int write_bytes(shake_device_private* dev, char* buf, int bytes_to_write) {
+	int written = 0;
+
+	switch(dev->port.comms_type) {
+		#ifdef _WIN32
+		case SHAKE_CONN_VIRTUAL_SERIAL_WIN32:
+			written = write_serial_bytes_win32(dev, buf, bytes_to_write);
+			break;
+		#endif
+		#ifdef SHAKE_RFCOMM_SUPPORTED
+		case SHAKE_CONN_RFCOMM_I64:
+		case SHAKE_CONN_RFCOMM_STR:
+		case SHAKE_CONN_SOCKET:
+			written = write_rfcomm_bytes(dev, buf, bytes_to_write);
+			break;
+		#endif
+		case SHAKE_CONN_DEBUGFILE:
+			// replayed recordings opened without an output file just discard commands
+			if(dev->port.dbg_write == NULL)
+				written = bytes_to_write;
+			else
+				written = fwrite(buf, 1, bytes_to_write, dev->port.dbg_write);
+			break;
+		#ifdef SHAKE_S60
+		case SHAKE_CONN_S60_RFCOMM: 
+			written = write_s60_rfcomm_bytes(dev, buf, bytes_to_write);
+			break;
+		#endif	
+		#ifndef _WIN32
+		case SHAKE_CONN_USB_SERIAL:
+			written = write_serial_bytes_usb(dev, buf, bytes_to_write);
+			break;
+		#endif
+		default:
+			break;
+	}
+
+	if(dev->capturing && written > 0)
+		shake_capture_record(dev, shake_time_now(), SHAKE_CAPTURE_SENT, buf, written);
+	return written;
+}
+
+/* the SHAKE often has problems dealing with large incoming data packets. this typically occurs with audio
+*	or vibration uploads which can total 1063 bytes per packet. To avoid overflowing the receive buffer on the
+*	SHAKE, this function is used to upload packets in chunks of <chunk_size> bytes, with a gap of <delay_ms>
+*	between successive chunks */
+int write_bytes_delayed(shake_device_private* dev, char* buf, int bytes_to_write, int chunk_size, int delay_ms) {
+	int written = 0;
+
+	switch(dev->port.comms_type) {
+		#ifdef _WIN32
+		case SHAKE_CONN_VIRTUAL_SERIAL_WIN32:
+			written = write_serial_bytes_delayed_win32(dev, buf, bytes_to_write, chunk_size, delay_ms);
+			break;
+		#endif
+		#ifdef SHAKE_RFCOMM_SUPPORTED
+		case SHAKE_CONN_RFCOMM_I64:
+		case SHAKE_CONN_RFCOMM_STR:
+		case SHAKE_CONN_SOCKET:
+			written = write_rfcomm_bytes_delayed(dev, buf, bytes_to_write, chunk_size, delay_ms);
+			break;
+		#endif
+		// no need to delay here
+		case SHAKE_CONN_DEBUGFILE:
+			// replayed recordings opened without an output file just discard commands
+			if(dev->port.dbg_write == NULL)
+				written = bytes_to_write;
+			else
+				written = fwrite(buf, 1, bytes_to_write, dev->port.dbg_write);
+			break;
+		#ifdef SHAKE_S60
+		case SHAKE_CONN_S60_RFCOMM:
+			written = write_s60_rfcomm_bytes_delayed(dev, buf, bytes_to_write, chunk_size, delay_ms);
+			break;
+		#endif
+		#ifndef _WIN32
+		case SHAKE_CONN_USB_SERIAL:
+			written = write_serial_bytes_usb(dev, buf, bytes_to_write);
+			break;
+		#endif
+		default:
+			break;
+	}
+
+	if(dev->capturing && written > 0)
+		shake_capture_record(dev, shake_time_now(), SHAKE_CAPTURE_SENT, buf, written);
+	return written;
+}
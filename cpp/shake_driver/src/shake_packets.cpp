@@ -1,51 +1,218 @@
-/*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-
-#include "shake_packets.h"
-#include <ctype.h>
-
-// Given a number represented in ASCII of the form sdddd, where s is an optional
-// sign character (+/-) and each d is a decimal digit 0-9, returns the numeric equivalent.
-// Can also handle dddd, ddd, dd, sdd, etc
-int dec_ascii_to_int(char* ascii_buf, int buflen, int digits) {
-	int decval = 0, i, mult = 1;
-	for(i=buflen-1;i>=buflen-digits;i--) {
-		decval += (ascii_buf[i] - '0') * mult;
-		mult *= 10;
-	}
-	if(digits == buflen - 1 && ascii_buf[0] == '-')
-		decval *= -1;
-	return decval;
-}
-
-// as above but for hex. Doesn't handle 0x prefixes or h suffix, and relies on
-// any letters being upper case.
-int hex_ascii_to_int(char* ascii_buf, int buflen, int digits) {
-	int hexval = 0, i, mult = 1;
-	for(i=buflen-1;i>=buflen-digits;i--) {
-		if(isdigit(ascii_buf[i]))
-			hexval += (ascii_buf[i] - '0') * mult;
-		else
-			hexval += ((ascii_buf[i] - 'A') + 10) * mult;
-		mult *= 16;
-	}
-	if(digits == buflen - 1 && ascii_buf[0] == '-')
-		hexval *= -1;
-	return hexval;
-}
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "shake_packets.h"
+#include <ctype.h>
+#include <string.h>
+
+// Given a number represented in ASCII of the form sdddd, where s is an optional
+// sign character (+/-) and each d is a decimal digit 0-9, returns the numeric equivalent.
+// Can also handle dddd, ddd, dd, sdd, etc
+int dec_ascii_to_int(char* ascii_buf, int buflen, int digits) {
+	int decval = 0, i, mult = 1;
+
+	// use the fixed width decoders for the common cases
+	if(digits == 4 && buflen == 5)
+		return dec_ascii4s_to_int(ascii_buf);
+	if(digits == 4 && buflen == 4)
+		return dec_ascii4_to_int(ascii_buf);
+	if(digits == 2 && buflen == 2)
+		return dec_ascii2_to_int(ascii_buf);
+
+	for(i=buflen-1;i>=buflen-digits;i--) {
+		decval += (ascii_buf[i] - '0') * mult;
+		mult *= 10;
+	}
+	if(digits == buflen - 1 && ascii_buf[0] == '-')
+		decval *= -1;
+	return decval;
+}
+
+// as above but for hex. Doesn't handle 0x prefixes or h suffix, and relies on
+// any letters being upper case.
+int hex_ascii_to_int(char* ascii_buf, int buflen, int digits) {
+	int hexval = 0, i, mult = 1;
+
+	// use the fixed width decoders for the common cases
+	if(digits == 2 && buflen == 2)
+		return hex_ascii2_to_int(ascii_buf);
+	if(digits == 4 && buflen == 4)
+		return hex_ascii4_to_int(ascii_buf);
+
+	for(i=buflen-1;i>=buflen-digits;i--) {
+		if(isdigit(ascii_buf[i]))
+			hexval += (ascii_buf[i] - '0') * mult;
+		else
+			hexval += ((ascii_buf[i] - 'A') + 10) * mult;
+		mult *= 16;
+	}
+	if(digits == buflen - 1 && ascii_buf[0] == '-')
+		hexval *= -1;
+	return hexval;
+}
+
+/* 	powers of ten used to scale decimal fields, all of these are exactly representable as doubles
+*	(and up to 1e10 as floats) so the divisions below are correctly rounded */
+static const double shake_pow10[] = { 
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 
+	1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18 
+};
+
+#define SHAKE_MAX_DECIMAL_DIGITS 18
+
+int dec_ascii_to_float(char* ascii_buf, int buflen, float* value) {
+	int i = 0, neg = FALSE, point = FALSE, seen = FALSE, sigdigits = 0, fracdigits = 0;
+	unsigned long long mantissa = 0;
+
+	while(i < buflen && ascii_buf[i] == ' ')
+		i++;
+
+	if(i < buflen && (ascii_buf[i] == '+' || ascii_buf[i] == '-')) {
+		neg = (ascii_buf[i] == '-');
+		i++;
+	}
+
+	for(;i<buflen;i++) {
+		unsigned int d = (unsigned char)ascii_buf[i] - '0';
+		if(d <= 9) {
+			seen = TRUE;
+			// leading zeros in the integer part don't count towards the precision limit
+			if(mantissa == 0 && d == 0 && !point)
+				continue;
+			if(sigdigits == SHAKE_MAX_DECIMAL_DIGITS) {
+				// any further fractional digits are beyond the precision of a float anyway
+				if(!point)
+					return 0;
+				continue;
+			}
+			mantissa = (mantissa * 10) + d;
+			sigdigits++;
+			if(point)
+				fracdigits++;
+		} else if(ascii_buf[i] == '.' && !point) {
+			point = TRUE;
+		} else {
+			break;
+		}
+	}
+
+	if(!seen)
+		return 0;
+
+	// when both the digits and the power of ten are exact floats a single float division is
+	// already correctly rounded, which covers every field the device prints
+	if(mantissa <= (1 << 24) && fracdigits <= 10)
+		*value = (float)mantissa / (float)shake_pow10[fracdigits];
+	else
+		*value = (float)((double)mantissa / shake_pow10[fracdigits]);
+	if(neg)
+		*value = -*value;
+	return i;
+}
+
+int dec_ascii_to_floats(char* ascii_buf, int buflen, float* values, int count) {
+	int i, pos = 0, used;
+
+	for(i=0;i<count;i++) {
+		if(i > 0) {
+			if(pos >= buflen || ascii_buf[pos] != ',')
+				break;
+			pos++;
+		}
+		used = dec_ascii_to_float(ascii_buf + pos, buflen - pos, &values[i]);
+		if(used == 0)
+			break;
+		pos += used;
+	}
+	return i;
+}
+
+BOOL ascii_checksum_ok(char* packet, int packet_size) {
+	int i, end = packet_size - 5;	// position of the separator before the checksum digits
+	unsigned char sum = 0;
+	char c;
+
+	if(end < 1)
+		return FALSE;
+	for(i=1;i<end;i++)
+		sum ^= (unsigned char)packet[i];
+
+	for(i=end+1;i<end+3;i++) {
+		c = packet[i];
+		if(!((c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f')))
+			return FALSE;
+	}
+	return hex_ascii2_to_int(packet + end + 1) == sum;
+}
+
+
+// hashes a 4 byte ASCII header into a slot in the lookup table
+static unsigned int shake_header_hash(unsigned int key) {
+	return (key * 2654435761u) >> 25;	// top 7 bits, matching SHAKE_HEADER_LOOKUP_SIZE
+}
+
+void shake_build_header_lookup(shake_header_lookup* lookup, char** ascii_headers, int num_ascii, char* raw_headers, int num_raw, int first_raw_type) {
+	int i;
+
+	if(shake_atomic_load_acquire(&(lookup->state)) == SHAKE_LOOKUP_BUILT)
+		return;
+	if(!shake_atomic_cas(&(lookup->state), SHAKE_LOOKUP_EMPTY, SHAKE_LOOKUP_BUILDING)) {
+		// another device is building it, which only takes a few microseconds
+		while(shake_atomic_load_acquire(&(lookup->state)) != SHAKE_LOOKUP_BUILT)
+			shake_sleep(1);
+		return;
+	}
+
+	memset(lookup->ascii_keys, 0, sizeof(lookup->ascii_keys));
+	memset(lookup->ascii_types, SHAKE_BAD_PACKET, sizeof(lookup->ascii_types));
+	memset(lookup->raw_types, SHAKE_BAD_PACKET, sizeof(lookup->raw_types));
+
+	for(i=0;i<num_ascii;i++) {
+		unsigned int key, slot;
+		memcpy(&key, ascii_headers[i], 4);
+
+		// linear probing, keeping the first entry if a header appears twice
+		slot = shake_header_hash(key);
+		while(lookup->ascii_types[slot] != SHAKE_BAD_PACKET && lookup->ascii_keys[slot] != key)
+			slot = (slot + 1) & (SHAKE_HEADER_LOOKUP_SIZE - 1);
+
+		if(lookup->ascii_types[slot] == SHAKE_BAD_PACKET) {
+			lookup->ascii_keys[slot] = key;
+			lookup->ascii_types[slot] = i;
+		}
+	}
+
+	for(i=num_raw-1;i>=0;i--) 
+		lookup->raw_types[(unsigned char)raw_headers[i]] = first_raw_type + i;
+
+	shake_atomic_store_release(&(lookup->state), SHAKE_LOOKUP_BUILT);
+}
+
+int shake_lookup_ascii_header(shake_header_lookup* lookup, char* header) {
+	unsigned int key, slot;
+	memcpy(&key, header, 4);
+
+	slot = shake_header_hash(key);
+	while(lookup->ascii_types[slot] != SHAKE_BAD_PACKET) {
+		if(lookup->ascii_keys[slot] == key)
+			return lookup->ascii_types[slot];
+		slot = (slot + 1) & (SHAKE_HEADER_LOOKUP_SIZE - 1);
+	}
+	return SHAKE_BAD_PACKET;
+}
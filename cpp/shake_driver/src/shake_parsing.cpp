@@ -1,83 +1,159 @@
-/*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-
-#include "shake_packets.h"
-#include "shake_io.h"
-#include "shake_parsing.h"
-
-
-/*	Reads a line of the information that a SHAKE outputs when first connected.
-*	devpriv: the device to read the info from
-*	buf: receive buffer
-*	maxlen: length of buffer */
-int shake_read_info_line(shake_device_private* devpriv, char* buf, int maxlen) {
-	int bufpos = 0;
-
-	while(bufpos < maxlen) {
-		// read a byte
-		char tmp;
-		read_bytes(devpriv, &tmp, 1);
-
-		// XXX some SHAKEs seem to output a stray null character or two in the startup text, skip it here
-		if(tmp == 0)
-			continue;
-
-		buf[bufpos] = tmp;
-
-		if(buf[bufpos] == 0xD || buf[bufpos] == 0xA) {
-			// compare last 2 bytes (if possible) to the delimiter
-			if(bufpos >= 1) {
-				int i;
-					
-				// return if delimiter is matched
-				i = bufpos - 1;
-				if((buf[i] == 0xA && buf[i+1] == 0xD) || (buf[i] == 0xD && buf[i+1] == 0xA))
-					return i;
-			}
-		}
-		bufpos++;
-	}
-
-	return -1;
-}
-
-/*	Compresses 16-bit signed audio in the <samples> array to 8-bit mu-Law format ready
-*	for transmission to the SHAKE, storing the result in the <output> array. <count> gives
-*	the number of samples (not bytes) in the <samples> array. */
-void shake_mulaw_compress(short* samples, int count, unsigned char* output) {	
-	int i=0;
-	for(i=0;i<count;i++)
-		output[i] = LinearToMuLawSample(samples[i]);
-}
-
-void shake_mulaw_lookup(short* dest, unsigned char* data, int len) {
-	int i;
-	for(i=0;i<len;i++) {
-		if(data[i] == 0x00) {
-			data[i] = 0x7F;
-		}
-		dest[i] = MuLawDecompressTable[data[i]];// / 8192;
-	}
-}
-
-/*	Compresses 16-bit audio to the 8-bit format required by the SHAKE, and sends the data */
-void shake_compress_and_send_audio(shake_device_private* dev) {
-	shake_mulaw_compress(dev->playbackbuf, SHAKE_AUDIO_DATA_LEN, (unsigned char*)dev->playback_packet + 5);
-	write_bytes(dev, dev->playback_packet, SHAKE_AUDIO_DATA_LEN + 5);
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "shake_packets.h"
+#include "shake_io.h"
+#include "shake_parsing.h"
+
+#ifdef SHAKE_SSE2_MULAW
+#include <emmintrin.h>
+#endif
+
+
+/*	Reads a line of the information that a SHAKE outputs when first connected.
+*	devpriv: the device to read the info from
+*	buf: receive buffer
+*	maxlen: length of buffer */
+int shake_read_info_line(shake_device_private* devpriv, char* buf, int maxlen) {
+	int bufpos = 0;
+
+	while(bufpos < maxlen) {
+		// read a byte
+		char tmp;
+		read_bytes(devpriv, &tmp, 1);
+
+		// XXX some SHAKEs seem to output a stray null character or two in the startup text, skip it here
+		if(tmp == 0)
+			continue;
+
+		buf[bufpos] = tmp;
+
+		if(buf[bufpos] == 0xD || buf[bufpos] == 0xA) {
+			// compare last 2 bytes (if possible) to the delimiter
+			if(bufpos >= 1) {
+				int i;
+					
+				// return if delimiter is matched
+				i = bufpos - 1;
+				if((buf[i] == 0xA && buf[i+1] == 0xD) || (buf[i] == 0xD && buf[i+1] == 0xA))
+					return i;
+			}
+		}
+		bufpos++;
+	}
+
+	return -1;
+}
+
+#ifdef SHAKE_SSE2_MULAW
+/*	LinearToMuLawSample() for 8 samples, giving one code in each 16 bit lane. The biased magnitude
+*	is converted to float, which is exact for 16 bit values and finds the leading 1 bit without any 
+*	lookups: the float's exponent is the mu-Law exponent + 134 and the top 4 bits of its mantissa are
+*	the 4 bits below the leading 1, which are the mu-Law mantissa. The magnitude of -32768 wraps back 
+*	to -32768 and escapes the clip, as it does in LinearToMuLawSample(), and the 0x7FFF mask gives 
+*	it the same exponent and mantissa as MuLawCompressTable does */
+static inline __m128i shake_mulaw_compress8(__m128i samples) {
+	__m128i neg = _mm_srai_epi16(samples, 15);
+	__m128i mag = _mm_sub_epi16(_mm_xor_si128(samples, neg), neg);
+	__m128i lo, hi;
+
+	mag = _mm_min_epi16(mag, _mm_set1_epi16(cClip));
+	mag = _mm_and_si128(_mm_add_epi16(mag, _mm_set1_epi16(cBias)), _mm_set1_epi16(0x7FFF));
+
+	lo = _mm_castps_si128(_mm_cvtepi32_ps(_mm_unpacklo_epi16(mag, _mm_setzero_si128())));
+	hi = _mm_castps_si128(_mm_cvtepi32_ps(_mm_unpackhi_epi16(mag, _mm_setzero_si128())));
+	lo = _mm_sub_epi32(_mm_srli_epi32(lo, 19), _mm_set1_epi32(134 << 4));
+	hi = _mm_sub_epi32(_mm_srli_epi32(hi, 19), _mm_set1_epi32(134 << 4));
+
+	return _mm_xor_si128(_mm_or_si128(_mm_packs_epi32(lo, hi), _mm_and_si128(neg, _mm_set1_epi16(0x80))), 
+						_mm_set1_epi16(0xFF));
+}
+
+/*	Magnitudes for 4 values of n (see shake_mulaw_lookup()) in 32 bit lanes. n holds a 3 bit exponent
+*	e and 4 bit mantissa m, and the magnitude is ((m*2 + 34) << e) - 33. The first part is 
+*	(16 + m + 1) << (e + 1), which is built directly as a float and converted back, the carry from 
+*	m + 1 = 16 moving into the exponent by itself. The 33 is left for the caller to take off */
+static inline __m128i shake_mulaw_magnitude4(__m128i n) {
+	return _mm_cvttps_epi32(_mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32((132 << 4) + 1)), 19)));
+}
+#endif
+
+/*	Compresses 16-bit signed audio in the <samples> array to 8-bit mu-Law format ready
+*	for transmission to the SHAKE, storing the result in the <output> array. <count> gives
+*	the number of samples (not bytes) in the <samples> array. */
+void shake_mulaw_compress(const short* samples, int count, unsigned char* output) {	
+	int i=0;
+	#ifdef SHAKE_SSE2_MULAW
+	for(;i+16<=count;i+=16) {
+		__m128i lo = shake_mulaw_compress8(_mm_loadu_si128((const __m128i*)(samples + i)));
+		__m128i hi = shake_mulaw_compress8(_mm_loadu_si128((const __m128i*)(samples + i + 8)));
+		_mm_storeu_si128((__m128i*)(output + i), _mm_packus_epi16(lo, hi));
+	}
+	#endif
+	for(;i<count;i++)
+		output[i] = LinearToMuLawSample(samples[i]);
+}
+
+/*	Reading MuLawDecompressTable from the end, bytes 0xFE down to 0x80 hold the positive values
+*	for n = 0 to 126 and bytes 0x7F down to 0x00 the negative values for n = 0 to 127. 0xFF is 0, 
+*	since the positive half starts one place later than the negative half. The SSE2 version 
+*	works out n for 16 bytes at once and gets the magnitudes from shake_mulaw_magnitude4(). 
+*	A table lookup per byte is as fast as that for short buffers (bench_mulaw), so buffers of fewer 
+*	than SHAKE_MULAW_SIMD_MIN_LOOKUP bytes, such as the 32 byte SK6 audio frames, just use the table */
+#define SHAKE_MULAW_SIMD_MIN_LOOKUP	64
+
+void shake_mulaw_lookup(short* dest, const unsigned char* data, int len) {
+	int i=0;
+	#ifdef SHAKE_SSE2_MULAW
+	__m128i zero = _mm_setzero_si128();
+	__m128i bytes, neg, top, n, half, lo, hi, neglo, neghi;
+
+	if(len >= SHAKE_MULAW_SIMD_MIN_LOOKUP) {
+		for(;i+16<=len;i+=16) {
+			bytes = _mm_loadu_si128((const __m128i*)(data + i));
+			// 0x00 is decoded as 0x7F
+			bytes = _mm_or_si128(bytes, _mm_and_si128(_mm_cmpeq_epi8(bytes, zero), _mm_set1_epi8(0x7F)));
+			neg = _mm_cmpgt_epi8(bytes, _mm_set1_epi8(-1));
+			top = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(-1));
+			// n = 127 - byte for the negative half, 254 - byte for the positive half
+			n = _mm_sub_epi8(_mm_xor_si128(_mm_set1_epi8((char)254), _mm_and_si128(neg, _mm_set1_epi8((char)(127 ^ 254)))), bytes);
+
+			half = _mm_unpacklo_epi8(n, zero);
+			lo = _mm_packs_epi32(shake_mulaw_magnitude4(_mm_unpacklo_epi16(half, zero)), shake_mulaw_magnitude4(_mm_unpackhi_epi16(half, zero)));
+			half = _mm_unpackhi_epi8(n, zero);
+			hi = _mm_packs_epi32(shake_mulaw_magnitude4(_mm_unpacklo_epi16(half, zero)), shake_mulaw_magnitude4(_mm_unpackhi_epi16(half, zero)));
+
+			lo = _mm_andnot_si128(_mm_unpacklo_epi8(top, top), _mm_sub_epi16(lo, _mm_set1_epi16(33)));
+			hi = _mm_andnot_si128(_mm_unpackhi_epi8(top, top), _mm_sub_epi16(hi, _mm_set1_epi16(33)));
+			neglo = _mm_unpacklo_epi8(neg, neg);
+			neghi = _mm_unpackhi_epi8(neg, neg);
+			_mm_storeu_si128((__m128i*)(dest + i), _mm_sub_epi16(_mm_xor_si128(lo, neglo), neglo));
+			_mm_storeu_si128((__m128i*)(dest + i + 8), _mm_sub_epi16(_mm_xor_si128(hi, neghi), neghi));
+		}
+	}
+	#endif
+	for(;i<len;i++)
+		dest[i] = MuLawDecompressTable[data[i] ? data[i] : 0x7F];
+}
+
+/*	Compresses 16-bit audio to the 8-bit format required by the SHAKE, and sends the data */
+void shake_compress_and_send_audio(shake_device_private* dev) {
+	shake_mulaw_compress(dev->playbackbuf, SHAKE_AUDIO_DATA_LEN, (unsigned char*)dev->playback_packet + 5);
+	write_bytes(dev, dev->playback_packet, SHAKE_AUDIO_DATA_LEN + 5);
 }
\ No newline at end of file
@@ -0,0 +1,127 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+#include "shake_queue.h"
+#include <string.h>
+
+int shake_queue_enable(shake_device_private* devpriv, int sensor, int depth) {
+	shake_sample_queue* q;
+	unsigned int size = 1;
+
+	if(sensor < 0 || sensor >= SHAKE_NUM_SAMPLE_QUEUES || depth < 0)
+		return SHAKE_ERROR;
+
+	// SK7 capacitive packets have 12 values, they aren't queued
+	if(sensor == SHAKE_SENSOR_CAP && devpriv->device_type == SHAKE_SK7)
+		return SHAKE_ERROR;
+
+	q = &(devpriv->queues[sensor]);
+	if(depth == 0) {
+		q->enabled = FALSE;
+		return SHAKE_SUCCESS;
+	}
+
+	while(size < (unsigned int)depth)
+		size <<= 1;
+
+	if(q->samples == NULL) {
+		q->samples = (shake_sample*)malloc(sizeof(shake_sample) * size);
+		if(q->samples == NULL)
+			return SHAKE_ERROR;
+		q->mask = size - 1;
+	} else if(q->mask != size - 1) {
+		// the reader thread may be using the queue, so it can't be resized
+		return SHAKE_ERROR;
+	}
+
+	// the queue has to be set up before the reader thread sees it enabled
+	shake_atomic_store_release(&(q->enabled), TRUE);
+	return SHAKE_SUCCESS;
+}
+
+void shake_queue_free(shake_device_private* devpriv) {
+	int i;
+
+	for(i=0;i<SHAKE_NUM_SAMPLE_QUEUES;i++) {
+		devpriv->queues[i].enabled = FALSE;
+		free(devpriv->queues[i].samples);
+		devpriv->queues[i].samples = NULL;
+	}
+}
+
+int shake_queue_count(shake_sample_queue* q) {
+	if(q->samples == NULL)
+		return 0;
+
+	return shake_atomic_load_acquire(&(q->tail)) - q->head;
+}
+
+int shake_queue_pop(shake_sample_queue* q, shake_sample* samples, int max) {
+	unsigned int head, tail, count, first;
+
+	if(q->samples == NULL || max <= 0)
+		return 0;
+
+	head = q->head;
+	tail = shake_atomic_load_acquire(&(q->tail));
+	count = tail - head;
+	if(count > (unsigned int)max)
+		count = max;
+
+	// copy in at most two blocks, the second if the samples wrap around the end of the queue
+	first = (q->mask + 1) - (head & q->mask);
+	if(first > count)
+		first = count;
+	memcpy(samples, &(q->samples[head & q->mask]), first * sizeof(shake_sample));
+	memcpy(samples + first, q->samples, (count - first) * sizeof(shake_sample));
+
+	// only release the entries back to the reader thread once they've been copied
+	shake_atomic_store_release(&(q->head), head + count);
+	return count;
+}
+
+void shake_read_sensor(shake_device_private* devpriv, int sensor, shake_sample* sample, shake_stream_stats* stats) {
+	shake_sensor_block* b = &(devpriv->sensors[sensor]);
+	unsigned int version;
+
+	// retry until the reader thread didn't update the block while it was being copied
+	do {
+		version = shake_atomic_load_acquire(&(b->version));
+		*sample = b->sample;
+		if(stats)
+			*stats = b->stats;
+		shake_atomic_fence_acquire();
+	} while((version & 1) || version != b->version);
+}
+
+void shake_wake_sample_waiters(shake_device_private* devpriv) {
+	unsigned int waiters;
+
+	devpriv->samples_pending = FALSE;
+	shake_atomic_store_release(&(devpriv->sample_gen), devpriv->sample_gen + 1);
+
+	// pairs with the increment of <sample_waiters> in shake_wait_sample(): either the waiting
+	// thread sees the new samples, or this sees the waiting thread
+	shake_atomic_fence();
+	waiters = shake_atomic_load_acquire(&(devpriv->sample_waiters));
+	if(waiters > 0)
+		shake_thread_wake_word(&(devpriv->thread), &(devpriv->sample_gen), waiters);
+}
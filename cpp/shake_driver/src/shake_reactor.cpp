@@ -0,0 +1,541 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+
+#include "shake_reactor.h"
+#include "shake_command.h"
+#include "shake_event.h"
+#include "shake_io.h"
+#include "shake_queue.h"
+#include "shake_stats.h"
+#include "SHAKE.h"
+
+#ifdef SHAKE_REACTOR_SUPPORTED
+#include <sched.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <termios.h>
+
+// most ready devices handled for each call to epoll_wait()
+#define SHAKE_REACTOR_MAX_EVENTS 64
+
+struct shake_reactor_thread {
+	int epfd;					// epoll set holding the ports of the devices, plus <wakefd>
+	int wakefd;					// eventfd written to make the thread look at <devices> for ones being closed, or commands sent
+	int cpu;					// CPU the thread is pinned to, or -1
+	pthread_t thread;
+	pthread_t cbthread;			// makes the event callbacks for all the devices
+	volatile BOOL done;
+
+	pthread_mutex_t lock;		// protects everything below
+	pthread_cond_t cond;		// signalled when an event is queued or a callback returns
+	shake_device_private** devices;	// devices run by this thread
+	int num_devices, max_devices;
+	shake_device_private** events;	// ring of devices waiting for an event callback, each appears at most once
+	int event_head, num_events;
+	shake_device_private* dispatching;	// device whose callback is being called
+};
+
+static shake_reactor_thread* reactors = NULL;
+static int num_reactors = 0;
+static pthread_mutex_t reactors_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*	adds 1 to the eventfd <fd>, waking the reactor thread. EAGAIN only happens if the counter is 
+*	about to overflow, in which case the thread is going to wake up anyway */
+static void shake_reactor_poke(int fd) {
+	SHAKE_INT64 wakeval = 1;
+
+	while(write(fd, &wakeval, sizeof(wakeval)) == -1 && errno == EINTR)
+		;
+}
+
+/*	resets the eventfd <fd> after a wakeup. EAGAIN means it has already been reset, since the 
+*	eventfd is non-blocking */
+static void shake_reactor_drain(int fd) {
+	SHAKE_INT64 wakeval;
+
+	while(read(fd, &wakeval, sizeof(wakeval)) == -1 && errno == EINTR)
+		;
+}
+
+// file descriptor epoll should watch for a device, or -1 if the connection type isn't supported
+static int shake_reactor_fd(shake_device_private* devpriv) {
+	switch(devpriv->port.comms_type) {
+		case SHAKE_CONN_USB_SERIAL:
+			return devpriv->port.serial_usb.port;
+		#ifdef SHAKE_RFCOMM_SUPPORTED
+		case SHAKE_CONN_RFCOMM_I64:
+		case SHAKE_CONN_RFCOMM_STR:
+		case SHAKE_CONN_SOCKET:
+			return devpriv->port.rfcomm.sock;
+		#endif
+		default:
+			break;
+	}
+	return -1;
+}
+
+/*	parses every complete packet that can be read from the port without waiting. This is the
+*	same job as the loop in shake_read_thread(), except that when the port runs dry part way
+*	through a packet, the packet is left in the input buffer to be parsed again from the start 
+*	once the rest of it has arrived (see shake_input_buffer) */
+static void shake_reactor_service(shake_device_private* devpriv) {
+	shake_input_buffer* in = &(devpriv->input);
+	char packetbuf[256];	// scratch buffer for packets that can't be parsed in place
+	int packet_type;
+	BOOL timed;
+	double t0 = 0, t1 = 0;
+	SHAKE_INT64 io0 = 0, io1 = 0;
+
+	while(1) {
+		in->mark = in->head;
+		in->starved = FALSE;
+
+		timed = ((++devpriv->stats_tick & (SHAKE_STATS_TIMING_INTERVAL - 1)) == 0);
+		if(timed) {
+			io0 = devpriv->stats.io_wait_ns;
+			t0 = shake_time_now();
+		}
+
+		packet_type = devpriv->shake->get_next_packet();
+		if(packet_type == SHAKE_BAD_PACKET) {
+			// carry on if some junk was skipped, otherwise there's nothing more to parse yet
+			if(in->starved && in->head == in->mark)
+				break;
+			continue;
+		}
+
+		if(timed) {
+			io1 = devpriv->stats.io_wait_ns;
+			t1 = shake_time_now();
+		}
+
+		devpriv->shake->parse_packet(packetbuf, packet_type);
+		if(in->starved) {
+			in->head = in->mark;
+			break;
+		}
+
+		shake_stats_packet(devpriv, packet_type);
+		if(timed) {
+			shake_stats_add(&(devpriv->stats.framing_ns), shake_stats_ns(t1 - t0) - (io1 - io0));
+			shake_stats_add(&(devpriv->stats.decoding_ns), shake_stats_ns(shake_time_now() - t1) - (devpriv->stats.io_wait_ns - io1));
+		}
+	}
+
+	if(devpriv->samples_pending)
+		shake_wake_sample_waiters(devpriv);
+}
+
+// drops the devices being closed, must be called with r->lock held
+static void shake_reactor_remove_detached(shake_reactor_thread* r) {
+	int i = 0;
+
+	while(i < r->num_devices) {
+		shake_device_private* devpriv = r->devices[i];
+		if(!devpriv->reactor_detach) {
+			i++;
+			continue;
+		}
+
+		epoll_ctl(r->epfd, EPOLL_CTL_DEL, shake_reactor_fd(devpriv), NULL);
+		r->devices[i] = r->devices[--r->num_devices];
+		shake_atomic_store_release(&(devpriv->reactor_detached), TRUE);
+	}
+}
+
+/*	calls shake_command_tick() for each device, returning TRUE if any of them still have commands 
+*	in flight. Only the reactor thread itself removes devices, so they can't go away meanwhile */
+static BOOL shake_reactor_tick(shake_reactor_thread* r) {
+	shake_device_private* devpriv;
+	BOOL busy = FALSE;
+	int i;
+
+	// the lock isn't held during the tick, since it may call the command callbacks
+	for(i=0;;i++) {
+		pthread_mutex_lock(&(r->lock));
+		devpriv = i < r->num_devices ? r->devices[i] : NULL;
+		pthread_mutex_unlock(&(r->lock));
+		if(devpriv == NULL)
+			break;
+		if(!devpriv->reactor_detach && shake_command_tick(devpriv))
+			busy = TRUE;
+	}
+	return busy;
+}
+
+static void* shake_reactor_thread_func(void* param) {
+	shake_reactor_thread* r = (shake_reactor_thread*)param;
+	struct epoll_event events[SHAKE_REACTOR_MAX_EVENTS];
+	int i, count;
+	BOOL woken, ticking = FALSE;
+	double next_tick = 0;
+
+	if(r->cpu >= 0) {
+		cpu_set_t cpus;
+		CPU_ZERO(&cpus);
+		CPU_SET(r->cpu, &cpus);
+		pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+	}
+
+	while(!r->done) {
+		count = epoll_wait(r->epfd, events, SHAKE_REACTOR_MAX_EVENTS, ticking ? SHAKE_COMMAND_TICK_MS : -1);
+
+		woken = FALSE;
+		for(i=0;i<count;i++) {
+			shake_device_private* devpriv = (shake_device_private*)events[i].data.ptr;
+
+			if(devpriv == NULL) {
+				woken = TRUE;
+				continue;
+			}
+			if(devpriv->reactor_detach)
+				continue;
+
+			shake_reactor_service(devpriv);
+
+			// the other end has gone away and everything it sent has been parsed. Stop watching 
+			// the port, otherwise epoll would keep reporting it
+			if(events[i].events & (EPOLLHUP | EPOLLERR))
+				epoll_ctl(r->epfd, EPOLL_CTL_DEL, shake_reactor_fd(devpriv), NULL);
+		}
+
+		// devices are only dropped between batches of events, so none of the events above can 
+		// refer to a device that has already been freed
+		if(woken) {
+			shake_reactor_drain(r->wakefd);
+			pthread_mutex_lock(&(r->lock));
+			shake_reactor_remove_detached(r);
+			pthread_mutex_unlock(&(r->lock));
+			ticking = TRUE;
+		}
+
+		// while commands are in flight, look for ones that have timed out every SHAKE_COMMAND_TICK_MS
+		if(ticking && shake_time_now() >= next_tick) {
+			next_tick = shake_time_now() + (SHAKE_COMMAND_TICK_MS / 1000.0);
+			ticking = shake_reactor_tick(r);
+		}
+	}
+	return NULL;
+}
+
+static void* shake_reactor_callback_thread(void* param) {
+	shake_reactor_thread* r = (shake_reactor_thread*)param;
+	shake_device_private* devpriv;
+
+	pthread_mutex_lock(&(r->lock));
+	while(1) {
+		while(r->num_events == 0 && !r->done)
+			pthread_cond_wait(&(r->cond), &(r->lock));
+		if(r->done)
+			break;
+
+		devpriv = r->events[r->event_head];
+		r->event_head = (r->event_head + 1) % r->max_devices;
+		r->num_events--;
+		devpriv->event_queued = FALSE;
+		r->dispatching = devpriv;
+		pthread_mutex_unlock(&(r->lock));
+
+		shake_event_dispatch(devpriv);
+
+		pthread_mutex_lock(&(r->lock));
+		r->dispatching = NULL;
+		pthread_cond_broadcast(&(r->cond));
+	}
+	pthread_mutex_unlock(&(r->lock));
+	return NULL;
+}
+
+// tells reactor <r> to finish, and waits for its I/O thread and (if <cbthread> is TRUE) its callback thread to exit
+static void shake_reactor_join(shake_reactor_thread* r, BOOL cbthread) {
+	pthread_mutex_lock(&(r->lock));
+	r->done = TRUE;
+	pthread_cond_broadcast(&(r->cond));
+	pthread_mutex_unlock(&(r->lock));
+	shake_reactor_poke(r->wakefd);
+
+	pthread_join(r->thread, NULL);
+	if(cbthread)
+		pthread_join(r->cbthread, NULL);
+}
+
+// frees everything belonging to reactor <r> once its threads have exited
+static void shake_reactor_close(shake_reactor_thread* r) {
+	close(r->epfd);
+	close(r->wakefd);
+	pthread_mutex_destroy(&(r->lock));
+	pthread_cond_destroy(&(r->cond));
+	free(r->devices);
+	free(r->events);
+}
+
+// sets up reactor <r> and starts its threads. On failure, whatever was set up is undone again
+static int shake_reactor_open(shake_reactor_thread* r, int cpu) {
+	struct epoll_event ev;
+
+	r->epfd = epoll_create1(EPOLL_CLOEXEC);
+	if(r->epfd == -1)
+		return SHAKE_ERROR;
+	r->wakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if(r->wakefd == -1) {
+		close(r->epfd);
+		return SHAKE_ERROR;
+	}
+	r->cpu = cpu;
+	pthread_mutex_init(&(r->lock), NULL);
+	pthread_cond_init(&(r->cond), NULL);
+
+	// a NULL pointer marks the wakeup event
+	ev.events = EPOLLIN;
+	ev.data.ptr = NULL;
+	if(epoll_ctl(r->epfd, EPOLL_CTL_ADD, r->wakefd, &ev) != 0) {
+		shake_reactor_close(r);
+		return SHAKE_ERROR;
+	}
+
+	if(pthread_create(&(r->thread), NULL, shake_reactor_thread_func, r) != 0) {
+		shake_reactor_close(r);
+		return SHAKE_ERROR;
+	}
+	if(pthread_create(&(r->cbthread), NULL, shake_reactor_callback_thread, r) != 0) {
+		shake_reactor_join(r, FALSE);
+		shake_reactor_close(r);
+		return SHAKE_ERROR;
+	}
+	return SHAKE_SUCCESS;
+}
+
+SHAKE_API int shake_reactor_start(int num_threads, int pin_threads) {
+	int i, ncpus;
+
+	if(num_threads < 1)
+		return SHAKE_ERROR;
+
+	pthread_mutex_lock(&reactors_lock);
+	if(reactors != NULL) {
+		pthread_mutex_unlock(&reactors_lock);
+		return SHAKE_ERROR;
+	}
+
+	ncpus = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	reactors = (shake_reactor_thread*)calloc(num_threads, sizeof(shake_reactor_thread));
+	if(reactors == NULL) {
+		pthread_mutex_unlock(&reactors_lock);
+		return SHAKE_ERROR;
+	}
+	for(i=0;i<num_threads;i++) {
+		if(shake_reactor_open(&(reactors[i]), (pin_threads && ncpus > 0) ? (i % ncpus) : -1) == SHAKE_ERROR) {
+			// stop the ones already running
+			while(--i >= 0) {
+				shake_reactor_join(&(reactors[i]), TRUE);
+				shake_reactor_close(&(reactors[i]));
+			}
+			free(reactors);
+			reactors = NULL;
+			pthread_mutex_unlock(&reactors_lock);
+			return SHAKE_ERROR;
+		}
+	}
+	num_reactors = num_threads;
+	pthread_mutex_unlock(&reactors_lock);
+	return SHAKE_SUCCESS;
+}
+
+SHAKE_API int shake_reactor_stop() {
+	int i;
+
+	pthread_mutex_lock(&reactors_lock);
+	if(reactors == NULL) {
+		pthread_mutex_unlock(&reactors_lock);
+		return SHAKE_ERROR;
+	}
+	for(i=0;i<num_reactors;i++) {
+		if(reactors[i].num_devices > 0) {
+			pthread_mutex_unlock(&reactors_lock);
+			return SHAKE_ERROR;
+		}
+	}
+
+	for(i=0;i<num_reactors;i++) {
+		shake_reactor_join(&(reactors[i]), TRUE);
+		shake_reactor_close(&(reactors[i]));
+	}
+	free(reactors);
+	reactors = NULL;
+	num_reactors = 0;
+	pthread_mutex_unlock(&reactors_lock);
+	return SHAKE_SUCCESS;
+}
+
+int shake_reactor_attach(shake_device_private* devpriv) {
+	shake_reactor_thread* r;
+	struct epoll_event ev;
+	struct termios saved;
+	BOOL restore = FALSE;
+	int i, fd;
+
+	fd = shake_reactor_fd(devpriv);
+	if(fd == -1)
+		return SHAKE_ERROR;
+
+	pthread_mutex_lock(&reactors_lock);
+	if(reactors == NULL) {
+		pthread_mutex_unlock(&reactors_lock);
+		return SHAKE_ERROR;
+	}
+
+	r = &(reactors[0]);
+	for(i=1;i<num_reactors;i++) {
+		if(reactors[i].num_devices < r->num_devices)
+			r = &(reactors[i]);
+	}
+
+	pthread_mutex_lock(&(r->lock));
+	if(r->num_devices == r->max_devices) {
+		// the event ring is resized along with the device list, so it can always hold every device
+		int newmax = r->max_devices ? r->max_devices * 2 : 16;
+		shake_device_private** events = (shake_device_private**)malloc(newmax * sizeof(shake_device_private*));
+		shake_device_private** devices = events ? (shake_device_private**)realloc(r->devices, newmax * sizeof(shake_device_private*)) : NULL;
+		if(devices == NULL) {
+			free(events);
+			pthread_mutex_unlock(&(r->lock));
+			pthread_mutex_unlock(&reactors_lock);
+			return SHAKE_ERROR;
+		}
+		for(i=0;i<r->num_events;i++)
+			events[i] = r->events[(r->event_head + i) % r->max_devices];
+		free(r->events);
+		r->events = events;
+		r->event_head = 0;
+		r->devices = devices;
+		r->max_devices = newmax;
+	}
+	r->devices[r->num_devices++] = devpriv;
+	devpriv->reactor = r;
+	pthread_mutex_unlock(&(r->lock));
+	pthread_mutex_unlock(&reactors_lock);
+
+	// USB serial ports and sockets are already non-blocking. The reactor has to hear about every
+	// byte, since it never goes back to look at a port that epoll hasn't reported, so undo the 
+	// SHAKE_USB_VMIN setting
+	if(devpriv->port.comms_type == SHAKE_CONN_USB_SERIAL) {
+		struct termios opt;
+		if(tcgetattr(fd, &opt) == 0) {
+			saved = opt;
+			restore = TRUE;
+			opt.c_cc[VMIN] = 1;
+			tcsetattr(fd, TCSANOW, &opt);
+		}
+	}
+
+	// the thread objects are still needed for ACKs and the like, but not the threads themselves
+	shake_thread_init(&(devpriv->thread), NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+	ev.events = EPOLLIN;
+	ev.data.ptr = devpriv;
+	if(epoll_ctl(r->epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+		// the reactor would never hear from the device, so give it back to be run by its own threads
+		pthread_mutex_lock(&(r->lock));
+		for(i=0;r->devices[i]!=devpriv;i++)
+			;
+		r->devices[i] = r->devices[--r->num_devices];
+		devpriv->reactor = NULL;
+		pthread_mutex_unlock(&(r->lock));
+		if(restore)
+			tcsetattr(fd, TCSANOW, &saved);
+		return SHAKE_ERROR;
+	}
+	return SHAKE_SUCCESS;
+}
+
+int shake_reactor_detach(shake_device_private* devpriv) {
+	shake_reactor_thread* r = devpriv->reactor;
+	int i, j;
+
+	// both threads have to finish with the device below, so neither can be the one calling this
+	if(pthread_equal(pthread_self(), r->thread) || pthread_equal(pthread_self(), r->cbthread))
+		return SHAKE_ERROR;
+
+	pthread_mutex_lock(&(r->lock));
+	devpriv->reactor_detach = TRUE;
+
+	// forget any event still waiting for the callback, and wait for a callback in progress to return
+	for(i=0, j=0;i<r->num_events;i++) {
+		shake_device_private* queued = r->events[(r->event_head + i) % r->max_devices];
+		if(queued != devpriv)
+			r->events[(r->event_head + j++) % r->max_devices] = queued;
+	}
+	r->num_events = j;
+	while(r->dispatching == devpriv)
+		pthread_cond_wait(&(r->cond), &(r->lock));
+	pthread_mutex_unlock(&(r->lock));
+
+	// the reactor thread drops the device itself, once it's finished with the events it already has
+	shake_reactor_poke(r->wakefd);
+	while(!shake_atomic_load_acquire(&(devpriv->reactor_detached)))
+		shake_sleep(1);
+	return SHAKE_SUCCESS;
+}
+
+void shake_reactor_wake(shake_device_private* devpriv) {
+	shake_reactor_poke(devpriv->reactor->wakefd);
+}
+
+void shake_reactor_signal_event(shake_device_private* devpriv) {
+	shake_reactor_thread* r = devpriv->reactor;
+
+	pthread_mutex_lock(&(r->lock));
+	if(!devpriv->event_queued && !devpriv->reactor_detach) {
+		r->events[(r->event_head + r->num_events) % r->max_devices] = devpriv;
+		r->num_events++;
+		devpriv->event_queued = TRUE;
+		pthread_cond_signal(&(r->cond));
+	}
+	pthread_mutex_unlock(&(r->lock));
+}
+
+#else
+
+SHAKE_API int shake_reactor_start(int /*num_threads*/, int /*pin_threads*/) {
+	return SHAKE_ERROR;
+}
+
+SHAKE_API int shake_reactor_stop() {
+	return SHAKE_ERROR;
+}
+
+int shake_reactor_attach(shake_device_private* /*devpriv*/) {
+	return SHAKE_ERROR;
+}
+
+int shake_reactor_detach(shake_device_private* /*devpriv*/) {
+	return SHAKE_ERROR;
+}
+
+void shake_reactor_wake(shake_device_private* /*devpriv*/) {
+}
+
+void shake_reactor_signal_event(shake_device_private* /*devpriv*/) {
+}
+
+#endif /* SHAKE_REACTOR_SUPPORTED */
@@ -0,0 +1,273 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+
+#include "shake_replay.h"
+#include "shake_event.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* longest a reader thread waits in one go after the end of the recording, in case a wakeup is missed */
+#define SHAKE_REPLAY_IDLE_WAIT 1000
+
+static BOOL shake_map_file(shake_replay* replay, char* filename) {
+#ifdef _WIN32
+	LARGE_INTEGER size;
+
+	replay->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if(replay->file == INVALID_HANDLE_VALUE)
+		return FALSE;
+	GetFileSizeEx(replay->file, &size);
+	replay->size = size.QuadPart;
+	replay->mapping = NULL;
+	replay->data = NULL;
+	if(replay->size == 0)
+		return TRUE;
+
+	replay->mapping = CreateFileMapping(replay->file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if(replay->mapping != NULL)
+		replay->data = (char*)MapViewOfFile(replay->mapping, FILE_MAP_READ, 0, 0, 0);
+	if(replay->data == NULL) {
+		if(replay->mapping != NULL)
+			CloseHandle(replay->mapping);
+		CloseHandle(replay->file);
+		return FALSE;
+	}
+	return TRUE;
+#else
+	struct stat st;
+	int fd;
+
+	fd = open(filename, O_RDONLY);
+	if(fd == -1)
+		return FALSE;
+	if(fstat(fd, &st) == -1) {
+		close(fd);
+		return FALSE;
+	}
+
+	replay->size = st.st_size;
+	replay->data = NULL;
+	if(replay->size > 0) {
+		void* data = mmap(NULL, replay->size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(data == MAP_FAILED) {
+			close(fd);
+			return FALSE;
+		}
+		madvise(data, replay->size, MADV_SEQUENTIAL);
+		replay->data = (char*)data;
+	}
+	close(fd);
+	return TRUE;
+#endif
+}
+
+shake_replay* shake_open_replay(shake_replay* replay, char* filename, int device_type, int mode, float speed) {
+	shake_capture_header* hdr;
+	shake_capture_chunk chunk;
+	SHAKE_INT64 pos;
+
+	if(mode < SHAKE_REPLAY_UNTHROTTLED || mode > SHAKE_REPLAY_SPEED)
+		return NULL;
+	if(mode == SHAKE_REPLAY_SPEED && speed <= 0.0)
+		return NULL;
+
+	memset(replay, 0, sizeof(shake_replay));
+	if(!shake_map_file(replay, filename))
+		return NULL;
+
+	replay->mode = mode;
+	replay->speed = (mode == SHAKE_REPLAY_SPEED) ? speed : 1.0;
+	// 10 bits per byte on the serial link
+	replay->byte_rate = ((device_type == SHAKE_SK7) ? 460800 : 115200) / 10.0;
+
+	hdr = (shake_capture_header*)replay->data;
+	if(replay->size >= (SHAKE_INT64)sizeof(shake_capture_header) && memcmp(hdr->magic, SHAKE_CAPTURE_MAGIC, 8) == 0) {
+		if(hdr->version != SHAKE_CAPTURE_VERSION) {
+			shake_close_replay(replay);
+			return NULL;
+		}
+		replay->timestamped = TRUE;
+		replay->pos = sizeof(shake_capture_header);
+		// pacing is relative to the first chunk of data received from the device
+		for(pos = replay->pos; pos + (SHAKE_INT64)sizeof(shake_capture_chunk) <= replay->size; pos += sizeof(shake_capture_chunk) + chunk.length) {
+			memcpy(&chunk, replay->data + pos, sizeof(shake_capture_chunk));
+			if(!(chunk.flags & SHAKE_CAPTURE_SENT)) {
+				replay->first_time_us = chunk.time_us;
+				break;
+			}
+		}
+	}
+	return replay;
+}
+
+int shake_close_replay(shake_replay* replay) {
+#ifdef _WIN32
+	if(replay->data != NULL) {
+		UnmapViewOfFile(replay->data);
+		CloseHandle(replay->mapping);
+	}
+	CloseHandle(replay->file);
+#else
+	if(replay->data != NULL)
+		munmap(replay->data, replay->size);
+#endif
+	replay->data = NULL;
+	replay->size = 0;
+	return 1;
+}
+
+int shake_wake_replay(shake_device_private* devpriv) {
+	devpriv->port.replay.stop = 1;
+	shake_thread_wake_word(&(devpriv->thread), &(devpriv->port.replay.stop), 1);
+	return 1;
+}
+
+/*	moves on to the next chunk of data received from the device in a capture file, returning FALSE 
+*	at the end of the file. A chunk cut short by the end of the file is replayed as far as it goes.
+*	Chunk headers follow data of any length, so they're copied out rather than read in place, where
+*	time_us would usually be misaligned */
+static BOOL shake_replay_next_chunk(shake_replay* replay) {
+	shake_capture_chunk chunk;
+
+	do {
+		if(replay->pos + (SHAKE_INT64)sizeof(shake_capture_chunk) > replay->size)
+			return FALSE;
+
+		memcpy(&chunk, replay->data + replay->pos, sizeof(shake_capture_chunk));
+		replay->pos += sizeof(shake_capture_chunk);
+		if(chunk.flags & SHAKE_CAPTURE_SENT)
+			replay->pos += chunk.length;
+	} while(chunk.flags & SHAKE_CAPTURE_SENT);
+
+	replay->chunk_left = chunk.length;
+	if(replay->chunk_left > replay->size - replay->pos)
+		replay->chunk_left = replay->size - replay->pos;
+	replay->chunk_due = replay->start + ((chunk.time_us - replay->first_time_us) / 1000000.0) / replay->speed;
+	return TRUE;
+}
+
+/*	returns how many bytes from the current position can be read at host time <now>, up to <max>,
+*	or -1 at the end of the file. If none can be read yet, *<due> is set to the time the next one can */
+static SHAKE_INT64 shake_replay_available(shake_replay* replay, double now, SHAKE_INT64 max, double* due) {
+	SHAKE_INT64 available;
+
+	if(replay->timestamped) {
+		while(replay->chunk_left == 0) {
+			if(!shake_replay_next_chunk(replay))
+				return -1;
+		}
+		if(replay->mode != SHAKE_REPLAY_UNTHROTTLED && now < replay->chunk_due) {
+			*due = replay->chunk_due;
+			return 0;
+		}
+		available = replay->chunk_left;
+	} else {
+		available = replay->size - replay->pos;
+		if(available == 0)
+			return -1;
+		// plain files are released a byte at a time at the rate of the serial link
+		if(replay->mode != SHAKE_REPLAY_UNTHROTTLED) {
+			double rate = replay->byte_rate * replay->speed;
+			SHAKE_INT64 released = (SHAKE_INT64)((now - replay->start) * rate) - replay->delivered;
+			if(released <= 0) {
+				*due = replay->start + (replay->delivered + 1) / rate;
+				return 0;
+			}
+			if(available > released)
+				available = released;
+		}
+	}
+
+	if(available > max)
+		available = max;
+	return available;
+}
+
+int read_replay_bytes(shake_device_private* devpriv, char* buf, int bytes_to_read) {
+	shake_replay* replay = &(devpriv->port.replay);
+	shake_input_buffer* in = &(devpriv->input);
+	SHAKE_INT64 available;
+	double now, due;
+	int bytes_read = 0, ms;
+
+	now = shake_time_now();
+	due = now;
+	if(replay->start == 0)
+		replay->start = now;
+
+	while(!replay->stop && !replay->eof) {
+		available = shake_replay_available(replay, now, bytes_to_read - bytes_read, &due);
+		if(available < 0) {
+			replay->eof = TRUE;
+			replay->eof_head = in->head - 1;
+			break;
+		}
+
+		if(available > 0) {
+			memcpy(buf + bytes_read, replay->data + replay->pos, (size_t)available);
+			replay->pos += available;
+			replay->delivered += available;
+			if(replay->timestamped)
+				replay->chunk_left -= available;
+			bytes_read += (int)available;
+			if(bytes_read == bytes_to_read)
+				break;
+			continue;
+		}
+
+		// nothing due yet, so return what there is or wait for the next byte to become due
+		if(bytes_read > 0)
+			break;
+		ms = (int)((due - now) * 1000) + 1;
+		shake_thread_wait_word(&(devpriv->thread), &(replay->stop), 0, ms);
+		now = shake_time_now();
+	}
+
+	if(bytes_read > 0 || replay->stop) {
+		devpriv->data_recv += bytes_read;
+		return bytes_read;
+	}
+
+	/*	at the end of the file. Keep returning straight away while the parser is still working 
+	*	through the data it has buffered, but once it stops making progress (the buffer is empty, 
+	*	or only holds the start of a packet that will never be completed) the replay is over */
+	if(in->head != in->tail && in->head != replay->eof_head) {
+		replay->eof_head = in->head;
+		return 0;
+	}
+
+	if(!replay->complete) {
+		replay->complete = TRUE;
+		if(shake_event_wanted(devpriv)) {
+			shake_event_post(devpriv, SHAKE_REPLAY_COMPLETE);
+		}
+	}
+
+	// nothing more will ever arrive, so wait to be shut down
+	shake_thread_wait_word(&(devpriv->thread), &(replay->stop), 0, SHAKE_REPLAY_IDLE_WAIT);
+	return 0;
+}
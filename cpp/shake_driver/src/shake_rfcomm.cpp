@@ -1,247 +1,380 @@
-/*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-
-#define SHAKE_RFCOMM_SUPPORTED 1
-
-#include "shake_rfcomm.h"
-
-#include <math.h>
-#include <ctype.h>
-
-static BOOL wsa_initialised = FALSE;
-static int rfcomm_socket_count = 0;
-
-static long long btaddr_string2int64(char* str) {
-	long long btaddr = 0;
-
-	if(strncmp("0x", str, 2) == 0)
-		str = str+2;
-
-	int len = strlen(str);
-	int pos = 0, i;
-	for(i=len-1;i>=0;i--) {
-		int c = tolower(str[i]);
-
-		if(c >= '0' && c <= '9') {
-			btaddr += (c - '0') * (pow(16.0, pos));
-			pos++;
-		} else if(c >= 'a' && c <= 'f') {
-			btaddr += (10 + (c - 'a')) * (pow(16.0, pos));
-			pos++;
-		} 
-	}
-
-	//printf("Converted %s to %lld, pos %d\n", str, btaddr, pos);
-	return btaddr;
-}
-
-#ifndef _WIN32
-static bdaddr_t btaddr_i64tobdaddr_t(long long addr) {
-	int i=0;
-	bdaddr_t ba;
-
-	long long mask = 0xFF;
-	for(i=0;i<6;i++) {
-		ba.b[i] = (addr & mask) >> (8*i);
-		mask <<= 8;
-	}
-	return ba;
-}
-#endif
-
-shake_rfcomm_socket* shake_open_rfcomm_i64(shake_rfcomm_socket* port, long long btaddr) {
-#ifdef _WIN32
-	if(!wsa_initialised) {
-		WORD wVersionRequested;
-		WSADATA wsaData;
-		wVersionRequested = MAKEWORD( 2, 0 );
-		WSAStartup( wVersionRequested, &wsaData );
-		wsa_initialised = TRUE;
-	}
-
-	port->sock = socket (AF_BTH, SOCK_STREAM, BTHPROTO_RFCOMM);
-	if(port->sock == INVALID_SOCKET) {
-		WSACleanup();
-		port->sock = INVALID_SOCKET;
-		return NULL;
-	}
-
-	memset(&(port->addr), 0, sizeof(SOCKADDR_BTH));
-	port->addr.addressFamily = AF_BTH;
-	port->addr.port = 1; // always 1 for the SHAKE I think
-	port->addr.btAddr = btaddr;
-
-	if (connect (port->sock, (SOCKADDR *)&(port->addr), sizeof(SOCKADDR_BTH)) == SOCKET_ERROR) {
-		closesocket(port->sock);
-		WSACleanup();
-		port->sock = INVALID_SOCKET;
-		return NULL;
-	}
-
-	rfcomm_socket_count++;
-	
-	return port;
-#else
-	struct sockaddr_rc addr;
-	int status;
-
-	port->sock = socket(AF_BLUETOOTH, SOCK_STREAM, BTPROTO_RFCOMM);
-	if(port->sock == -1)
-		return NULL;
-
-	addr.rc_family = AF_BLUETOOTH;
-	addr.rc_channel = (uint8_t) 1;
-	addr.rc_bdaddr = btaddr_i64tobdaddr_t(btaddr);
-
-	status = connect(port->sock, (struct sockaddr*)&addr, sizeof(addr));
-	if(status == -1) {
-		close(port->sock);
-		return NULL;
-	}
-
-	return port;
-#endif
-}
-
-shake_rfcomm_socket* shake_open_rfcomm_str(shake_rfcomm_socket* port, char* btaddr) {
-	return shake_open_rfcomm_i64(port, btaddr_string2int64(btaddr));
-}
-
-
-int shake_close_rfcomm(shake_rfcomm_socket* port) {
-#ifdef _WIN32
-	if(port == NULL)
-		return 0;
-
-	closesocket(port->sock);
-	rfcomm_socket_count--;
-	if(rfcomm_socket_count == 0) 
-		WSACleanup();
-
-	return 1;
-#else
-	close(port->sock);
-	return 1;
-#endif
-}
-	
-int read_rfcomm_bytes(shake_device_private* devpriv, char* buf, int bytes_to_read) {
-	#ifdef SHAKE_RFCOMM_SUPPORTED
-	DWORD bytes_read = 0;
-	int sleepcounter = 0;
-	int remaining_bytes = bytes_to_read;
-
-	while(1) {
-		int len = recv(devpriv->port.rfcomm.sock, buf+bytes_read, remaining_bytes, 0);
-		if(len == SOCKET_ERROR) {
-			break;
-		}
-		bytes_read += len;
-		remaining_bytes -= len;
-
-		if(remaining_bytes == 0)
-			break;
-		
-		/* check if the thread is exiting, and if so break out of the loop and return */
-		if(devpriv->rthread_done)
-			break;
-
-		/* otherwise just loop back round and read the port again */
-		++sleepcounter;
-		if(sleepcounter > 10) {
-			shake_sleep(1);
-			sleepcounter = 0;
-		}
-		continue;
-	}
-
-	devpriv->data_recv += (bytes_read - remaining_bytes);
-	return bytes_to_read - remaining_bytes;
-	#else
-	return 0;
-	#endif
-}
-
-int write_rfcomm_bytes(shake_device_private* devpriv, char* buf, int bytes_to_write) {
-	#ifdef SHAKE_RFCOMM_SUPPORTED
-	DWORD bytes_written = 0;
-	int remaining_bytes = bytes_to_write;
-
-	while(1) {
-		int len = send(devpriv->port.rfcomm.sock, buf+bytes_written, remaining_bytes, 0);
-
-		if(len == SOCKET_ERROR) {
-
-			break;
-		}
-
-		/* subtract the bytes we just wrote from the total amount we want */
-		remaining_bytes -= len;
-		bytes_written += len;
-
-		/* if we didn't get them all.. */
-		if(remaining_bytes != 0) {
-			/* loop back round and write the port again */
-			continue;
-		} else
-			/* if all bytes have been written, break out of loop and return */
-			break;
-	}
-
-	return bytes_to_write - remaining_bytes;
-	#else
-	return 0;
-	#endif
-}
-
-int write_rfcomm_bytes_delayed(shake_device_private* devpriv, char* buf, int bytes_to_write, int chunk_size, int delay_ms) {
-	#ifdef SHAKE_RFCOMM_SUPPORTED
-	DWORD bytes_written = 0;
-	int remaining_bytes = bytes_to_write;
-
-	while(1) {
-		int current_remaining_bytes = remaining_bytes;// ((chunk_size >= remaining_bytes) ? chunk_size : remaining_bytes);
-		if(remaining_bytes > chunk_size)
-			current_remaining_bytes = chunk_size;
-		int len = send(devpriv->port.rfcomm.sock, buf+bytes_written, current_remaining_bytes, 0);
-
-		if(len == SOCKET_ERROR) {
-			break;
-		}
-
-		/* subtract the bytes we just wrote from the total amount we want */
-		remaining_bytes -= len;
-		bytes_written += len;
-
-		shake_sleep(delay_ms);
-
-		/* if we didn't get them all.. */
-		if(remaining_bytes != 0) {
-			/* loop back round and write the port again */
-			continue;
-		} else
-			/* if all bytes have been written, break out of loop and return */
-			break;
-	}
-
-	return bytes_to_write - remaining_bytes;
-	#else
-	return 0;
-	#endif
-}
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#define SHAKE_RFCOMM_SUPPORTED 1
+
+#include "shake_rfcomm.h"
+
+#include <math.h>
+#include <ctype.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#endif
+#include "shake_thread.h"
+#include "shake_io.h"
+
+static BOOL wsa_initialised = FALSE;
+static int rfcomm_socket_count = 0;
+
+static long long btaddr_string2int64(char* str) {
+	long long btaddr = 0;
+
+	if(strncmp("0x", str, 2) == 0)
+		str = str+2;
+
+	int len = strlen(str);
+	int pos = 0, i;
+	for(i=len-1;i>=0;i--) {
+		int c = tolower(str[i]);
+
+		if(c >= '0' && c <= '9') {
+			btaddr += (c - '0') * (pow(16.0, pos));
+			pos++;
+		} else if(c >= 'a' && c <= 'f') {
+			btaddr += (10 + (c - 'a')) * (pow(16.0, pos));
+			pos++;
+		} 
+	}
+
+	//printf("Converted %s to %lld, pos %d\n", str, btaddr, pos);
+	return btaddr;
+}
+
+#ifndef _WIN32
+static bdaddr_t btaddr_i64tobdaddr_t(long long addr) {
+	int i=0;
+	bdaddr_t ba;
+
+	long long mask = 0xFF;
+	for(i=0;i<6;i++) {
+		ba.b[i] = (addr & mask) >> (8*i);
+		mask <<= 8;
+	}
+	return ba;
+}
+#endif
+
+#ifndef _WIN32
+/*	switches a connected socket to non-blocking mode and creates its wakeup pipe. On failure the 
+*	socket is closed and NULL is returned */
+static shake_rfcomm_socket* shake_rfcomm_setup(shake_rfcomm_socket* port) {
+	port->wakefd[0] = port->wakefd[1] = -1;
+	if(fcntl(port->sock, F_SETFL, fcntl(port->sock, F_GETFL) | O_NONBLOCK) == -1 || pipe(port->wakefd) == -1) {
+		close(port->sock);
+		return NULL;
+	}
+	fcntl(port->wakefd[0], F_SETFL, O_NONBLOCK);
+	fcntl(port->wakefd[1], F_SETFL, O_NONBLOCK);
+	return port;
+}
+#endif
+
+shake_rfcomm_socket* shake_open_rfcomm_i64(shake_rfcomm_socket* port, long long btaddr) {
+#ifdef _WIN32
+	if(!wsa_initialised) {
+		WORD wVersionRequested;
+		WSADATA wsaData;
+		wVersionRequested = MAKEWORD( 2, 0 );
+		WSAStartup( wVersionRequested, &wsaData );
+		wsa_initialised = TRUE;
+	}
+
+	port->sock = socket (AF_BTH, SOCK_STREAM, BTHPROTO_RFCOMM);
+	if(port->sock == INVALID_SOCKET) {
+		WSACleanup();
+		port->sock = INVALID_SOCKET;
+		return NULL;
+	}
+
+	memset(&(port->addr), 0, sizeof(SOCKADDR_BTH));
+	port->addr.addressFamily = AF_BTH;
+	port->addr.port = 1; // always 1 for the SHAKE I think
+	port->addr.btAddr = btaddr;
+
+	if (connect (port->sock, (SOCKADDR *)&(port->addr), sizeof(SOCKADDR_BTH)) == SOCKET_ERROR) {
+		closesocket(port->sock);
+		WSACleanup();
+		port->sock = INVALID_SOCKET;
+		return NULL;
+	}
+
+	rfcomm_socket_count++;
+	
+	return port;
+#else
+	struct sockaddr_rc addr;
+	int status;
+
+	port->sock = socket(AF_BLUETOOTH, SOCK_STREAM, BTPROTO_RFCOMM);
+	if(port->sock == -1)
+		return NULL;
+
+	addr.rc_family = AF_BLUETOOTH;
+	addr.rc_channel = (uint8_t) 1;
+	addr.rc_bdaddr = btaddr_i64tobdaddr_t(btaddr);
+
+	status = connect(port->sock, (struct sockaddr*)&addr, sizeof(addr));
+	if(status == -1) {
+		close(port->sock);
+		return NULL;
+	}
+
+	return shake_rfcomm_setup(port);
+#endif
+}
+
+shake_rfcomm_socket* shake_open_rfcomm_str(shake_rfcomm_socket* port, char* btaddr) {
+	return shake_open_rfcomm_i64(port, btaddr_string2int64(btaddr));
+}
+
+
+shake_rfcomm_socket* shake_open_rfcomm_socket(shake_rfcomm_socket* port, int sock) {
+#ifdef _WIN32
+	return NULL;
+#else
+	if(sock < 0)
+		return NULL;
+	port->sock = sock;
+	return shake_rfcomm_setup(port);
+#endif
+}
+
+int shake_set_rfcomm_rcvbuf(shake_rfcomm_socket* port, int bytes) {
+	if(setsockopt(port->sock, SOL_SOCKET, SO_RCVBUF, (char*)&bytes, sizeof(bytes)) == SOCKET_ERROR)
+		return 0;
+	return 1;
+}
+
+int shake_wake_rfcomm(shake_rfcomm_socket* port) {
+#ifndef _WIN32
+	char c = 0;
+	ssize_t ret;
+
+	if(port->wakefd[1] == -1)
+		return 1;
+	while((ret = write(port->wakefd[1], &c, 1)) == -1 && errno == EINTR)
+		;
+	// EAGAIN means the pipe is full of earlier wakeups, so the reader will see it anyway
+	if(ret == -1 && errno != EAGAIN && errno != EWOULDBLOCK)
+		return 0;
+#endif
+	return 1;
+}
+
+int shake_close_rfcomm(shake_rfcomm_socket* port) {
+#ifdef _WIN32
+	if(port == NULL)
+		return 0;
+
+	closesocket(port->sock);
+	rfcomm_socket_count--;
+	if(rfcomm_socket_count == 0) 
+		WSACleanup();
+
+	return 1;
+#else
+	if(port->wakefd[0] != -1) {
+		close(port->wakefd[0]);
+		close(port->wakefd[1]);
+		port->wakefd[0] = port->wakefd[1] = -1;
+	}
+	close(port->sock);
+	return 1;
+#endif
+}
+	
+/*	reads up to <bytes_to_read> bytes from the socket into <buf>. recv() returns as soon as
+*	any data is available, so a single call normally drains everything the stack has buffered.
+*	On Linux the socket is non-blocking and poll() is used to wait for it to become readable,
+*	for as long as it takes while the input buffer is empty, or for up to SHAKE_PARTIAL_PACKET_TIMEOUT 
+*	while part of a packet is waiting for the rest of it.
+*	Returns number of bytes read, or 0 on error or if the thread is exiting. */
+int read_rfcomm_bytes(shake_device_private* devpriv, char* buf, int bytes_to_read) {
+	#ifdef SHAKE_RFCOMM_SUPPORTED
+	int len = 0;
+	#ifndef _WIN32
+	struct pollfd fds[2];
+	double deadline = 0;
+	int timeout;
+
+	fds[0].fd = devpriv->port.rfcomm.sock;
+	fds[0].events = POLLIN;
+	fds[1].fd = devpriv->port.rfcomm.wakefd[0];
+	fds[1].events = POLLIN;
+
+	while(1) {
+		len = recv(devpriv->port.rfcomm.sock, buf, bytes_to_read, 0);
+		if(len > 0)
+			break;
+
+		/* the connection has been closed or has failed. Return, but not so often that the reader
+		*	thread spins while it waits to be shut down */
+		if(len == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+			len = 0;
+			if(!devpriv->reactor)
+				shake_sleep(1);
+			break;
+		}
+		len = 0;
+
+		/* check if the thread is exiting, and if so break out of the loop and return. A reactor 
+		*	thread only calls this when the socket is readable, so it never needs to wait either */
+		if(shake_atomic_load_acquire(&(devpriv->rthread_done)) || devpriv->reactor)
+			break;
+
+		if(devpriv->input.head != devpriv->input.tail) {
+			double now = shake_time_now();
+			if(deadline == 0)
+				deadline = now + (SHAKE_PARTIAL_PACKET_TIMEOUT / 1000.0);
+			else if(now >= deadline)
+				break;
+			timeout = (int)((deadline - now) * 1000) + 1;
+		} else {
+			timeout = -1;
+		}
+
+		if(poll(fds, 2, timeout) > 0 && fds[1].revents)
+			break;
+	}
+	#else
+	int sleepcounter = 0;
+
+	while(1) {
+		len = recv(devpriv->port.rfcomm.sock, buf, bytes_to_read, 0);
+		if(len == SOCKET_ERROR || len < 0) {
+			len = 0;
+			break;
+		}
+
+		if(len > 0)
+			break;
+		
+		/* check if the thread is exiting, and if so break out of the loop and return */
+		if(shake_atomic_load_acquire(&(devpriv->rthread_done)))
+			break;
+
+		/* otherwise just loop back round and read the port again */
+		++sleepcounter;
+		if(sleepcounter > 10) {
+			shake_sleep(1);
+			sleepcounter = 0;
+		}
+	}
+	#endif
+
+	devpriv->data_recv += len;
+	return len;
+	#else
+	return 0;
+	#endif
+}
+
+/*	called when send() fails. If that was only because the (non-blocking) socket's send buffer 
+*	is full, waits for there to be room and returns TRUE so the send can be retried */
+static BOOL rfcomm_wait_writable(shake_device_private* devpriv) {
+	#ifndef _WIN32
+	struct pollfd fds[2];
+
+	if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+		return FALSE;
+
+	fds[0].fd = devpriv->port.rfcomm.sock;
+	fds[0].events = POLLOUT;
+	fds[1].fd = devpriv->port.rfcomm.wakefd[0];
+	fds[1].events = POLLIN;
+	fds[1].revents = 0;
+	if(poll(fds, 2, -1) < 0 && errno != EINTR)
+		return FALSE;
+	return !fds[1].revents;
+	#else
+	return FALSE;
+	#endif
+}
+
+int write_rfcomm_bytes(shake_device_private* devpriv, char* buf, int bytes_to_write) {
+	#ifdef SHAKE_RFCOMM_SUPPORTED
+	DWORD bytes_written = 0;
+	int remaining_bytes = bytes_to_write;
+
+	while(1) {
+		int len = send(devpriv->port.rfcomm.sock, buf+bytes_written, remaining_bytes, 0);
+
+		if(len == SOCKET_ERROR) {
+			if(rfcomm_wait_writable(devpriv))
+				continue;
+			break;
+		}
+
+		/* subtract the bytes we just wrote from the total amount we want */
+		remaining_bytes -= len;
+		bytes_written += len;
+
+		/* if we didn't get them all.. */
+		if(remaining_bytes != 0) {
+			/* loop back round and write the port again */
+			continue;
+		} else
+			/* if all bytes have been written, break out of loop and return */
+			break;
+	}
+
+	return bytes_to_write - remaining_bytes;
+	#else
+	return 0;
+	#endif
+}
+
+int write_rfcomm_bytes_delayed(shake_device_private* devpriv, char* buf, int bytes_to_write, int chunk_size, int delay_ms) {
+	#ifdef SHAKE_RFCOMM_SUPPORTED
+	DWORD bytes_written = 0;
+	int remaining_bytes = bytes_to_write;
+
+	while(1) {
+		int current_remaining_bytes = remaining_bytes;// ((chunk_size >= remaining_bytes) ? chunk_size : remaining_bytes);
+		if(remaining_bytes > chunk_size)
+			current_remaining_bytes = chunk_size;
+		int len = send(devpriv->port.rfcomm.sock, buf+bytes_written, current_remaining_bytes, 0);
+
+		if(len == SOCKET_ERROR) {
+			if(rfcomm_wait_writable(devpriv))
+				continue;
+			break;
+		}
+
+		/* subtract the bytes we just wrote from the total amount we want */
+		remaining_bytes -= len;
+		bytes_written += len;
+
+		shake_sleep(delay_ms);
+
+		/* if we didn't get them all.. */
+		if(remaining_bytes != 0) {
+			/* loop back round and write the port again */
+			continue;
+		} else
+			/* if all bytes have been written, break out of loop and return */
+			break;
+	}
+
+	return bytes_to_write - remaining_bytes;
+	#else
+	return 0;
+	#endif
+}
@@ -1,195 +1,287 @@
-/*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#include "shake_serial_usb.h"
-
-#ifndef _WIN32
-#include <stdio.h>
-#include <string.h>
-#include <unistd.h>
-#include <fcntl.h>
-#include <termios.h>
-#endif
-
-#include "shake_platform.h"
-#include "shake_driver.h"
-
-shake_serial_port_usb* shake_open_serial_usb(shake_serial_port_usb* port, char* usb_dev, int device_type) {
-#ifndef _WIN32
-	struct termios newopt;	
-	struct termios oldopt;
-
-	port->port = open(usb_dev, O_RDWR | O_NOCTTY | O_NDELAY);
-	if(port->port == -1) {
-		return NULL;
-	}
-
-	tcgetattr(port->port, &oldopt);
-	bzero(&newopt, sizeof(newopt));
-	
-	int baudrate = (device_type == SHAKE_SK7) ? 460800 : 115200;
-
-#ifndef __APPLE__
-	newopt.c_cflag = baudrate | CRTSCTS | CS8 | CLOCAL;
-	newopt.c_iflag = 0; //IGNPAR | IGNCR | ICRNL | IGNBRK;
-	newopt.c_oflag = 0;
-	newopt.c_lflag = 0;
-
-	tcflush(port->port, TCIFLUSH);
-	tcsetattr(port->port, TCSANOW, &newopt);
-#else
-	fcntl(port->port, F_SETFL, 0);
-	tcgetattr(port->port, &oldopt);
-	cfsetispeed(&oldopt, baudrate);
-   	cfsetospeed(&oldopt, baudrate);
-  	oldopt.c_cflag |= (CLOCAL | CREAD);
-   	oldopt.c_cflag &= ~CSIZE; // Mask the character size bits 
-   	oldopt.c_cflag |= CS8;    // Select 8 data bits 
-   	oldopt.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG);
-   	tcsetattr(port->port, TCSANOW, &oldopt);
-#endif // __APPLE__
-	return port;
-#else
-	return NULL;
-#endif
-}
-
-int shake_close_serial_usb(shake_serial_port_usb* port) {
-#ifndef _WIN32
-	return close(port->port);
-#else
-	return 0;
-#endif
-}
-
-/*	utility func, reads <bytes_to_read> bytes from the port associated with <devpriv> 
-*	into <buf>, handling any timeouts that occur during this operation.
-*	Returns number of bytes read. */
-int read_serial_bytes_usb(shake_device_private* devpriv, char* buf, int bytes_to_read) {
-#ifndef _WIN32 
-	DWORD bytes_read;
-	int sleepcounter = 0;
-	int attempts = 0;
-	int remaining_bytes = bytes_to_read;
-
-	/* read the port in a loop to deal with timeouts */
-	while(1) {
-		//int res = ReadFile(devpriv->port.serial_usb.port, buf + (bytes_to_read - remaining_bytes), remaining_bytes, &bytes_read, NULL);
-		bytes_read = read(devpriv->port.serial_usb.port, buf + (bytes_to_read - remaining_bytes), remaining_bytes);
-		if(bytes_read == -1)
-			return remaining_bytes;
-
-		/* subtract the bytes we just read from the total amount we want */
-		remaining_bytes -= bytes_read;
-
-		/* if we didn't get them all.. */
-		if(remaining_bytes != 0) {
-			/* check if the thread is exiting, and if so break out of the loop and return */
-			if(devpriv->rthread_done)
-				break;
-
-			/* otherwise just loop back round and read the port again */
-			++sleepcounter;
-			if(sleepcounter > 15) {
-				shake_sleep(1);
-				attempts++;
-				sleepcounter = 0;
-
-				if(attempts > 30)
-					break;
-			}
-			continue;
-		} else
-			/* if all bytes have been read, break out of loop and return */
-			break;
-	}
-	devpriv->data_recv += (bytes_to_read - remaining_bytes);
-	return bytes_to_read - remaining_bytes;
-#else
-	return 0;
-#endif
-}
-
-/*	utility func, writes <bytes_to_write> bytes to the port associated with <devpriv>
-*	from <buf>, handling any timeouts that occur during this operation.
-*	Returns number of bytes written. */
-int write_serial_bytes_usb(shake_device_private* devpriv, char* buf, int bytes_to_write) {
-#ifndef _WIN32
-	DWORD bytes_written;
-	int remaining_bytes = bytes_to_write;
-
-	/* write the port in a loop to deal with timeouts */
-	while(1) {
-		//if(!WriteFile(devpriv->port.serial_usb.port, buf + (bytes_to_write - remaining_bytes), remaining_bytes, &bytes_written, NULL))
-		//	return bytes_to_write - remaining_bytes;
-		bytes_written = write(devpriv->port.serial_usb.port, buf + (bytes_to_write - remaining_bytes), remaining_bytes);
-		if(bytes_written == -1)
-			return remaining_bytes;
-
-		/* subtract the bytes we just wrote from the total amount we want */
-		remaining_bytes -= bytes_written;
-
-		/* if we didn't get them all.. */
-		if(remaining_bytes != 0) {
-			/* loop back round and write the port again */
-			continue;
-		} else
-			/* if all bytes have been written, break out of loop and return */
-			break;
-	}
-	return bytes_to_write - remaining_bytes;
-#else
-	return 0;
-#endif
-}
-
-int write_serial_bytes_delayed_usb(shake_device_private* devpriv, char* buf, int bytes_to_write, int chunk_size, int delay_ms) {
-#ifndef _WIN32
-	DWORD bytes_written;
-	int remaining_bytes = bytes_to_write;
-
-	/* write the port in a loop to deal with timeouts */
-	while(1) {
- 		int current_remaining_bytes = remaining_bytes;// ((chunk_size >= remaining_bytes) ? chunk_size : remaining_bytes);
-		if(remaining_bytes > chunk_size)
-			current_remaining_bytes = chunk_size;
-		//if(!WriteFile(devpriv->port.serial_usb.port, buf + (bytes_to_write - remaining_bytes), current_remaining_bytes, &bytes_written, NULL))
-		//	return bytes_to_write - remaining_bytes;
-		bytes_written = write(devpriv->port.serial_usb.port, buf + (bytes_to_write - remaining_bytes), remaining_bytes);
-		if(bytes_written == -1)
-			return remaining_bytes;
-
-		/* subtract the bytes we just wrote from the total amount we want */
-		remaining_bytes -= bytes_written;
-
-		/* delay */
-		shake_sleep(delay_ms);
-
-		/* if we didn't get them all.. */
-		if(remaining_bytes != 0) {
-			/* loop back round and write the port again */
-			continue;
-		} else
-			/* if all bytes have been written, break out of loop and return */
-			break;
-	}
-	return bytes_to_write - remaining_bytes;
-#else
-	return 0;
-#endif
-}
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "shake_serial_usb.h"
+
+#ifndef _WIN32
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <errno.h>
+#ifndef __APPLE__
+#include <poll.h>
+#endif
+#endif
+
+#include "shake_platform.h"
+#include "shake_driver.h"
+#include "shake_thread.h"
+#include "shake_io.h"
+
+shake_serial_port_usb* shake_open_serial_usb(shake_serial_port_usb* port, char* usb_dev, int device_type) {
+#ifndef _WIN32
+	struct termios newopt;	
+	struct termios oldopt;
+
+	port->port = open(usb_dev, O_RDWR | O_NOCTTY | O_NDELAY);
+	if(port->port == -1) {
+		return NULL;
+	}
+	port->wakefd[0] = port->wakefd[1] = -1;
+
+	tcgetattr(port->port, &oldopt);
+	bzero(&newopt, sizeof(newopt));
+	
+	int baudrate = (device_type == SHAKE_SK7) ? 460800 : 115200;
+
+#ifndef __APPLE__
+	newopt.c_cflag = baudrate | CRTSCTS | CS8 | CLOCAL;
+	newopt.c_iflag = 0; //IGNPAR | IGNCR | ICRNL | IGNBRK;
+	newopt.c_oflag = 0;
+	newopt.c_lflag = 0;
+	// reads never block (O_NDELAY), these only control when poll() reports the port as readable
+	newopt.c_cc[VMIN] = SHAKE_USB_VMIN;
+	newopt.c_cc[VTIME] = 0;
+
+	tcflush(port->port, TCIFLUSH);
+	tcsetattr(port->port, TCSANOW, &newopt);
+
+	if(pipe(port->wakefd) == -1) {
+		close(port->port);
+		return NULL;
+	}
+	fcntl(port->wakefd[0], F_SETFL, O_NONBLOCK);
+	fcntl(port->wakefd[1], F_SETFL, O_NONBLOCK);
+#else
+	fcntl(port->port, F_SETFL, 0);
+	tcgetattr(port->port, &oldopt);
+	cfsetispeed(&oldopt, baudrate);
+   	cfsetospeed(&oldopt, baudrate);
+  	oldopt.c_cflag |= (CLOCAL | CREAD);
+   	oldopt.c_cflag &= ~CSIZE; // Mask the character size bits 
+   	oldopt.c_cflag |= CS8;    // Select 8 data bits 
+   	oldopt.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG);
+   	tcsetattr(port->port, TCSANOW, &oldopt);
+#endif // __APPLE__
+	return port;
+#else
+	return NULL;
+#endif
+}
+
+int shake_wake_serial_usb(shake_serial_port_usb* port) {
+#ifndef _WIN32
+	char c = 0;
+	ssize_t ret;
+
+	if(port->wakefd[1] == -1)
+		return 1;
+	while((ret = write(port->wakefd[1], &c, 1)) == -1 && errno == EINTR)
+		;
+	// EAGAIN means the pipe is full of earlier wakeups, so the reader will see it anyway
+	if(ret == -1 && errno != EAGAIN && errno != EWOULDBLOCK)
+		return 0;
+#endif
+	return 1;
+}
+
+int shake_close_serial_usb(shake_serial_port_usb* port) {
+#ifndef _WIN32
+	if(port->wakefd[0] != -1) {
+		close(port->wakefd[0]);
+		close(port->wakefd[1]);
+		port->wakefd[0] = port->wakefd[1] = -1;
+	}
+	return close(port->port);
+#else
+	return 0;
+#endif
+}
+
+/*	utility func, reads up to <bytes_to_read> bytes from the port associated with <devpriv> 
+*	into <buf>, returning as soon as any data is available. While the input buffer is empty this
+*	waits for as long as it takes, otherwise part of a packet is waiting for the rest of it and 
+*	the wait is limited to SHAKE_PARTIAL_PACKET_TIMEOUT.
+*	Returns number of bytes read, or 0 if nothing arrived before the timeout (or immediately,
+*	for devices run by a reactor thread, or once the port has been woken for shutdown). */
+int read_serial_bytes_usb(shake_device_private* devpriv, char* buf, int bytes_to_read) {
+#ifndef _WIN32 
+	int bytes_read;
+#ifndef __APPLE__
+	struct pollfd fds[2];
+	double deadline = 0;
+	int timeout, ret;
+	BOOL hungup = FALSE;
+
+	fds[0].fd = devpriv->port.serial_usb.port;
+	fds[0].events = POLLIN;
+	fds[1].fd = devpriv->port.serial_usb.wakefd[0];
+	fds[1].events = POLLIN;
+
+	while(1) {
+		bytes_read = read(devpriv->port.serial_usb.port, buf, bytes_to_read);
+
+		/* return whatever is available, the caller will ask again if it needs more */
+		if(bytes_read > 0)
+			break;
+
+		/* 0 (end of file, e.g. the device was unplugged) is treated like EAGAIN, and relies on 
+		*	the timeout below. Anything else is a real error */
+		if(bytes_read < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+			bytes_read = 0;
+			break;
+		}
+		bytes_read = 0;
+
+		/* check if the thread is exiting, and if so break out of the loop and return. A reactor 
+		*	thread only calls this when the port is readable, so it never needs to wait either */
+		if(shake_atomic_load_acquire(&(devpriv->rthread_done)) || devpriv->reactor)
+			break;
+
+		/* fewer than SHAKE_USB_VMIN bytes don't make the port readable, so while the rest of a 
+		*	packet is expected look at the port every millisecond rather than waiting on it. The 
+		*	same goes for a port that has hung up, which poll() always reports straight away */
+		if(hungup || devpriv->input.head != devpriv->input.tail) {
+			if(deadline == 0)
+				deadline = shake_time_now() + (SHAKE_PARTIAL_PACKET_TIMEOUT / 1000.0);
+			else if(shake_time_now() >= deadline)
+				break;
+			timeout = 1;
+		} else {
+			timeout = -1;
+		}
+
+		ret = poll(fds, 2, timeout);
+		if(ret > 0 && fds[1].revents)
+			break;
+		hungup = (ret > 0 && (fds[0].revents & (POLLHUP | POLLERR | POLLNVAL)));
+		if(hungup)
+			shake_sleep(1);
+	}
+#else
+	int sleepcounter = 0;
+	int attempts = 0;
+
+	/* poll() doesn't support tty devices on OS X, so read the port in a loop to deal with timeouts */
+	while(1) {
+		bytes_read = read(devpriv->port.serial_usb.port, buf, bytes_to_read);
+
+		/* return whatever is available, the caller will ask again if it needs more */
+		if(bytes_read > 0)
+			break;
+
+		/* 0 means the read timed out, keep trying as for EAGAIN. Anything else is a real error */
+		if(bytes_read < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+			bytes_read = 0;
+			break;
+		}
+		bytes_read = 0;
+
+		/* check if the thread is exiting, and if so break out of the loop and return */
+		if(shake_atomic_load_acquire(&(devpriv->rthread_done)) || devpriv->reactor)
+			break;
+
+		/* otherwise just loop back round and read the port again */
+		++sleepcounter;
+		if(sleepcounter > 15) {
+			shake_sleep(1);
+			attempts++;
+			sleepcounter = 0;
+
+			if(attempts > 30)
+				break;
+		}
+	}
+#endif // __APPLE__
+	devpriv->data_recv += bytes_read;
+	return bytes_read;
+#else
+	return 0;
+#endif
+}
+
+/*	utility func, writes <bytes_to_write> bytes to the port associated with <devpriv>
+*	from <buf>, handling any timeouts that occur during this operation.
+*	Returns number of bytes written. */
+int write_serial_bytes_usb(shake_device_private* devpriv, char* buf, int bytes_to_write) {
+#ifndef _WIN32
+	DWORD bytes_written;
+	int remaining_bytes = bytes_to_write;
+
+	/* write the port in a loop to deal with timeouts */
+	while(1) {
+		//if(!WriteFile(devpriv->port.serial_usb.port, buf + (bytes_to_write - remaining_bytes), remaining_bytes, &bytes_written, NULL))
+		//	return bytes_to_write - remaining_bytes;
+		bytes_written = write(devpriv->port.serial_usb.port, buf + (bytes_to_write - remaining_bytes), remaining_bytes);
+		if(bytes_written == -1)
+			return remaining_bytes;
+
+		/* subtract the bytes we just wrote from the total amount we want */
+		remaining_bytes -= bytes_written;
+
+		/* if we didn't get them all.. */
+		if(remaining_bytes != 0) {
+			/* loop back round and write the port again */
+			continue;
+		} else
+			/* if all bytes have been written, break out of loop and return */
+			break;
+	}
+	return bytes_to_write - remaining_bytes;
+#else
+	return 0;
+#endif
+}
+
+int write_serial_bytes_delayed_usb(shake_device_private* devpriv, char* buf, int bytes_to_write, int chunk_size, int delay_ms) {
+#ifndef _WIN32
+	DWORD bytes_written;
+	int remaining_bytes = bytes_to_write;
+
+	/* write the port in a loop to deal with timeouts */
+	while(1) {
+ 		int current_remaining_bytes = remaining_bytes;// ((chunk_size >= remaining_bytes) ? chunk_size : remaining_bytes);
+		if(remaining_bytes > chunk_size)
+			current_remaining_bytes = chunk_size;
+		//if(!WriteFile(devpriv->port.serial_usb.port, buf + (bytes_to_write - remaining_bytes), current_remaining_bytes, &bytes_written, NULL))
+		//	return bytes_to_write - remaining_bytes;
+		bytes_written = write(devpriv->port.serial_usb.port, buf + (bytes_to_write - remaining_bytes), remaining_bytes);
+		if(bytes_written == -1)
+			return remaining_bytes;
+
+		/* subtract the bytes we just wrote from the total amount we want */
+		remaining_bytes -= bytes_written;
+
+		/* delay */
+		shake_sleep(delay_ms);
+
+		/* if we didn't get them all.. */
+		if(remaining_bytes != 0) {
+			/* loop back round and write the port again */
+			continue;
+		} else
+			/* if all bytes have been written, break out of loop and return */
+			break;
+	}
+	return bytes_to_write - remaining_bytes;
+#else
+	return 0;
+#endif
+}
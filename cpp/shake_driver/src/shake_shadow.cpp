@@ -0,0 +1,151 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+
+#include "shake_shadow.h"
+#include "shake_registers.h"
+#include <string.h>
+
+/*	non-volatile registers the device updates by itself, which are never shadowed. Writing
+*	SHAKE_VO_REG_LOGGING_CTRL also drops anything held for them */
+static const int shake_shadow_device_updated[] = {
+	SHAKE_NV_REG_LOGGING_PKT_LSB, SHAKE_NV_REG_LOGGING_PKT_MSB,
+};
+
+/* TRUE if the shadow can hold a value for register <addr> */
+static BOOL shake_shadow_covers(int addr) {
+	int i;
+
+	if(addr < 0 || addr >= SHAKE_SHADOW_REGISTERS)
+		return FALSE;
+	for(i=0;i<(int)(sizeof(shake_shadow_device_updated) / sizeof(shake_shadow_device_updated[0]));i++) {
+		if(shake_shadow_device_updated[i] == addr)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+void shake_shadow_init(shake_device_private* devpriv) {
+	shake_register_shadow* shadow = &(devpriv->shadow);
+
+	memset(shadow->valid, 0, sizeof(shadow->valid));
+	memset(shadow->version, 0, sizeof(shadow->version));
+	shake_mutex_init(&(shadow->lock));
+	shadow->enabled = FALSE;
+}
+
+void shake_shadow_free(shake_device_private* devpriv) {
+	shake_mutex_free(&(devpriv->shadow.lock));
+}
+
+/* forgets register <addr>. Must be called with the lock held */
+static void shake_shadow_forget(shake_register_shadow* shadow, int addr) {
+	shadow->valid[addr] = FALSE;
+	shadow->version[addr]++;
+}
+
+void shake_shadow_enable(shake_device_private* devpriv, BOOL enabled) {
+	shake_register_shadow* shadow = &(devpriv->shadow);
+	int i;
+
+	shake_mutex_lock(&(shadow->lock));
+	// commands sent while the shadow was off didn't take proper tokens, so they mustn't store anything either
+	for(i=0;i<SHAKE_SHADOW_REGISTERS;i++)
+		shake_shadow_forget(shadow, i);
+	shadow->enabled = enabled;
+	shake_mutex_unlock(&(shadow->lock));
+}
+
+BOOL shake_shadow_lookup(shake_device_private* devpriv, int addr, unsigned char* value) {
+	shake_register_shadow* shadow = &(devpriv->shadow);
+	BOOL hit = FALSE;
+
+	if(!shadow->enabled || !shake_shadow_covers(addr))
+		return FALSE;
+
+	shake_mutex_lock(&(shadow->lock));
+	if(shadow->valid[addr]) {
+		*value = shadow->values[addr];
+		hit = TRUE;
+	}
+	shake_mutex_unlock(&(shadow->lock));
+
+	if(hit)
+		shake_atomic_add(&(devpriv->stats.shadow_hits), 1);
+	else
+		shake_atomic_add(&(devpriv->stats.shadow_misses), 1);
+	return hit;
+}
+
+unsigned int shake_shadow_begin(shake_device_private* devpriv, int addr, BOOL write) {
+	shake_register_shadow* shadow = &(devpriv->shadow);
+	unsigned int token;
+	int i;
+
+	if(shadow->enabled && write && addr == SHAKE_VO_REG_LOGGING_CTRL) {
+		shake_mutex_lock(&(shadow->lock));
+		for(i=0;i<(int)(sizeof(shake_shadow_device_updated) / sizeof(shake_shadow_device_updated[0]));i++)
+			shake_shadow_forget(shadow, shake_shadow_device_updated[i]);
+		shake_mutex_unlock(&(shadow->lock));
+	}
+
+	if(!shadow->enabled || !shake_shadow_covers(addr))
+		return 0;
+
+	shake_mutex_lock(&(shadow->lock));
+	if(write)
+		shake_shadow_forget(shadow, addr);
+	token = shadow->version[addr];
+	shake_mutex_unlock(&(shadow->lock));
+	return token;
+}
+
+void shake_shadow_store(shake_device_private* devpriv, int addr, unsigned int token, unsigned char value) {
+	shake_register_shadow* shadow = &(devpriv->shadow);
+
+	if(!shadow->enabled || !shake_shadow_covers(addr))
+		return;
+
+	shake_mutex_lock(&(shadow->lock));
+	if(shadow->version[addr] == token) {
+		shadow->values[addr] = value;
+		shadow->valid[addr] = TRUE;
+	}
+	shake_mutex_unlock(&(shadow->lock));
+}
+
+void shake_shadow_invalidate(shake_device_private* devpriv, int addr) {
+	shake_register_shadow* shadow = &(devpriv->shadow);
+	int i;
+
+	if(addr != SHAKE_SHADOW_ALL && (addr < 0 || addr >= SHAKE_SHADOW_REGISTERS))
+		return;
+
+	shake_mutex_lock(&(shadow->lock));
+	if(addr == SHAKE_SHADOW_ALL) {
+		for(i=0;i<SHAKE_SHADOW_REGISTERS;i++)
+			shake_shadow_forget(shadow, i);
+	} else {
+		shake_shadow_forget(shadow, addr);
+	}
+	shake_mutex_unlock(&(shadow->lock));
+}
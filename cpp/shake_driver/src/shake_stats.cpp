@@ -0,0 +1,77 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+
+
+#include "shake_stats.h"
+#include <string.h>
+
+void shake_stats_snapshot(shake_device_private* devpriv, shake_stats_counters* counters) {
+	shake_stats_counters* s = &(devpriv->stats);
+	int i;
+
+	counters->bytes = shake_atomic_load_relaxed(&(s->bytes));
+	counters->io_wait_ns = shake_atomic_load_relaxed(&(s->io_wait_ns));
+	counters->framing_ns = shake_atomic_load_relaxed(&(s->framing_ns));
+	counters->decoding_ns = shake_atomic_load_relaxed(&(s->decoding_ns));
+	for(i=0;i<SHAKE_STATS_PACKET_TYPES;i++)
+		counters->packets[i] = shake_atomic_load_relaxed(&(s->packets[i]));
+	counters->resyncs = shake_atomic_load_relaxed(&(s->resyncs));
+	counters->resync_bytes = shake_atomic_load_relaxed(&(s->resync_bytes));
+	counters->checksum_failures = shake_atomic_load_relaxed(&(s->checksum_failures));
+	for(i=0;i<SHAKE_STATS_LATENCY_BINS;i++) {
+		counters->ack_latency[i] = shake_atomic_load_relaxed(&(s->ack_latency[i]));
+		counters->callback_latency[i] = shake_atomic_load_relaxed(&(s->callback_latency[i]));
+	}
+	counters->shadow_hits = shake_atomic_load_relaxed(&(s->shadow_hits));
+	counters->shadow_misses = shake_atomic_load_relaxed(&(s->shadow_misses));
+	counters->events_dropped = shake_atomic_load_relaxed(&(s->events_dropped));
+}
+
+void shake_stats_get(shake_device_private* devpriv, shake_stats* stats) {
+	shake_stats_counters now;
+	shake_stats_counters* base = &(devpriv->stats_at_reset);
+	int i;
+
+	shake_stats_snapshot(devpriv, &now);
+
+	// the counters are never reset, so everything is measured from the values at the last reset
+	memset(stats, 0, sizeof(shake_stats));
+	stats->elapsed = shake_time_now() - devpriv->stats_reset_time;
+	stats->bytes_received = now.bytes - base->bytes;
+	if(stats->elapsed > 0)
+		stats->bytes_per_sec = stats->bytes_received / stats->elapsed;
+	for(i=0;i<SHAKE_STATS_PACKET_TYPES;i++)
+		stats->packets[i] = now.packets[i] - base->packets[i];
+	stats->resyncs = now.resyncs - base->resyncs;
+	stats->resync_bytes_discarded = now.resync_bytes - base->resync_bytes;
+	stats->checksum_failures = now.checksum_failures - base->checksum_failures;
+	for(i=0;i<SHAKE_STATS_LATENCY_BINS;i++) {
+		stats->ack_latency[i] = now.ack_latency[i] - base->ack_latency[i];
+		stats->callback_latency[i] = now.callback_latency[i] - base->callback_latency[i];
+	}
+	stats->io_wait_time = (now.io_wait_ns - base->io_wait_ns) / 1e9;
+	stats->framing_time = (now.framing_ns - base->framing_ns) * SHAKE_STATS_TIMING_INTERVAL / 1e9;
+	stats->decoding_time = (now.decoding_ns - base->decoding_ns) * SHAKE_STATS_TIMING_INTERVAL / 1e9;
+	stats->register_shadow_hits = now.shadow_hits - base->shadow_hits;
+	stats->register_shadow_misses = now.shadow_misses - base->shadow_misses;
+	stats->events_dropped = now.events_dropped - base->events_dropped;
+}
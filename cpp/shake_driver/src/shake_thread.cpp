@@ -1,152 +1,410 @@
-/*	Copyright (c) 2006-2009, University of Glasgow
-*	All rights reserved.
-*
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*
-*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
-*			in the documentation and/or other materials provided with the distribution.
-*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
-*			from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
-*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
-*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-
-#include "shake_platform.h"
-#include "shake_thread.h"
-
-#ifndef _WIN32
-/*  utility func to avoid rewriting this pthread_cond_wait handling code.
- *  Waits on dev->cmd_event, returns TRUE if returning
- *  due to signal, FALSE otherwise */
-BOOL pthread_wait(shake_thread* dev, int secs, int ms, int thread) {
-	struct timeval now;
-	struct timespec timeout;
-	int done, retval;
-	BOOL signalled = FALSE;
-
-	/* lock the mutex associated with the condition variable */
-	if(thread == CMD_THREAD)
-		pthread_mutex_lock(&(dev->cmd_mutex));
-	else
-		pthread_mutex_lock(&(dev->callback_mutex));
-
-	gettimeofday(&now, NULL);
-
-	/* have to set absolute time for the timeout */
-
-	/* just add seconds to current time */
-	timeout.tv_sec = now.tv_sec + secs;
-
-	/* timespec structure uses nanoseconds, timeval uses microseconds, and
-	 * we get milliseconds as a parameter. This statement just converts the milliseconds into
-	 * microseconds, adds them to the current microsecond offset, and multiplies the result
-	 * by 1000 to get it into nanoseconds for the timespec structure */
-	timeout.tv_nsec = (now.tv_usec + (1000 * ms)) * 1000;
-
-	/* it's possible that the wait might be ended prematurely by a
-	 * Unix signal, so have to run a loop like this... */
-	done = FALSE;
-	while(!done) {
-		if(thread == CMD_THREAD)
-			retval = pthread_cond_timedwait(&(dev->cmd_event), &(dev->cmd_mutex), &timeout);
-		else
-			retval = pthread_cond_timedwait(&(dev->callback_event), &(dev->callback_mutex), &timeout);
-		switch(retval) {
-			case 0:
-				/* in this case the func returned due to the cond var being signalled */
-				done = TRUE;
-				signalled = TRUE;
-				break;
-			default: 
-				/* some signal was responsible for returning from func */
-				if(retval == ETIMEDOUT || retval == EINVAL) {
-					done = TRUE;
-				}
-				break;
-		}
-	}
-	if(thread == CMD_THREAD)
-		pthread_mutex_unlock(&(dev->cmd_mutex));
-	else
-		pthread_mutex_unlock(&(dev->callback_mutex));
-	return signalled;
-}
-#endif /* _WIN32 */
-
-shake_thread* shake_thread_init(shake_thread* st, SHAKE_THREAD_FUNC cmdfunc, void* cmdparam, TCHAR* cmdeventname, 
-													SHAKE_THREAD_FUNC cbfunc, void* cbparam, TCHAR* cbeventname,
-													SHAKE_THREAD_FUNC audiofunc, void* audioparam, TCHAR* audioeventname) {
-	#ifdef _WIN32
-	st->cmd_event = CreateEvent(NULL, FALSE, FALSE, cmdeventname); 
-	st->rthread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)cmdfunc, cmdparam, 0, NULL);
-	SetThreadPriority(st->rthread, THREAD_PRIORITY_ABOVE_NORMAL);
-	st->callback_event = CreateEvent(NULL, FALSE, FALSE, cbeventname);
-	st->cthread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)cbfunc, cbparam, 0, NULL);
-	if(audiofunc) {
-		st->audio_event = CreateEvent(NULL, FALSE, FALSE, audioeventname);
-		st->audiothread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)audiofunc, audioparam, 0, NULL);
-		SetThreadPriority(st->audiothread, THREAD_PRIORITY_ABOVE_NORMAL);
-	}
-	#else
-	pthread_cond_init(&(st->cmd_event), NULL);
-	pthread_mutex_init(&(st->cmd_mutex), NULL);
-	pthread_create(&(st->rthread), NULL, cmdfunc, cmdparam);
-	pthread_cond_init(&(st->callback_event), NULL);
-	pthread_mutex_init(&(st->callback_mutex), NULL);
-	pthread_create(&(st->cthread), NULL, cbfunc, cbparam);
-	#endif
-	return st;
-}
-
-BOOL shake_thread_wait(shake_thread* st, int secs, int ms, int thread) {
-	#ifdef _WIN32
-	int ret;
-	if(thread == CMD_THREAD)
-		ret = WaitForSingleObject(st->cmd_event, (secs * 1000) + ms);
-	else
-		ret = WaitForSingleObject(st->callback_event, (secs * 1000) + ms);
-	
-	if(ret == WAIT_OBJECT_0)
-		return TRUE;
-	return FALSE;
-	#else
-	return pthread_wait(st, secs, ms, thread);
-	#endif
-}
-
-BOOL shake_thread_signal(shake_thread* st, int thread) {
-	#ifdef _WIN32
-	if(thread == CMD_THREAD)
-		SetEvent(st->cmd_event);
-	else
-		SetEvent(st->callback_event);
-	#else
-	if(thread == CMD_THREAD)
-		pthread_cond_signal(&(st->cmd_event));
-	else
-		pthread_cond_signal(&(st->callback_event));
-	#endif
-	return TRUE;
-}
-
-BOOL shake_thread_free(shake_thread* st) {
-	#ifdef _WIN32
-	CloseHandle(st->cmd_event);
-	#else
-	#endif
-	return TRUE;
-}
-
-void shake_thread_exit(int value) {
-	#ifdef _WIN32
-	ExitThread(value);
-	#else
-	pthread_exit((void*)value);
-	#endif
-}
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "shake_platform.h"
+#include "shake_thread.h"
+#include <time.h>
+#include <string.h>
+#if !defined(_WIN32) && !defined(__APPLE__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#endif
+
+#ifdef _WIN32
+typedef BOOL (WINAPI *shake_wait_on_address_func)(volatile VOID*, PVOID, SIZE_T, DWORD);
+typedef VOID (WINAPI *shake_wake_by_address_func)(PVOID);
+
+/*	WaitOnAddress() and WakeByAddress*() only exist from Windows 8, so they're looked up when the
+*	first device is set up. Without them each word gets a semaphore of its own instead */
+static shake_wake_by_address_func shake_wake_by_address_single = NULL;
+static shake_wake_by_address_func shake_wake_by_address_all = NULL;
+static shake_wait_on_address_func shake_wait_on_address = NULL;
+
+static void shake_find_wait_on_address() {
+	#ifndef _WIN32_WCE
+	HMODULE lib;
+	shake_wake_by_address_func wake_single, wake_all;
+	shake_wait_on_address_func wait;
+
+	if(shake_wait_on_address != NULL)
+		return;
+	lib = GetModuleHandle(TEXT("kernelbase.dll"));
+	if(lib == NULL)
+		return;
+	wake_single = (shake_wake_by_address_func)GetProcAddress(lib, "WakeByAddressSingle");
+	wake_all = (shake_wake_by_address_func)GetProcAddress(lib, "WakeByAddressAll");
+	wait = (shake_wait_on_address_func)GetProcAddress(lib, "WaitOnAddress");
+	if(wake_single == NULL || wake_all == NULL || wait == NULL)
+		return;
+
+	// the wait function is set last, since it decides which way words are waited on
+	shake_wake_by_address_single = wake_single;
+	shake_wake_by_address_all = wake_all;
+	MemoryBarrier();
+	shake_wait_on_address = wait;
+	#endif
+}
+
+/*	returns the semaphore slot for <word>, giving it one if <create> is TRUE and it doesn't have 
+*	one yet. NULL if there isn't one (or no slots are left) */
+static shake_wait_slot* shake_find_wait_slot(shake_thread* st, volatile unsigned int* word, BOOL create) {
+	shake_wait_slot* slot = NULL;
+	int i;
+
+	EnterCriticalSection(&(st->wait_lock));
+	for(i=0;i<SHAKE_WAIT_SLOTS;i++) {
+		if(st->wait_slots[i].word == word) {
+			slot = &(st->wait_slots[i]);
+			break;
+		}
+	}
+	for(i=0;create && slot == NULL && i<SHAKE_WAIT_SLOTS;i++) {
+		if(st->wait_slots[i].word == NULL) {
+			st->wait_slots[i].sem = CreateSemaphore(NULL, 0, 0x7FFFFFFF, NULL);
+			if(st->wait_slots[i].sem != NULL) {
+				st->wait_slots[i].word = word;
+				slot = &(st->wait_slots[i]);
+			}
+		}
+	}
+	LeaveCriticalSection(&(st->wait_lock));
+	return slot;
+}
+#else
+/*  utility func to avoid rewriting this pthread_cond_wait handling code.
+ *  Waits on dev->cmd_event, returns TRUE if returning
+ *  due to signal, FALSE otherwise. A signal sent while nobody is waiting is
+ *  kept in the pending flag, so the next wait returns straight away */
+BOOL pthread_wait(shake_thread* dev, int secs, int ms, int thread) {
+	struct timeval now;
+	struct timespec timeout;
+	int done, retval;
+	BOOL signalled = FALSE;
+	BOOL* pending = (thread == CMD_THREAD) ? &(dev->cmd_pending) : &(dev->callback_pending);
+
+	/* lock the mutex associated with the condition variable */
+	if(thread == CMD_THREAD)
+		pthread_mutex_lock(&(dev->cmd_mutex));
+	else
+		pthread_mutex_lock(&(dev->callback_mutex));
+
+	gettimeofday(&now, NULL);
+
+	/* have to set absolute time for the timeout */
+
+	/* just add seconds to current time */
+	timeout.tv_sec = now.tv_sec + secs;
+
+	/* timespec structure uses nanoseconds, timeval uses microseconds, and
+	 * we get milliseconds as a parameter. This statement just converts the milliseconds into
+	 * microseconds, adds them to the current microsecond offset, and multiplies the result
+	 * by 1000 to get it into nanoseconds for the timespec structure */
+	timeout.tv_nsec = (now.tv_usec + (1000 * ms)) * 1000;
+	timeout.tv_sec += timeout.tv_nsec / 1000000000;
+	timeout.tv_nsec %= 1000000000;
+
+	/* it's possible that the wait might be ended prematurely by a
+	 * Unix signal, so have to run a loop like this... */
+	done = *pending;
+	while(!done) {
+		if(thread == CMD_THREAD)
+			retval = pthread_cond_timedwait(&(dev->cmd_event), &(dev->cmd_mutex), &timeout);
+		else
+			retval = pthread_cond_timedwait(&(dev->callback_event), &(dev->callback_mutex), &timeout);
+		switch(retval) {
+			case 0:
+				/* in this case the func returned due to the cond var being signalled, or spuriously */
+				done = *pending;
+				break;
+			default: 
+				/* some signal was responsible for returning from func */
+				if(retval == ETIMEDOUT || retval == EINVAL) {
+					done = TRUE;
+				}
+				break;
+		}
+	}
+	signalled = *pending;
+	*pending = FALSE;
+	if(thread == CMD_THREAD)
+		pthread_mutex_unlock(&(dev->cmd_mutex));
+	else
+		pthread_mutex_unlock(&(dev->callback_mutex));
+	return signalled;
+}
+#endif /* _WIN32 */
+
+shake_thread* shake_thread_init(shake_thread* st, SHAKE_THREAD_FUNC cmdfunc, void* cmdparam, TCHAR* cmdeventname, 
+													SHAKE_THREAD_FUNC cbfunc, void* cbparam, TCHAR* cbeventname,
+													SHAKE_THREAD_FUNC audiofunc, void* audioparam, TCHAR* audioeventname) {
+	#ifdef _WIN32
+	shake_find_wait_on_address();
+	memset(st->wait_slots, 0, sizeof(st->wait_slots));
+	InitializeCriticalSection(&(st->wait_lock));
+	st->cmd_event = CreateEvent(NULL, FALSE, FALSE, cmdeventname); 
+	if(cmdfunc) {
+		st->rthread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)cmdfunc, cmdparam, 0, &(st->rthread_id));
+		SetThreadPriority(st->rthread, THREAD_PRIORITY_ABOVE_NORMAL);
+	}
+	st->callback_event = CreateEvent(NULL, FALSE, FALSE, cbeventname);
+	if(cbfunc)
+		st->cthread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)cbfunc, cbparam, 0, &(st->cthread_id));
+	if(audiofunc) {
+		st->audio_event = CreateEvent(NULL, FALSE, FALSE, audioeventname);
+		st->audiothread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)audiofunc, audioparam, 0, &(st->audiothread_id));
+		SetThreadPriority(st->audiothread, THREAD_PRIORITY_ABOVE_NORMAL);
+	}
+	#else
+	#ifdef __APPLE__
+	pthread_cond_init(&(st->sample_event), NULL);
+	pthread_mutex_init(&(st->sample_mutex), NULL);
+	#endif
+	st->cmd_pending = st->callback_pending = FALSE;
+	pthread_cond_init(&(st->cmd_event), NULL);
+	pthread_mutex_init(&(st->cmd_mutex), NULL);
+	// the reader thread signals the callback thread, so both must be set up before it starts
+	pthread_cond_init(&(st->callback_event), NULL);
+	pthread_mutex_init(&(st->callback_mutex), NULL);
+	if(cmdfunc)
+		pthread_create(&(st->rthread), NULL, cmdfunc, cmdparam);
+	if(cbfunc)
+		pthread_create(&(st->cthread), NULL, cbfunc, cbparam);
+	#endif
+	return st;
+}
+
+BOOL shake_thread_wait(shake_thread* st, int secs, int ms, int thread) {
+	#ifdef _WIN32
+	int ret;
+	if(thread == CMD_THREAD)
+		ret = WaitForSingleObject(st->cmd_event, (secs * 1000) + ms);
+	else
+		ret = WaitForSingleObject(st->callback_event, (secs * 1000) + ms);
+	
+	if(ret == WAIT_OBJECT_0)
+		return TRUE;
+	return FALSE;
+	#else
+	return pthread_wait(st, secs, ms, thread);
+	#endif
+}
+
+BOOL shake_thread_signal(shake_thread* st, int thread) {
+	#ifdef _WIN32
+	if(thread == CMD_THREAD)
+		SetEvent(st->cmd_event);
+	else
+		SetEvent(st->callback_event);
+	#else
+	if(thread == CMD_THREAD) {
+		pthread_mutex_lock(&(st->cmd_mutex));
+		st->cmd_pending = TRUE;
+		pthread_cond_signal(&(st->cmd_event));
+		pthread_mutex_unlock(&(st->cmd_mutex));
+	} else {
+		pthread_mutex_lock(&(st->callback_mutex));
+		st->callback_pending = TRUE;
+		pthread_cond_signal(&(st->callback_event));
+		pthread_mutex_unlock(&(st->callback_mutex));
+	}
+	#endif
+	return TRUE;
+}
+
+BOOL shake_thread_free(shake_thread* st) {
+	#ifdef _WIN32
+	int i;
+
+	CloseHandle(st->cmd_event);
+	for(i=0;i<SHAKE_WAIT_SLOTS;i++) {
+		if(st->wait_slots[i].word != NULL)
+			CloseHandle(st->wait_slots[i].sem);
+	}
+	DeleteCriticalSection(&(st->wait_lock));
+	#else
+	#ifdef __APPLE__
+	pthread_cond_destroy(&(st->sample_event));
+	pthread_mutex_destroy(&(st->sample_mutex));
+	#endif
+	#endif
+	return TRUE;
+}
+
+void shake_thread_exit(int value) {
+	#ifdef _WIN32
+	ExitThread(value);
+	#else
+	pthread_exit((void*)value);
+	#endif
+}
+
+BOOL shake_thread_is_current(shake_thread* st, int thread) {
+	#ifdef _WIN32
+	if(thread == CMD_THREAD)
+		return st->rthread != NULL && st->rthread_id == GetCurrentThreadId();
+	return st->cthread != NULL && st->cthread_id == GetCurrentThreadId();
+	#else
+	if(thread == CMD_THREAD)
+		return pthread_equal(pthread_self(), st->rthread) != 0;
+	return pthread_equal(pthread_self(), st->cthread) != 0;
+	#endif
+}
+
+double shake_time_now() {
+	#ifdef _WIN32
+	static LARGE_INTEGER freq = { 0 };
+	LARGE_INTEGER now;
+	if(freq.QuadPart == 0)
+		QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+	return (double)now.QuadPart / (double)freq.QuadPart;
+	#elif defined(__APPLE__)
+	// OS X has no CLOCK_MONOTONIC, but the Mach absolute time never goes backwards either
+	static mach_timebase_info_data_t timebase = { 0, 0 };
+	if(timebase.denom == 0)
+		mach_timebase_info(&timebase);
+	return (double)mach_absolute_time() * timebase.numer / timebase.denom / 1000000000.0;
+	#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + (now.tv_nsec / 1000000000.0);
+	#endif
+}
+
+void shake_thread_wait_word(shake_thread* st, volatile unsigned int* word, unsigned int value, int ms) {
+	#ifdef _WIN32
+	shake_wait_slot* slot;
+
+	// like the futex below, only sleeps if the word still holds <value>, and only wakes for this word
+	if(shake_wait_on_address != NULL) {
+		shake_wait_on_address(word, &value, sizeof(value), ms < 0 ? INFINITE : ms);
+		return;
+	}
+
+	slot = shake_find_wait_slot(st, word, TRUE);
+	if(slot == NULL) {
+		// more words than slots, so just check again shortly
+		if(*word == value)
+			Sleep((ms < 0 || ms > 1) ? 1 : ms);
+		return;
+	}
+	// counted before the word is checked, so a wake that changes it after the check releases this thread
+	InterlockedIncrement(&(slot->waiters));
+	if(*word == value)
+		WaitForSingleObject(slot->sem, ms < 0 ? INFINITE : ms);
+	InterlockedDecrement(&(slot->waiters));
+	#elif defined(__APPLE__)
+	struct timeval now;
+	struct timespec timeout;
+
+	gettimeofday(&now, NULL);
+	timeout.tv_sec = now.tv_sec + (ms / 1000);
+	timeout.tv_nsec = (now.tv_usec * 1000) + ((ms % 1000) * 1000000);
+	if(timeout.tv_nsec >= 1000000000) {
+		timeout.tv_sec++;
+		timeout.tv_nsec -= 1000000000;
+	}
+
+	// the word is checked with the mutex held, so a wakeup can't be missed
+	pthread_mutex_lock(&(st->sample_mutex));
+	if(*word == value) {
+		if(ms < 0)
+			pthread_cond_wait(&(st->sample_event), &(st->sample_mutex));
+		else
+			pthread_cond_timedwait(&(st->sample_event), &(st->sample_mutex), &timeout);
+	}
+	pthread_mutex_unlock(&(st->sample_mutex));
+	#else
+	struct timespec timeout;
+
+	timeout.tv_sec = ms / 1000;
+	timeout.tv_nsec = (ms % 1000) * 1000000;
+
+	// the kernel only puts the thread to sleep if the word still holds <value>
+	syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, ms < 0 ? NULL : &timeout, NULL, 0);
+	#endif
+}
+
+void shake_thread_wake_word(shake_thread* st, volatile unsigned int* word, int waiters) {
+	#ifdef _WIN32
+	shake_wait_slot* slot;
+	LONG n;
+
+	if(shake_wait_on_address != NULL) {
+		if(waiters == 1)
+			shake_wake_by_address_single((PVOID)word);
+		else
+			shake_wake_by_address_all((PVOID)word);
+		return;
+	}
+
+	// nobody has ever waited on the word if it has no slot
+	slot = shake_find_wait_slot(st, word, FALSE);
+	if(slot == NULL)
+		return;
+	// only releases threads that are waiting, so at most one count is left over (when a wait
+	// times out at the same moment) and that just makes a later wait return early once
+	n = InterlockedCompareExchange(&(slot->waiters), 0, 0);
+	if(n > waiters)
+		n = waiters;
+	if(n > 0)
+		ReleaseSemaphore(slot->sem, n, NULL);
+	#elif defined(__APPLE__)
+	pthread_mutex_lock(&(st->sample_mutex));
+	pthread_cond_broadcast(&(st->sample_event));
+	pthread_mutex_unlock(&(st->sample_mutex));
+	#else
+	syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, waiters, NULL, NULL, 0);
+	#endif
+}
+
+void shake_mutex_init(shake_mutex* m) {
+	#ifdef _WIN32
+	InitializeCriticalSection(m);
+	#else
+	pthread_mutex_init(m, NULL);
+	#endif
+}
+
+void shake_mutex_lock(shake_mutex* m) {
+	#ifdef _WIN32
+	EnterCriticalSection(m);
+	#else
+	pthread_mutex_lock(m);
+	#endif
+}
+
+void shake_mutex_unlock(shake_mutex* m) {
+	#ifdef _WIN32
+	LeaveCriticalSection(m);
+	#else
+	pthread_mutex_unlock(m);
+	#endif
+}
+
+void shake_mutex_free(shake_mutex* m) {
+	#ifdef _WIN32
+	DeleteCriticalSection(m);
+	#else
+	pthread_mutex_destroy(m);
+	#endif
+}
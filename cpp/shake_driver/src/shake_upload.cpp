@@ -0,0 +1,252 @@
+/*	Copyright (c) 2006-2009, University of Glasgow
+*	All rights reserved.
+*
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*
+*		* Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*		* Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+*			in the documentation and/or other materials provided with the distribution.
+*		* Neither the name of the University of Glasgow nor the names of its contributors may be used to endorse or promote products derived 
+*			from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+*	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS 
+*	BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE 
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+*	LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "shake_upload.h"
+#include "shake_command.h"
+#include "shake_parsing.h"
+#include "shake_thread.h"
+#include "SHAKE.h"
+#include <string.h>
+
+/* length of a $STRU packet: the header, the page address (LSB first) and a page of samples */
+#define SHAKE_UPLOAD_PACKET_SIZE (7 + SHAKE_UPLOAD_PAGE_SIZE)
+
+/*	largest number of windows' worth of pages in each group of pages whose replies are checked 
+*	together. Larger groups stop less often to let the window empty, but send more pages again 
+*	after a failure */
+#define SHAKE_UPLOAD_GROUP_WINDOWS 8
+
+void shake_upload_init(shake_device_private* devpriv) {
+	shake_upload_state* up = &(devpriv->upload);
+
+	shake_mutex_init(&(up->lock));
+	up->window = SHAKE_UPLOAD_DEFAULT_WINDOW;
+	up->retries = SHAKE_UPLOAD_DEFAULT_RETRIES;
+	up->timeout_ms = SHAKE_UPLOAD_DEFAULT_TIMEOUT_MS;
+	up->chunk_size = SHAKE_UPLOAD_CHUNK_SIZE;
+	up->delay_ms = SHAKE_UPLOAD_DELAY;
+	up->stats.status = SHAKE_UPLOAD_IDLE;
+}
+
+void shake_upload_free(shake_device_private* devpriv) {
+	shake_mutex_free(&(devpriv->upload.lock));
+}
+
+int shake_upload_set_options(shake_device_private* devpriv, int window, int retries, int timeout_ms, int chunk_size, int delay_ms) {
+	shake_upload_state* up = &(devpriv->upload);
+
+	if(window == 0 || window < -1 || window > SHAKE_COMMAND_MAX_WINDOW || retries < -1 || timeout_ms == 0 || timeout_ms < -1 || chunk_size < -1 || delay_ms < -1)
+		return SHAKE_ERROR;
+
+	shake_mutex_lock(&(up->lock));
+	if(up->running) {
+		shake_mutex_unlock(&(up->lock));
+		return SHAKE_ERROR;
+	}
+	up->window = window == -1 ? SHAKE_UPLOAD_DEFAULT_WINDOW : window;
+	up->retries = retries == -1 ? SHAKE_UPLOAD_DEFAULT_RETRIES : retries;
+	up->timeout_ms = timeout_ms == -1 ? SHAKE_UPLOAD_DEFAULT_TIMEOUT_MS : timeout_ms;
+	up->chunk_size = chunk_size == -1 ? SHAKE_UPLOAD_CHUNK_SIZE : chunk_size;
+	up->delay_ms = delay_ms == -1 ? SHAKE_UPLOAD_DELAY : delay_ms;
+	shake_mutex_unlock(&(up->lock));
+	return SHAKE_SUCCESS;
+}
+
+/* fills in the address and samples of page <page> in <packetbuf>, padding the last page with zeroes */
+static void shake_upload_build_page(char* packetbuf, int address, int page, const short* samples, const char* bytes, int len) {
+	int first = page * SHAKE_UPLOAD_PAGE_SIZE;
+	int count = len - first;
+	unsigned char* data = (unsigned char*)(packetbuf + 7);
+
+	if(count > SHAKE_UPLOAD_PAGE_SIZE)
+		count = SHAKE_UPLOAD_PAGE_SIZE;
+
+	packetbuf[5] = (address + page) & 0x00FF;
+	packetbuf[6] = ((address + page) & 0xFF00) >> 8;
+
+	if(samples)
+		shake_mulaw_compress(samples + first, count, data);
+	else
+		memcpy(data, bytes + first, count);
+	if(count < SHAKE_UPLOAD_PAGE_SIZE)
+		memset(data + count, 0, SHAKE_UPLOAD_PAGE_SIZE - count);
+}
+
+/* updates the progress of the upload, copying it into <progress> if that isn't NULL */
+static void shake_upload_progress(shake_upload_state* up, int status, int done, int sent, int retries, shake_upload_stats* progress) {
+	shake_mutex_lock(&(up->lock));
+	up->stats.status = status;
+	up->stats.pages_done = done;
+	up->stats.pages_sent = sent;
+	up->stats.retries = retries;
+	up->stats.elapsed = shake_time_now() - up->start_time;
+	up->stats.bytes_per_sec = up->stats.elapsed > 0 ? (done * (double)SHAKE_UPLOAD_PAGE_SIZE) / up->stats.elapsed : 0.0;
+	if(progress)
+		*progress = up->stats;
+	shake_mutex_unlock(&(up->lock));
+}
+
+int shake_upload_run(shake_device_private* devpriv, int address, const short* samples, const char* bytes, int len, shake_upload_callback callback, void* user) {
+	shake_upload_state* up = &(devpriv->upload);
+	shake_future futures[SHAKE_COMMAND_MAX_WINDOW];
+	shake_upload_stats progress;
+	char packetbuf[SHAKE_UPLOAD_PACKET_SIZE];
+	int window, retries, timeout_ms, chunk_size, delay_ms;
+	int pages, group, max_group, group_end, first = 0, count = 0, next = 0, done = 0, sent = 0, retried = 0, tries = 0;
+	int result = SHAKE_UPLOAD_DONE, status, first_nak = -1, confirmed;
+	BOOL timed_out = FALSE;
+
+	if(len <= 0 || address < SHAKE_UPLOAD_MIN_PAGE)
+		return SHAKE_ERROR;
+
+	pages = (len + SHAKE_UPLOAD_PAGE_SIZE - 1) / SHAKE_UPLOAD_PAGE_SIZE;
+	if(address + pages > SHAKE_UPLOAD_MAX_PAGE)
+		return SHAKE_ERROR;
+
+	if(!shake_atomic_cas(&(up->running), FALSE, TRUE))
+		return SHAKE_ERROR;
+	shake_atomic_store_release(&(up->cancel), FALSE);
+
+	shake_mutex_lock(&(up->lock));
+	window = up->window;
+	retries = up->retries;
+	timeout_ms = up->timeout_ms;
+	chunk_size = up->chunk_size;
+	delay_ms = up->delay_ms;
+	memset(&(up->stats), 0, sizeof(shake_upload_stats));
+	up->stats.status = SHAKE_UPLOAD_RUNNING;
+	up->stats.pages_total = pages;
+	up->start_time = shake_time_now();
+	shake_mutex_unlock(&(up->lock));
+
+	memset(packetbuf, 0, SHAKE_UPLOAD_PACKET_SIZE);
+	memcpy(packetbuf, "$STRU", 5);
+
+	/*	replies are matched to pages oldest first, so if a page or its reply goes missing the 
+	*	replies to the pages after it are taken for replies to the pages before them, and only the
+	*	last page sent before the replies stop times out. The pages are therefore sent in groups,
+	*	and the replies to a group are only trusted once the window has emptied without any page
+	*	timing out. Then every page before the first one rejected has been stored, otherwise the
+	*	whole group is sent again, as half as many pages in case pages are going missing often.
+	*	With a window of 1 page there's nothing for a reply to be confused with, so each page is a
+	*	group of its own */
+	group = max_group = window == 1 ? 1 : window * SHAKE_UPLOAD_GROUP_WINDOWS;
+	group_end = group < pages ? group : pages;
+
+	/* <futures> holds the <count> pages waiting for replies, oldest first from <first> */
+	while(done < pages) {
+		if(shake_atomic_load_acquire(&(up->cancel))) {
+			result = SHAKE_UPLOAD_CANCELLED;
+			break;
+		}
+
+		// keep the window full until the end of the group, or until a page in it has failed
+		if(count < window && next < group_end && first_nak == -1 && !timed_out) {
+			shake_upload_build_page(packetbuf, address, next, samples, bytes, len);
+			if(shake_command_send(devpriv, packetbuf, SHAKE_UPLOAD_PACKET_SIZE, chunk_size, delay_ms, SHAKE_COMMAND_ANY_ADDR, timeout_ms, window, &(futures[(first + count) % SHAKE_COMMAND_MAX_WINDOW]), NULL, NULL) != SHAKE_SUCCESS) {
+				result = SHAKE_UPLOAD_FAILED;
+				break;
+			}
+			count++;
+			next++;
+			sent++;
+			continue;
+		}
+
+		// the pages waiting for replies are always the <count> pages before <next>
+		if(count > 0) {
+			status = shake_command_wait(devpriv, &(futures[first]), -1);
+			if(status == SHAKE_COMMAND_TIMEOUT)
+				timed_out = TRUE;
+			else if(status == SHAKE_COMMAND_NAK && first_nak == -1)
+				first_nak = next - count;
+			first = (first + 1) % SHAKE_COMMAND_MAX_WINDOW;
+			count--;
+			continue;
+		}
+
+		// the window is empty, having reached the end of the group or a failed page
+		if(timed_out)
+			confirmed = done;
+		else if(first_nak != -1)
+			confirmed = first_nak;
+		else
+			confirmed = group_end;
+
+		if(confirmed > done) {
+			done = confirmed;
+			tries = 0;
+			shake_upload_progress(up, SHAKE_UPLOAD_RUNNING, done, sent, retried, &progress);
+			if(callback)
+				callback(devpriv->shake->dev, &progress, user);
+		}
+
+		if(confirmed == group_end) {
+			if(group < max_group)
+				group *= 2;
+		} else {
+			// send the group again from the first page that might not have been stored
+			if(++tries > retries) {
+				result = SHAKE_UPLOAD_FAILED;
+				break;
+			}
+			retried++;
+			if(timed_out && group > 1)
+				group /= 2;
+		}
+		next = done;
+		group_end = done + group < pages ? done + group : pages;
+		first_nak = -1;
+		timed_out = FALSE;
+	}
+
+	// the futures of any pages still waiting for replies are on this stack, so wait for them to complete
+	while(count > 0) {
+		shake_command_wait(devpriv, &(futures[first]), -1);
+		first = (first + 1) % SHAKE_COMMAND_MAX_WINDOW;
+		count--;
+	}
+
+	shake_upload_progress(up, result, done, sent, retried, NULL);
+	shake_atomic_store_release(&(up->running), FALSE);
+	return result == SHAKE_UPLOAD_DONE ? SHAKE_SUCCESS : SHAKE_ERROR;
+}
+
+int shake_upload_cancel(shake_device_private* devpriv) {
+	shake_upload_state* up = &(devpriv->upload);
+
+	if(!shake_atomic_load_acquire(&(up->running)))
+		return SHAKE_ERROR;
+
+	shake_atomic_store_release(&(up->cancel), TRUE);
+	return SHAKE_SUCCESS;
+}
+
+void shake_upload_get_stats(shake_device_private* devpriv, shake_upload_stats* stats) {
+	shake_upload_state* up = &(devpriv->upload);
+
+	shake_mutex_lock(&(up->lock));
+	*stats = up->stats;
+	// an upload in progress has been going for longer than when its progress was last updated
+	if(stats->status == SHAKE_UPLOAD_RUNNING) {
+		stats->elapsed = shake_time_now() - up->start_time;
+		stats->bytes_per_sec = stats->elapsed > 0 ? (stats->pages_done * (double)SHAKE_UPLOAD_PAGE_SIZE) / stats->elapsed : 0.0;
+	}
+	shake_mutex_unlock(&(up->lock));
+}
@@ -541,6 +541,14 @@ JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_sk7_1roll_1pitch_1heading
 JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_sk7_1roll_1pitch_1heading_1quaternions
   (JNIEnv *, jclass, jlong, jfloatArray);
 
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_parse_decimal_fields
+ * Signature: (Ljava/lang/String;[F)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1parse_1decimal_1fields
+  (JNIEnv *, jclass, jstring, jfloatArray);
+
 /*
  * Class:     SHAKE_shake_device
  * Method:    sk7_configure_roll_pitch_heading
@@ -565,6 +573,46 @@ JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1register_1event_1callback
 JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1data_1timestamp
   (JNIEnv *, jclass, jlong, jint);
 
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_wait_sample
+ * Signature: (JII)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1wait_1sample
+  (JNIEnv *, jclass, jlong, jint, jint);
+
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_get_stream_stats
+ * Signature: (JI[I)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1get_1stream_1stats
+  (JNIEnv *, jclass, jlong, jint, jintArray);
+
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_reset_stream_stats
+ * Signature: (JI)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1reset_1stream_1stats
+  (JNIEnv *, jclass, jlong, jint);
+
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_get_stats
+ * Signature: (J[D[I[I[I)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1get_1stats
+  (JNIEnv *, jclass, jlong, jdoubleArray, jintArray, jintArray, jintArray);
+
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_reset_stats
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1reset_1stats
+  (JNIEnv *, jclass, jlong);
+
 /*
  * Class:     SHAKE_shake_device
  * Method:    shake_logging_play
@@ -1117,6 +1165,46 @@ JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1playvib
 JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_sk6_1upload_1vib_1sample
   (JNIEnv *, jclass, jlong, jbyte, jintArray);
 
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_upload_audio_sample
+ * Signature: (JI[SLjava/lang/Object;)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1upload_1audio_1sample
+  (JNIEnv *, jclass, jlong, jint, jshortArray, jobject);
+
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_exp_upload_vib_sample
+ * Signature: (JI[BLjava/lang/Object;)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1exp_1upload_1vib_1sample
+  (JNIEnv *, jclass, jlong, jint, jbyteArray, jobject);
+
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_set_upload_options
+ * Signature: (JIIIII)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1set_1upload_1options
+  (JNIEnv *, jclass, jlong, jint, jint, jint, jint, jint);
+
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_cancel_upload
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1cancel_1upload
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     SHAKE_shake_device
+ * Method:    shake_get_upload_stats
+ * Signature: (J[D)I
+ */
+JNIEXPORT jint JNICALL Java_SHAKE_shake_1device_shake_1get_1upload_1stats
+  (JNIEnv *, jclass, jlong, jdoubleArray);
+
 /*
  * Class:     SHAKE_shake_device
  * Method:    shake_read_battery_level
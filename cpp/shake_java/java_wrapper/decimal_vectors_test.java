@@ -0,0 +1,42 @@
+import SHAKE.*;
+import java.io.*;
+
+// Runs the vectors in cpp/bench/decimal_vectors.txt through shake_device.parse_decimal_fields(), 
+// to check the JNI wrapper gives exactly what the driver does. 
+// usage: java decimal_vectors_test [vector file]
+public class decimal_vectors_test {
+
+	public static void main(String[] args) throws IOException {
+		String path = args.length > 0 ? args[0] : "../../bench/decimal_vectors.txt";
+		BufferedReader in = new BufferedReader(new FileReader(path));
+		String line;
+		int lines = 0, failed = 0;
+
+		while((line = in.readLine()) != null) {
+			int tab = line.indexOf('\t');
+			if(line.startsWith("#") || tab < 0)
+				continue;
+
+			String text = line.substring(0, tab);
+			String[] expected = line.substring(tab + 1).trim().split(" ");
+			int count = expected[0].length() == 0 ? 0 : expected.length;
+			float[] values = new float[16];
+			int got = shake_device.parse_decimal_fields(text, values);
+
+			boolean ok = (got == count);
+			// compared as bits so that -0.0 and 0.0 are told apart
+			for(int i=0;ok && i<count;i++)
+				ok = Float.floatToIntBits(values[i]) == Float.floatToIntBits(Float.parseFloat(expected[i]));
+			if(!ok) {
+				System.out.println("vector failed: \"" + text + "\" gave " + got + " values, expected " + count);
+				failed++;
+			}
+			lines++;
+		}
+		in.close();
+
+		System.out.println(lines + " vectors: " + failed + " failed");
+		System.exit(failed != 0 ? 1 : 0);
+	}
+
+}
@@ -1,2 +1,2 @@
-makesis pyshake.pkg
-signsis pyshake.sis pyshake.sisx mycert.cer mykey.key foobar
+makesis pyshake.pkg
+signsis pyshake.sis pyshake.sisx mycert.cer mykey.key foobar